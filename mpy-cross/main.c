@@ -54,9 +54,14 @@ static uint emit_opt = MP_EMIT_OPT_NONE;
 static bool include_source_lines = true;
 #endif
 
+#if MICROPY_OPT_FUSED_OPCODES
+static bool fused_opcodes = false;
+#endif
+
 // Heap size of GC heap (if enabled)
 // Make it larger on a 64 bit machine, because pointers are larger.
 long heap_size = 1024 * 1024 * (sizeof(mp_uint_t) / 4);
+static char *heap;
 
 static void stdout_print_strn(void *env, const char *str, size_t len) {
     (void)env;
@@ -74,6 +79,11 @@ static void stderr_print_strn(void *env, const char *str, size_t len) {
 
 static const mp_print_t mp_stderr_print = {NULL, stderr_print_strn};
 
+// Where compile errors are printed, stdout in batch mode so they can be matched to their job.
+static const mp_print_t *error_print = &mp_stderr_print;
+
+static char *backslash_to_forwardslash(char *path);
+
 static int compile_and_save(const char *file, const char *output_file, const char *source_file) {
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
@@ -129,16 +139,85 @@ static int compile_and_save(const char *file, const char *output_file, const cha
         return 0;
     } else {
         // uncaught exception
-        mp_obj_print_exception(&mp_stderr_print, (mp_obj_t)nlr.ret_val);
+        mp_obj_print_exception(error_print, (mp_obj_t)nlr.ret_val);
         return 1;
     }
 }
 
+// Split off the next tab-separated field of a batch job, or return NULL if it's empty.
+static char *batch_next_field(char **line) {
+    char *field = *line;
+    char *end = field + strcspn(field, "\t\r\n");
+    if (*end == '\t') {
+        *line = end + 1;
+    } else {
+        *line = end;
+    }
+    *end = '\0';
+    return *field == '\0' ? NULL : backslash_to_forwardslash(field);
+}
+
+// Compile the jobs read from stdin, one per line, until stdin is closed.  A job is
+// the tab-separated fields: input file, output file, source name, optimisation level.
+// All but the input file may be empty to use the default.  The output for each job is
+// any error message, then a line with \x04 and the exit status of that job.  So a
+// driver can keep a pool of these processes busy without starting one per file.
+static int compile_batch(void) {
+    error_print = &mp_stdout_print;
+    mp_uint_t default_opt = MP_STATE_VM(mp_optimise_value);
+    #if MICROPY_EMIT_NATIVE
+    uint8_t default_emit_opt = MP_STATE_VM(default_emit_opt);
+    #endif
+    int ret = 0;
+    static char line[4096];
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        // A job that doesn't fit in the buffer fails, rather than being split.
+        size_t len = strlen(line);
+        bool too_long = len == sizeof(line) - 1 && line[len - 1] != '\n';
+        if (too_long) {
+            int c;
+            while ((c = getchar()) != EOF && c != '\n') {
+            }
+        }
+        char *fields = line;
+        const char *input_file = batch_next_field(&fields);
+        const char *output_file = batch_next_field(&fields);
+        const char *source_file = batch_next_field(&fields);
+        const char *opt = batch_next_field(&fields);
+        int job_ret;
+        if (too_long) {
+            mp_printf(error_print, "batch job too long\n");
+            job_ret = 1;
+        } else if (input_file == NULL || strcmp(input_file, "-") == 0
+            || (output_file != NULL && strcmp(output_file, "-") == 0)
+            || (opt != NULL && (opt[0] < '0' || opt[0] > '3' || opt[1] != '\0'))) {
+            mp_printf(error_print, "invalid batch job\n");
+            job_ret = 1;
+        } else {
+            // Compile each file with a fresh runtime, so the output doesn't depend on
+            // the qstrs interned by previous jobs.
+            mp_deinit();
+            gc_init(heap, heap + heap_size);
+            mp_init();
+            #if MICROPY_EMIT_NATIVE
+            MP_STATE_VM(default_emit_opt) = default_emit_opt;
+            #endif
+            MP_STATE_VM(mp_optimise_value) = opt == NULL ? default_opt : (mp_uint_t)(opt[0] - '0');
+            job_ret = compile_and_save(input_file, output_file, source_file);
+        }
+        mp_printf(&mp_stdout_print, "\x04%d\n", job_ret);
+        ret |= job_ret;
+    }
+    return ret;
+}
+
 static int usage(char **argv) {
     printf(
         "usage: %s [<opts>] [-X <implopt>] [--] <input filename>\n"
+        "       %s [<opts>] [-X <implopt>] --batch\n"
         "Options:\n"
         "--version : show version information\n"
+        "--batch : compile the files listed on stdin, one per line as <input>\\t<output>\\t<source>\\t<opt>\n"
         "-o : output file for compiled bytecode (defaults to input filename with .mpy extension, or stdout if input is stdin)\n"
         "-s : source filename to embed in the compiled bytecode (defaults to input file)\n"
         "-v : verbose (trace various operations); can be multiple\n"
@@ -152,7 +231,7 @@ static int usage(char **argv) {
         "-march-flags=<flags> : set architecture-specific flags (can be either a dec/hex/bin value or a comma-separated flags string)\n"
         "                       supported flags for rv32imc: zba, zcmp\n"
         "\n"
-        "Implementation specific options:\n", argv[0]
+        "Implementation specific options:\n", argv[0], argv[0]
         );
     int impl_opts_cnt = 0;
     printf(
@@ -173,6 +252,11 @@ static int usage(char **argv) {
         "  no-source-lines -- exclude source line numbers\n");
     impl_opts_cnt += 2;
     #endif
+    #if MICROPY_OPT_FUSED_OPCODES
+    printf(
+        "  fused-opcodes   -- emit fused opcodes, which need a VM built with them\n");
+    impl_opts_cnt++;
+    #endif
 
     if (impl_opts_cnt == 0) {
         printf("  (none)\n");
@@ -205,6 +289,10 @@ static void pre_process_options(int argc, char **argv) {
                     // Allow excluding source lines for debug builds.
                     include_source_lines = false;
                 #endif
+                #if MICROPY_OPT_FUSED_OPCODES
+                } else if (strcmp(argv[a + 1], "fused-opcodes") == 0) {
+                    fused_opcodes = true;
+                #endif
                 } else if (strncmp(argv[a + 1], "heapsize=", sizeof("heapsize=") - 1) == 0) {
                     char *end;
                     heap_size = strtol(argv[a + 1] + sizeof("heapsize=") - 1, &end, 0);
@@ -298,7 +386,7 @@ static bool parse_rv32_flags_string(const char *source, unsigned long *flags) {
 MP_NOINLINE int main_(int argc, char **argv) {
     pre_process_options(argc, argv);
 
-    char *heap = malloc(heap_size);
+    heap = malloc(heap_size);
     gc_init(heap, heap + heap_size);
 
     mp_init();
@@ -322,11 +410,15 @@ MP_NOINLINE int main_(int argc, char **argv) {
     #if MICROPY_ENABLE_SOURCE_LINE
     mp_dynamic_compiler.include_source_lines = include_source_lines;
     #endif
+    #if MICROPY_OPT_FUSED_OPCODES
+    mp_dynamic_compiler.fused_opcodes = fused_opcodes;
+    #endif
 
     const char *input_file = NULL;
     const char *output_file = NULL;
     const char *source_file = NULL;
     bool option_parsing_active = true;
+    bool batch = false;
     const char *arch_flags = NULL;
 
     // parse main options
@@ -338,6 +430,8 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 printf(MICROPY_BANNER_NAME_AND_VERSION
                     "; mpy-cross emitting mpy v" MP_STRINGIFY(MPY_VERSION) "." MP_STRINGIFY(MPY_SUB_VERSION) "\n");
                 return 0;
+            } else if (strcmp(argv[a], "--batch") == 0) {
+                batch = true;
             } else if (strcmp(argv[a], "-v") == 0) {
                 // This verbose option doesn't currently do anything.
             } else if (strncmp(argv[a], "-O", 2) == 0) {
@@ -474,13 +568,21 @@ MP_NOINLINE int main_(int argc, char **argv) {
     }
     #endif
 
-    if (input_file == NULL) {
-        mp_printf(&mp_stderr_print, "no input file\n");
-        exit(1);
+    int ret;
+    if (batch) {
+        if (input_file != NULL || output_file != NULL || source_file != NULL) {
+            mp_printf(&mp_stderr_print, "input and output files must be given on stdin with --batch\n");
+            exit(1);
+        }
+        ret = compile_batch();
+    } else {
+        if (input_file == NULL) {
+            mp_printf(&mp_stderr_print, "no input file\n");
+            exit(1);
+        }
+        ret = compile_and_save(input_file, output_file, source_file);
     }
 
-    int ret = compile_and_save(input_file, output_file, source_file);
-
     mp_deinit();
 
     return ret & 0xff;
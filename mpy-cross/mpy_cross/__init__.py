@@ -25,10 +25,14 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 # THE SOFTWARE.
 
+import hashlib
 import os
+import queue
 import re
+import shutil
 import stat
 import subprocess
+import threading
 
 NATIVE_ARCHS = {
     "NATIVE_ARCH_NONE": "",
@@ -48,7 +52,7 @@ NATIVE_ARCHS = {
 
 globals().update(NATIVE_ARCHS)
 
-__all__ = ["version", "compile", "run", "CrossCompileError"] + list(NATIVE_ARCHS.keys())
+__all__ = ["version", "compile", "compile_batch", "BatchJob", "run", "CrossCompileError"] + list(NATIVE_ARCHS.keys())
 
 
 class CrossCompileError(Exception):
@@ -125,6 +129,155 @@ def compile(src, dest=None, src_path=None, opt=None, march=None, mpy_cross=None,
     run(args, mpy_cross)
 
 
+class BatchJob:
+    """
+    A .py file to compile with `compile_batch()`, with the same arguments as `compile()`.
+
+    After `compile_batch()` returns, `error` is the error output from mpy-cross if the
+    file failed to compile (otherwise None) and `cached` is True if the .mpy file was
+    copied from the cache instead of being compiled.
+    """
+
+    def __init__(self, src, dest=None, src_path=None, opt=None):
+        self.src = src
+        self.dest = dest or src[:-3] + ".mpy"
+        self.src_path = src_path
+        self.opt = opt
+        self.error = None
+        self.cached = False
+
+    def _line(self):
+        fields = (self.src, self.dest, self.src_path or "", "" if self.opt is None else self.opt)
+        line = "\t".join(str(f) for f in fields)
+        if "\n" in line or line.count("\t") != 3:
+            raise ValueError("paths can't contain tabs or newlines: {}".format(self.src))
+        return line + "\n"
+
+
+def _cache_key(mpy_cross_hash, args, job):
+    h = hashlib.sha256(mpy_cross_hash)
+    h.update(repr((args, job.src_path or job.src, job.opt)).encode())
+    with open(job.src, "rb") as f:
+        h.update(f.read())
+    return h.hexdigest()
+
+
+def _batch_worker(mpy_cross, args, jobs):
+    proc = subprocess.Popen(
+        [mpy_cross, "--batch"] + args,
+        stdin=subprocess.PIPE,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+    )
+    try:
+        while True:
+            try:
+                job = jobs.get_nowait()
+            except queue.Empty:
+                break
+            output = []
+            try:
+                proc.stdin.write(job._line().encode())
+                proc.stdin.flush()
+            except OSError:
+                pass
+            while True:
+                line = proc.stdout.readline()
+                if not line or line.startswith(b"\x04"):
+                    break
+                output.append(line)
+            if line == b"\x040\n":
+                job.error = None
+            else:
+                job.error = b"".join(output).decode()
+            if not line:
+                # mpy-cross exited, leave the remaining jobs to the other workers.
+                job.error += "mpy-cross exited unexpectedly\n"
+                break
+    finally:
+        try:
+            proc.stdin.close()
+        except OSError:
+            pass
+        proc.wait()
+
+
+def compile_batch(
+    jobs, march=None, mpy_cross=None, extra_args=None, num_workers=None, cache_dir=None
+):
+    """
+    Compile many .py files, using a pool of long-running mpy-cross processes.
+
+    Returns: The number of files that failed to compile.  The error for each file
+    is in the `error` attribute of its job.
+
+    Required arguments:
+     - jobs:        A list of `BatchJob` instances
+
+    Optional keyword arguments:
+     - march:       One of the `NATIVE_ARCH_*` constants (defaults to NATIVE_ARCH_NONE)
+     - mpy_cross:   Specific mpy-cross binary to use
+     - extra_args:  Additional arguments to pass to mpy-cross for every file
+     - num_workers: Number of mpy-cross processes (defaults to the number of CPUs)
+     - cache_dir:   Directory in which to cache .mpy files, keyed on the contents of
+                    the .py file, the mpy-cross binary and the arguments
+    """
+    mpy_cross = _find_mpy_cross_binary(mpy_cross)
+    if not os.path.exists(mpy_cross):
+        raise CrossCompileError("mpy-cross binary not found at {}.".format(mpy_cross))
+
+    args = []
+    if march:
+        args += ["-march=" + march]
+    if extra_args:
+        args += extra_args
+
+    # Copy the .mpy files that are in the cache, and queue the rest.
+    to_compile = queue.Queue()
+    keys = {}
+    if cache_dir:
+        with open(mpy_cross, "rb") as f:
+            mpy_cross_hash = hashlib.sha256(f.read()).digest()
+    for job in jobs:
+        job.error = None
+        job.cached = False
+        if cache_dir:
+            key = _cache_key(mpy_cross_hash, args, job)
+            cache_path = os.path.join(cache_dir, key[:2], key + ".mpy")
+            if os.path.exists(cache_path):
+                shutil.copyfile(cache_path, job.dest)
+                job.cached = True
+                continue
+            keys[job] = cache_path
+        # The worker clears this when it compiles the job.
+        job.error = "not compiled\n"
+        to_compile.put(job)
+
+    # Compile the remaining files.
+    num_workers = min(num_workers or os.cpu_count() or 1, to_compile.qsize())
+    threads = [
+        threading.Thread(target=_batch_worker, args=(mpy_cross, args, to_compile))
+        for _ in range(num_workers)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    # Add the new .mpy files to the cache.
+    failed = 0
+    for job in jobs:
+        if job.error is not None:
+            failed += 1
+        elif job in keys:
+            cache_path = keys[job]
+            os.makedirs(os.path.dirname(cache_path), exist_ok=True)
+            tmp_path = "{}.{}.tmp".format(cache_path, os.getpid())
+            shutil.copyfile(job.dest, tmp_path)
+            os.replace(tmp_path, cache_path)
+    return failed
+
+
 def run(args, mpy_cross=None):
     """
     Run mpy-cross with the specified command line arguments.
@@ -0,0 +1,240 @@
+#define MP_MAX_UNCOMPRESSED_TEXT_LEN (73)
+MP_COMPRESSED_DATA("can'\364'%q\247objec\364functio\356forma\364argumen\364argument\363no\364mus\364positiona\354conver\364keywor\344t\357'%s\247specifie\362strin\347attribut\345fo\362invali\344b\345o\346require\344typ\345inde\370ar\347%\344\341empt\371expecte\344implemente\344isn'\364unsupporte\344wit\350assignmen\364i\356comple\370outsid\345generato\362lengt\350overflo\367fro\355afte\362doesn'\364erro\362ha\363in\364missin\347n\357rang\345conversio\356identifie\362a\356nativ\345synta\370bu\364expectin\347nam\345supporte\344to\357fiel\344give\356multipl\345need\363negativ\345nonloca\354o\362sequenc\345tupl\345valu\345allowe\344ou\364struct\272unknow\356%\361cod\345dic\364hea\360i\363lis\364zer\357buffe\362impor\364modul\345numbe\362shoul\344specificatio\356value\363incompatibl\345issubclass(\251%\363an\344clas\363foun\344loca\354stor\345take\363expressio\356implicitl\371incomplet\345unexpecte\344.mp\371arg\363automati\343integers\254numberin\347operatio\356redefine\344sel\346bytecod\345encodin\347defaul\364go\364indice\363intege\362se\364suppor\364befor\345binar\371divid\345inden\364manua\354mktim\345retur\356switc\350unpac\353asyn\343a\364byte\363")
+MP_MATCH_COMPRESSED("%c needs int or char", "\377%c\276\255\301char")
+MP_MATCH_COMPRESSED("%q index out of range", "\377\311\227\306\224\260")
+MP_MATCH_COMPRESSED("%q indices must be integers, not %s", "\377\311\360\210\223\347\207\331")
+MP_MATCH_COMPRESSED("%q() takes %d positional arguments but %d were given", "\377%q()\337\231\211\206\266\231were\274")
+MP_MATCH_COMPRESSED("'%q' argument required", "\377\201\205\225")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item assignment", "\377\215\202\252\363item\241")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item deletion", "\377\215\202\252\363item deletion")
+MP_MATCH_COMPRESSED("'%s' object has no attribute '%q'", "\377\215\202\254\257\220\201")
+MP_MATCH_COMPRESSED("'%s' object isn't an iterator", "\377\215\202\236\263iterator")
+MP_MATCH_COMPRESSED("'%s' object isn't callable", "\377\215\202\236callable")
+MP_MATCH_COMPRESSED("'%s' object isn't iterable", "\377\215\202\236iterable")
+MP_MATCH_COMPRESSED("'%s' object isn't subscriptable", "\377\215\202\236subscriptable")
+MP_MATCH_COMPRESSED("'=' alignment not allowed in string format specifier", "\377'=' alignment\207\305\242\217\204\216")
+MP_MATCH_COMPRESSED("'await' outside function", "\377'await'\244\203")
+MP_MATCH_COMPRESSED("'break'/'continue' outside loop", "\377'break'/'continue'\244loop")
+MP_MATCH_COMPRESSED("'not' not implemented", "\377'not'\207\235")
+MP_MATCH_COMPRESSED("'return' outside function", "\377'return'\244\203")
+MP_MATCH_COMPRESSED("'yield' outside function", "\377'yield'\244\203")
+MP_MATCH_COMPRESSED("* arg after **", "\377*\230\251**")
+MP_MATCH_COMPRESSED("* arg after kwarg", "\377*\230\251kwarg")
+MP_MATCH_COMPRESSED("*x must be assignment target", "\377*x\210\223\241target")
+MP_MATCH_COMPRESSED("0.0 to a complex power", "\3770.0\214\232\243power")
+MP_MATCH_COMPRESSED("I/O operation on closed file", "\377I/O\351on closed file")
+MP_MATCH_COMPRESSED("LHS of keyword arg must be an id", "\377LHS\224\213\230\210\223\263id")
+MP_MATCH_COMPRESSED("[addrinfo error %d]", "\377[addrinfo\253%d]")
+MP_MATCH_COMPRESSED("__init__() should return None, not '%s'", "\377__init__()\324\372None,\207\215")
+MP_MATCH_COMPRESSED("abort() called", "abort() called")
+MP_MATCH_COMPRESSED("address %08x is not aligned to %d bytes", "\377address %08x\315\207aligned\214\231\377")
+MP_MATCH_COMPRESSED("annotation must be an identifier", "\377annotation\210\223\263\262")
+MP_MATCH_COMPRESSED("arg is an empty sequence", "\377\230\315\263\233\302")
+MP_MATCH_COMPRESSED("arg must be user-type", "\377\230\210\223user-type")
+MP_MATCH_COMPRESSED("argument name reused", "\377\205\270reused")
+MP_MATCH_COMPRESSED("argument num/types mismatch", "\377\205num/types mismatch")
+MP_MATCH_COMPRESSED("argument should be a '%q' not a '%q'", "\377\205\324\223\232\201\207\232\201")
+MP_MATCH_COMPRESSED("array/bytes required on right side", "\377array/bytes\225on right side")
+MP_MATCH_COMPRESSED("async for/with outside async function", "\377\375for/with\244\375\203")
+MP_MATCH_COMPRESSED("attributes not supported", "\377attributes\207\271")
+MP_MATCH_COMPRESSED("bad compile mode", "bad compile mode")
+MP_MATCH_COMPRESSED("bad typecode", "bad typecode")
+MP_MATCH_COMPRESSED("binary op %q not implemented", "\377\365op\311\207\235")
+MP_MATCH_COMPRESSED("bits must be 32 or less", "\377bits\210\22332\301less")
+MP_MATCH_COMPRESSED("buffer too small", "\377\320\272small")
+MP_MATCH_COMPRESSED("bytecode overflow", "\377\354\247")
+MP_MATCH_COMPRESSED("bytes value out of range", "\377\377\304\306\224\260")
+MP_MATCH_COMPRESSED("call super().__init__() first", "call super().__init__() first")
+MP_MATCH_COMPRESSED("can't add special method to already-subclassed class", "\377\200add special method\214already-subclassed\333")
+MP_MATCH_COMPRESSED("can't assign to expression", "\377\200assign\214\340")
+MP_MATCH_COMPRESSED("can't cancel self", "\377\200cancel\353")
+MP_MATCH_COMPRESSED("can't cast '%q' to '%q'", "\377\200cast\201\214\201")
+MP_MATCH_COMPRESSED("can't convert %s to complex", "\377\200\212\331\214\243")
+MP_MATCH_COMPRESSED("can't convert %s to float", "\377\200\212\331\214float")
+MP_MATCH_COMPRESSED("can't convert %s to int", "\377\200\212\331\214\255")
+MP_MATCH_COMPRESSED("can't convert '%q' object to %q implicitly", "\377\200\212\201\202\214\311\341")
+MP_MATCH_COMPRESSED("can't convert NaN to int", "\377\200\212NaN\214\255")
+MP_MATCH_COMPRESSED("can't convert inf to int", "\377\200\212inf\214\255")
+MP_MATCH_COMPRESSED("can't convert negative int to unsigned", "\377\200\212\277\255\214unsigned")
+MP_MATCH_COMPRESSED("can't create '%q' instances", "\377\200create\201instances")
+MP_MATCH_COMPRESSED("can't declare nonlocal in outer code", "\377\200declare\300\242outer\312")
+MP_MATCH_COMPRESSED("can't delete expression", "\377\200delete\340")
+MP_MATCH_COMPRESSED("can't do binary op between '%q' and '%q'", "\377\200do\365op between\201\332\201")
+MP_MATCH_COMPRESSED("can't do unary op of '%q'", "\377\200do unary op\224\201")
+MP_MATCH_COMPRESSED("can't implicitly convert '%q' to 'bool'", "\377\200\341\212\201\214'bool'")
+MP_MATCH_COMPRESSED("can't import name %q", "\377\200\321\270\311")
+MP_MATCH_COMPRESSED("can't load from '%q'", "\377\200load\250\201")
+MP_MATCH_COMPRESSED("can't load with '%q' index", "\377\200load\240\201\227")
+MP_MATCH_COMPRESSED("can't perform relative import", "\377\200perform relative\321")
+MP_MATCH_COMPRESSED("can't send non-None value to a just-started generator", "\377\200send non-None\304\214\232just-started\245")
+MP_MATCH_COMPRESSED("can't set attribute", "\377\200\362\220")
+MP_MATCH_COMPRESSED("can't store '%q'", "\377\200\336\201")
+MP_MATCH_COMPRESSED("can't store to '%q'", "\377\200\336\214\201")
+MP_MATCH_COMPRESSED("can't store with '%q' index", "\377\200\336\240\201\227")
+MP_MATCH_COMPRESSED("can't switch from automatic field numbering to manual field specification", "\377\200\373\250\346\273\350\214\370\273\325")
+MP_MATCH_COMPRESSED("can't switch from manual field specification to automatic field numbering", "\377\200\373\250\370\273\325\214\346\273\350")
+MP_MATCH_COMPRESSED("can't truncate-divide a complex number", "\377\200truncate-divide\232\243\323")
+MP_MATCH_COMPRESSED("can't unambiguously get sizeof scalar", "\377\200unambiguously get sizeof scalar")
+MP_MATCH_COMPRESSED("can't wait", "\377\200wait")
+MP_MATCH_COMPRESSED("cannot emit native code for this architecture", "\377cannot emit\264\312\221this architecture")
+MP_MATCH_COMPRESSED("casting", "casting")
+MP_MATCH_COMPRESSED("char not in range(0x110000)", "\377char\207\242range(0x110000)")
+MP_MATCH_COMPRESSED("comparison of int and uint", "\377comparison\224\255\332uint")
+MP_MATCH_COMPRESSED("complex divide by zero", "\377\243\366by\317")
+MP_MATCH_COMPRESSED("conversion to object", "\377\261\214\202")
+MP_MATCH_COMPRESSED("default 'except' must be last", "\377\356'except'\210\223last")
+MP_MATCH_COMPRESSED("dict update sequence has wrong length", "\377\313update\302\254wrong\246")
+MP_MATCH_COMPRESSED("div/mod not implemented for uint", "\377div/mod\207\235\221uint")
+MP_MATCH_COMPRESSED("divide by zero", "\377\366by\317")
+MP_MATCH_COMPRESSED("empty", "\377\233")
+MP_MATCH_COMPRESSED("empty heap", "\377\233\314")
+MP_MATCH_COMPRESSED("empty separator", "\377\233separator")
+MP_MATCH_COMPRESSED("encoding not supported: %q", "\377\355\207supported:\311")
+MP_MATCH_COMPRESSED("end of format while looking for conversion specifier", "\377end\224\204while looking\221\261\216")
+MP_MATCH_COMPRESSED("error in regex", "\377\253\242regex")
+MP_MATCH_COMPRESSED("exceptions must derive from BaseException", "\377exceptions\210derive\250BaseException")
+MP_MATCH_COMPRESSED("expected ':' after format specifier", "\377\234':'\251\204\216")
+MP_MATCH_COMPRESSED("expected str or Interpolation", "\377\234str\301Interpolation")
+MP_MATCH_COMPRESSED("expecting a dict for keyword args", "\377\267\232\313\221\213\345")
+MP_MATCH_COMPRESSED("expecting just a value for set", "\377\267just\232\304\221\362")
+MP_MATCH_COMPRESSED("expecting key:value for dict", "\377\267key:value\221\313")
+MP_MATCH_COMPRESSED("extra keyword arguments given", "\377extra\213\206\274")
+MP_MATCH_COMPRESSED("extra positional arguments given", "\377extra\211\206\274")
+MP_MATCH_COMPRESSED("format", "\377\204")
+MP_MATCH_COMPRESSED("format needs a dict", "\377\204\276\232\313")
+MP_MATCH_COMPRESSED("format string didn't convert all arguments", "\377\204\217didn't\212all\206")
+MP_MATCH_COMPRESSED("format string needs more arguments", "\377\204\217\276more\206")
+MP_MATCH_COMPRESSED("full", "full")
+MP_MATCH_COMPRESSED("function doesn't take keyword arguments", "\377\203\252take\213\206")
+MP_MATCH_COMPRESSED("function expected at most %d arguments, got %d", "\377\203\234\376most\231arguments,\357\231")
+MP_MATCH_COMPRESSED("function got multiple values for argument '%q'", "\377\203\357\275\326\221\205\201")
+MP_MATCH_COMPRESSED("function missing %d required positional arguments", "\377\203\256\231\225\211\206")
+MP_MATCH_COMPRESSED("function missing keyword-only argument", "\377\203\256keyword-only\205")
+MP_MATCH_COMPRESSED("function missing required keyword argument '%q'", "\377\203\256\225\213\205\201")
+MP_MATCH_COMPRESSED("function missing required positional argument #%d", "\377\203\256\225\211\205#%d")
+MP_MATCH_COMPRESSED("function must be bytecode", "\377\203\210\223\354")
+MP_MATCH_COMPRESSED("function takes %d positional arguments but %d were given", "\377\203\337\231\211\206\266\231were\274")
+MP_MATCH_COMPRESSED("generator already executing", "\377\245already executing")
+MP_MATCH_COMPRESSED("generator ignored GeneratorExit", "\377\245ignored GeneratorExit")
+MP_MATCH_COMPRESSED("generator raised StopIteration", "\377\245raised StopIteration")
+MP_MATCH_COMPRESSED("hash is final", "\377hash\315final")
+MP_MATCH_COMPRESSED("heap must be a list", "\377\314\210\223\232\316")
+MP_MATCH_COMPRESSED("identifier redefined as global", "\377\262\352as global")
+MP_MATCH_COMPRESSED("identifier redefined as nonlocal", "\377\262\352as\300")
+MP_MATCH_COMPRESSED("import * not at module level", "\377\321*\207\376\322level")
+MP_MATCH_COMPRESSED("incompatible .mpy arch", "\377\327\344arch")
+MP_MATCH_COMPRESSED("incompatible .mpy file", "\377\327\344file")
+MP_MATCH_COMPRESSED("incomplete format", "\377\342\204")
+MP_MATCH_COMPRESSED("incomplete format key", "\377\342\204key")
+MP_MATCH_COMPRESSED("incorrect padding", "incorrect padding")
+MP_MATCH_COMPRESSED("int() arg 2 must be >= 2 and <= 36", "\377int()\2302\210\223>= 2\332<= 36")
+MP_MATCH_COMPRESSED("integer needed", "\377\361needed")
+MP_MATCH_COMPRESSED("invalid format", "\377\222\204")
+MP_MATCH_COMPRESSED("invalid format specifier", "\377\222\204\216")
+MP_MATCH_COMPRESSED("invalid micropython decorator", "\377\222micropython decorator")
+MP_MATCH_COMPRESSED("invalid mktime usage", "\377\222\371usage")
+MP_MATCH_COMPRESSED("invalid region", "\377\222region")
+MP_MATCH_COMPRESSED("invalid syntax", "\377\222\265")
+MP_MATCH_COMPRESSED("invalid syntax for number", "\377\222\265\221\323")
+MP_MATCH_COMPRESSED("issubclass() arg 1 must be a class", "\377\330\2301\210\223\232\333")
+MP_MATCH_COMPRESSED("issubclass() arg 2 must be a class or a tuple of classes", "\377\330\2302\210\223\232\333\301\232\303\224classes")
+MP_MATCH_COMPRESSED("join expects a list of str/bytes objects consistent with self object", "\377join expects\232\316\224str/bytes objects consistent\240\353\202")
+MP_MATCH_COMPRESSED("keyword argument(s) not implemented - use normal args instead", "\377\213argument(s)\207\235- use normal\345instead")
+MP_MATCH_COMPRESSED("lhs and rhs should be compatible", "\377lhs\332rhs\324\223compatible")
+MP_MATCH_COMPRESSED("local '%q' has type '%q' but source is '%q'", "\377\335\201\254\226\201\266source\315\201")
+MP_MATCH_COMPRESSED("local '%q' used before type known", "\377\335\201used\364\226known")
+MP_MATCH_COMPRESSED("local variable referenced before assignment", "\377\335variable referenced\364\241")
+MP_MATCH_COMPRESSED("malformed f-string", "malformed f-string")
+MP_MATCH_COMPRESSED("math domain error", "\377math domain\253")
+MP_MATCH_COMPRESSED("memory allocation failed, heap is locked", "\377memory allocation failed,\314\315locked")
+MP_MATCH_COMPRESSED("memoryview offset too large", "\377memoryview offset\272large")
+MP_MATCH_COMPRESSED("mktime needs a tuple of length 8 or 9", "\377\371\276\232\303\224\2468\3019")
+MP_MATCH_COMPRESSED("module '%q' has no attribute '%q'", "\377\322\201\254\257\220\201")
+MP_MATCH_COMPRESSED("multiple *x in assignment", "\377\275*x\242\241")
+MP_MATCH_COMPRESSED("multiple bases have instance lay-out conflict", "\377\275bases have instance lay-out conflict")
+MP_MATCH_COMPRESSED("must raise an object", "\377\210raise\263\202")
+MP_MATCH_COMPRESSED("must use keyword argument for key function", "\377\210use\213\205\221key\203")
+MP_MATCH_COMPRESSED("name '%q' isn't defined", "\377\270\201\236defined")
+MP_MATCH_COMPRESSED("name too long", "\377\270\272long")
+MP_MATCH_COMPRESSED("native code in .mpy unsupported", "\377\264\312\242\344\237")
+MP_MATCH_COMPRESSED("native raise", "\377\264raise")
+MP_MATCH_COMPRESSED("native yield", "\377\264yield")
+MP_MATCH_COMPRESSED("need more than %d values to unpack", "\377need more than\231\326\214\374")
+MP_MATCH_COMPRESSED("negative factorial", "\377\277factorial")
+MP_MATCH_COMPRESSED("negative shift count", "\377\277shift count")
+MP_MATCH_COMPRESSED("no active exception to reraise", "\377\257active exception\214reraise")
+MP_MATCH_COMPRESSED("no binding for nonlocal found", "\377\257binding\221\300\334")
+MP_MATCH_COMPRESSED("no module named '%q'", "\377\257\322named\201")
+MP_MATCH_COMPRESSED("no such attribute", "\377\257such\220")
+MP_MATCH_COMPRESSED("non-default argument follows default argument", "\377non-default\205follows\356\205")
+MP_MATCH_COMPRESSED("non-hex digit", "non-hex digit")
+MP_MATCH_COMPRESSED("not a constant", "\377\207\232constant")
+MP_MATCH_COMPRESSED("not a heap object", "\377\207\232\314\202")
+MP_MATCH_COMPRESSED("object '%s' isn't a tuple or list", "\377\202\215\236\232\303\301\316")
+MP_MATCH_COMPRESSED("object not in sequence", "\377\202\207\242\302")
+MP_MATCH_COMPRESSED("object of type '%s' has no len()", "\377\202\224\226\215\254\257len()")
+MP_MATCH_COMPRESSED("object with buffer protocol required", "\377\202\240\320protocol\225")
+MP_MATCH_COMPRESSED("only slices with step=1 (aka None) are supported", "\377only slices\240step=1 (aka None) are\271")
+MP_MATCH_COMPRESSED("opcode", "opcode")
+MP_MATCH_COMPRESSED("ord() expected a character, but string of length %d found", "\377ord()\234\232character,\266\217\224\246\231\334")
+MP_MATCH_COMPRESSED("overflow converting long int to machine word", "\377\247converting long\255\214machine word")
+MP_MATCH_COMPRESSED("pop from an empty set", "\377pop\250\263\233\362")
+MP_MATCH_COMPRESSED("pop from empty list", "\377pop\250\233\316")
+MP_MATCH_COMPRESSED("popitem(): dictionary is empty", "\377popitem(): dictionary\315\233")
+MP_MATCH_COMPRESSED("positional arg after **", "\377\211\230\251**")
+MP_MATCH_COMPRESSED("positional arg after keyword arg", "\377\211\230\251\213\230")
+MP_MATCH_COMPRESSED("pow() with 3 arguments requires integers", "\377pow()\2403\206requires integers")
+MP_MATCH_COMPRESSED("regex too complex", "\377regex\272\243")
+MP_MATCH_COMPRESSED("requested length %d but object has length %d", "\377requested\246\231\266\202\254\246\231")
+MP_MATCH_COMPRESSED("return expected '%q' but got '%q'", "\377\372\234\201\266\357\201")
+MP_MATCH_COMPRESSED("rsplit(None,n)", "rsplit(None,n)")
+MP_MATCH_COMPRESSED("schedule queue full", "schedule queue full")
+MP_MATCH_COMPRESSED("sign not allowed in string format specifier", "\377sign\207\305\242\217\204\216")
+MP_MATCH_COMPRESSED("sign not allowed with integer format specifier 'c'", "\377sign\207\305\240\361\204\216'c'")
+MP_MATCH_COMPRESSED("single '}' encountered in format string", "\377single '}' encountered\242\204\217")
+MP_MATCH_COMPRESSED("slice step can't be zero", "\377slice step\200\223\317")
+MP_MATCH_COMPRESSED("splitting with sub-captures", "\377splitting\240sub-captures")
+MP_MATCH_COMPRESSED("stream operation not supported", "\377stream\351\207\271")
+MP_MATCH_COMPRESSED("string argument without an encoding", "\377\217\205without\263\355")
+MP_MATCH_COMPRESSED("string index out of range", "\377\217\227\306\224\260")
+MP_MATCH_COMPRESSED("string indices must be integers, not %s", "\377\217\360\210\223\347\207\331")
+MP_MATCH_COMPRESSED("struct: can't index", "\377\307\200\227")
+MP_MATCH_COMPRESSED("struct: index out of range", "\377\307\227\306\224\260")
+MP_MATCH_COMPRESSED("struct: no fields", "\377\307\257fields")
+MP_MATCH_COMPRESSED("substring not found", "\377substring\207\334")
+MP_MATCH_COMPRESSED("super() can't find self", "\377super()\200find\353")
+MP_MATCH_COMPRESSED("syntax error in JSON", "\377\265\253\242JSON")
+MP_MATCH_COMPRESSED("syntax error in uctypes descriptor", "\377\265\253\242uctypes descriptor")
+MP_MATCH_COMPRESSED("ticks interval overflow", "\377ticks interval\247")
+MP_MATCH_COMPRESSED("too many args", "\377\272many\345")
+MP_MATCH_COMPRESSED("too many values to unpack (expected %d)", "\377\272many\326\214\374(expected %d)")
+MP_MATCH_COMPRESSED("tuple index out of range", "\377\303\227\306\224\260")
+MP_MATCH_COMPRESSED("type '%q' isn't an acceptable base type", "\377\226\201\236\263acceptable base\226")
+MP_MATCH_COMPRESSED("type object '%q' has no attribute '%q'", "\377\226\202\201\254\257\220\201")
+MP_MATCH_COMPRESSED("type takes 1 or 3 arguments", "\377\226\3371\3013\206")
+MP_MATCH_COMPRESSED("unexpected indent", "\377\343\367")
+MP_MATCH_COMPRESSED("unexpected keyword argument '%q'", "\377\343\213\205\201")
+MP_MATCH_COMPRESSED("unicode name escapes", "\377unicode\270escapes")
+MP_MATCH_COMPRESSED("unindent doesn't match any outer indent level", "\377unindent\252match any outer\367level")
+MP_MATCH_COMPRESSED("unknown conversion specifier %c", "\377\310\261\216%c")
+MP_MATCH_COMPRESSED("unknown format code '%c' for object of type '%s'", "\377\310\204\312'%c'\221\202\224\226\215")
+MP_MATCH_COMPRESSED("unknown type '%q'", "\377\310\226\201")
+MP_MATCH_COMPRESSED("unmarshallable object", "\377unmarshallable\202")
+MP_MATCH_COMPRESSED("unmatched '{' in format", "\377unmatched '{'\242\204")
+MP_MATCH_COMPRESSED("unreadable attribute", "\377unreadable\220")
+MP_MATCH_COMPRESSED("unsupported format character '%c' (0x%x) at index %d", "\377\237\204character '%c' (0x%x)\376\227\231")
+MP_MATCH_COMPRESSED("unsupported type for %q: '%s'", "\377\237\226\221%q:\215")
+MP_MATCH_COMPRESSED("unsupported types for %q: '%s', '%s'", "\377\237types\221%q: '%s',\215")
+MP_MATCH_COMPRESSED("value would overflow a %d byte buffer", "\377\304would\247\232\231byte\320")
+MP_MATCH_COMPRESSED("wbits", "wbits")
+MP_MATCH_COMPRESSED("wrong number of arguments", "\377wrong\323\224\206")
+MP_MATCH_COMPRESSED("zero step", "\377\317step")
+// Total input length:      6795
+// Total compressed length: 3188
+// Total data length:       1148
+// Predicted saving:        2459
+
+// gzip length:             3782
+// Percentage of gzip:      114.6%
+// zlib length:             3770
+// Percentage of zlib:      115.0%
@@ -0,0 +1,4 @@
+// This file was generated by py/makeversionhdr.py
+#define MICROPY_GIT_TAG "cb7eafdd26-dirty"
+#define MICROPY_GIT_HASH "cb7eafd"
+#define MICROPY_BUILD_DATE "2026-10-17"
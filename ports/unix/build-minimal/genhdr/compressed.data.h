@@ -0,0 +1,115 @@
+#define MP_MAX_UNCOMPRESSED_TEXT_LEN (68)
+MP_COMPRESSED_DATA("argumen\364functio\356objec\364can'\364no\364mus\364supporte\344ar\347assignmen\364keywor\344generato\362outsid\345positiona\354o\346nam\345afte\362b\345multipl\345negativ\345nonloca\354overflo\367require\344t\357wron\347conver\364doesn'\364fo\362invali\344missin\347suppor\364i\356typ\345issubclass(\251\341empt\371foun\344in\364n\357rang\345valu\345expressio\356identifie\362tuple/lis\364unexpecte\344argument\363redefine\344wit\350instanc\345sequenc\345defaul\364expect\363ha\363ou\364buffe\362impor\364inden\364lengt\350numbe\362synta\370value\363a\356asyn\343clas\363inde\370isn'\364oute\362tupl\345'%q\247fro\355ite\355lis\364lon\347sel\346zer\357\262ba\344to\357*\252*\370a\363i\363o\362\252\261#%\344%\344%\361'await\247'break'/'continue\247'except\247'yield\247\2633-ar\3473\266<\275>\275BaseExceptio\356GeneratorExi\364LH\323Non\345StopIteratio\356__init__(\251abort(\251acceptabl\345activ\345allocatio\356alread\371an\344an\371arg\363assig\356attribut\345attribute\363bas\345base\363befor\345bindin\347buil\344b\371byt\345bytecod\345byte\363callabl\345calle\344cha\362characte\362chr(\251classe\363")
+MP_MATCH_COMPRESSED("'await' outside function", "\377\327\213\201")
+MP_MATCH_COMPRESSED("'break'/'continue' outside loop", "\377\330\213loop")
+MP_MATCH_COMPRESSED("'yield' outside function", "\377\332\213\201")
+MP_MATCH_COMPRESSED("* arg after **", "\377\322\207\217\315")
+MP_MATCH_COMPRESSED("* arg after kwarg", "\377\322\207\217kwarg")
+MP_MATCH_COMPRESSED("*x must be assignment target", "\377\316\205\220\210target")
+MP_MATCH_COMPRESSED("3-arg pow() not supported", "\377\334pow()\204\206")
+MP_MATCH_COMPRESSED("LHS of keyword arg must be an id", "\377\342\215\211\207\205\220\274id")
+MP_MATCH_COMPRESSED("__init__() should return None", "\377\345should return\343")
+MP_MATCH_COMPRESSED("abort() called", "\377\346\373")
+MP_MATCH_COMPRESSED("argument name reused", "\377\200\216reused")
+MP_MATCH_COMPRESSED("argument num/types mismatch", "\377\200num/types mismatch")
+MP_MATCH_COMPRESSED("async for/with outside async function", "\377\275for/with\213\275\201")
+MP_MATCH_COMPRESSED("attributes not supported", "\377\360\204\206")
+MP_MATCH_COMPRESSED("bad format string", "\377\313format string")
+MP_MATCH_COMPRESSED("bad typecode", "\377\313typecode")
+MP_MATCH_COMPRESSED("bytecode overflow", "\377\370\224")
+MP_MATCH_COMPRESSED("bytes value out of range", "\377\371\247\264\215\246")
+MP_MATCH_COMPRESSED("can't assign to expression", "\377\203\356\226\250")
+MP_MATCH_COMPRESSED("can't convert negative int to unsigned", "\377\203\230\222\244\226unsigned")
+MP_MATCH_COMPRESSED("can't convert to int", "\377\203\230\226\244")
+MP_MATCH_COMPRESSED("can't convert to str implicitly", "\377\203\230\226str implicitly")
+MP_MATCH_COMPRESSED("can't create instance", "\377\203create\257")
+MP_MATCH_COMPRESSED("can't declare nonlocal in outer code", "\377\203declare\223\236\301code")
+MP_MATCH_COMPRESSED("can't delete expression", "\377\203delete\250")
+MP_MATCH_COMPRESSED("can't import name %q", "\377\203\266\216\326")
+MP_MATCH_COMPRESSED("can't perform relative import", "\377\203perform relative\266")
+MP_MATCH_COMPRESSED("can't send non-None value to a just-started generator", "\377\203send non-None\247\226\241just-started\212")
+MP_MATCH_COMPRESSED("char not in range(0x110000)", "\377\374\204\236range(0x110000)")
+MP_MATCH_COMPRESSED("chr() arg not in range(256)", "\377\376\207\204\236range(256)")
+MP_MATCH_COMPRESSED("decimal numbers not supported", "\377decimal numbers\204\206")
+MP_MATCH_COMPRESSED("default 'except' must be last", "\377\261\331\205\220last")
+MP_MATCH_COMPRESSED("dict update sequence has wrong length", "\377dict update\260\263\227\270")
+MP_MATCH_COMPRESSED("divide by zero", "\377divide\366\311")
+MP_MATCH_COMPRESSED("empty separator", "\377\242separator")
+MP_MATCH_COMPRESSED("exceptions must derive from BaseException", "\377exceptions\205derive\304\340")
+MP_MATCH_COMPRESSED("expected tuple/list", "\377expected\252")
+MP_MATCH_COMPRESSED("function got multiple values for argument '%q'", "\377\201got\221\273\232\200\303")
+MP_MATCH_COMPRESSED("function missing keyword-only argument", "\377\201\234keyword-only\200")
+MP_MATCH_COMPRESSED("function missing required keyword argument '%q'", "\377\201\234\225\211\200\303")
+MP_MATCH_COMPRESSED("function missing required positional argument #%d", "\377\201\234\225\214\200\324")
+MP_MATCH_COMPRESSED("generator already executing", "\377\212\352executing")
+MP_MATCH_COMPRESSED("generator ignored GeneratorExit", "\377\212ignored\341")
+MP_MATCH_COMPRESSED("generator raised StopIteration", "\377\212raised\344")
+MP_MATCH_COMPRESSED("identifier redefined as global", "\377\251\255\317global")
+MP_MATCH_COMPRESSED("identifier redefined as nonlocal", "\377\251\255\317\223")
+MP_MATCH_COMPRESSED("index out of range", "\377\277\264\215\246")
+MP_MATCH_COMPRESSED("indices must be integers", "\377indices\205\220integers")
+MP_MATCH_COMPRESSED("int() arg 2 must be >= 2 and <= 36", "\377int()\207\312\205\220\337\312\353\336\335")
+MP_MATCH_COMPRESSED("invalid micropython decorator", "\377\233micropython decorator")
+MP_MATCH_COMPRESSED("invalid syntax", "\377\233\272")
+MP_MATCH_COMPRESSED("invalid syntax for integer", "\377\233\272\232integer")
+MP_MATCH_COMPRESSED("issubclass() arg 1 must be a class", "\377\240\207\323\205\220\241\276")
+MP_MATCH_COMPRESSED("issubclass() arg 2 must be a class or a tuple of classes", "\377\240\207\312\205\220\241\276\321\241\302\215\377")
+MP_MATCH_COMPRESSED("join expects a list of str/bytes objects consistent with self object", "\377join\262\241\306\215str/bytes objects consistent\256\310\202")
+MP_MATCH_COMPRESSED("local variable referenced before assignment", "\377local variable referenced\363\210")
+MP_MATCH_COMPRESSED("long int not supported in this build", "\377\307\244\204\206\236this\365")
+MP_MATCH_COMPRESSED("memory allocation failed, heap is locked", "\377memory\351failed, heap\320locked")
+MP_MATCH_COMPRESSED("module not found", "\377module\204\243")
+MP_MATCH_COMPRESSED("multiple *x in assignment", "\377\221\316\236\210")
+MP_MATCH_COMPRESSED("multiple bases have instance lay-out conflict", "\377\221\362have\257lay-out conflict")
+MP_MATCH_COMPRESSED("must use keyword argument for key function", "\377\205use\211\200\232key\201")
+MP_MATCH_COMPRESSED("name not defined", "\377\216\204defined")
+MP_MATCH_COMPRESSED("name too long", "\377\216\314\307")
+MP_MATCH_COMPRESSED("negative power with no float support", "\377\222power\256\245float\235")
+MP_MATCH_COMPRESSED("negative shift count", "\377\222shift count")
+MP_MATCH_COMPRESSED("no active exception to reraise", "\377\245\350exception\226reraise")
+MP_MATCH_COMPRESSED("no binding for nonlocal found", "\377\245\364\232\223\243")
+MP_MATCH_COMPRESSED("no such attribute", "\377\245such\357")
+MP_MATCH_COMPRESSED("non-default argument follows default argument", "\377non-default\200follows\261\200")
+MP_MATCH_COMPRESSED("object doesn't support item assignment", "\377\202\231\235\305\210")
+MP_MATCH_COMPRESSED("object doesn't support item deletion", "\377\202\231\235\305deletion")
+MP_MATCH_COMPRESSED("object has no len", "\377\202\263\245len")
+MP_MATCH_COMPRESSED("object isn't subscriptable", "\377\202\300subscriptable")
+MP_MATCH_COMPRESSED("object not an iterator", "\377\202\204\274iterator")
+MP_MATCH_COMPRESSED("object not callable", "\377\202\204\372")
+MP_MATCH_COMPRESSED("object not in sequence", "\377\202\204\236\260")
+MP_MATCH_COMPRESSED("object not iterable", "\377\202\204iterable")
+MP_MATCH_COMPRESSED("object with buffer protocol required", "\377\202\256\265protocol\225")
+MP_MATCH_COMPRESSED("opcode", "opcode")
+MP_MATCH_COMPRESSED("ord expects a character", "\377ord\262\241\375")
+MP_MATCH_COMPRESSED("pop from empty list", "\377pop\304\242\306")
+MP_MATCH_COMPRESSED("popitem(): dictionary is empty", "\377popitem(): dictionary\320\242")
+MP_MATCH_COMPRESSED("positional arg after **", "\377\214\207\217\315")
+MP_MATCH_COMPRESSED("positional arg after keyword arg", "\377\214\207\217\211\207")
+MP_MATCH_COMPRESSED("rsplit(None,n)", "rsplit(None,n)")
+MP_MATCH_COMPRESSED("small int overflow", "\377small\244\224")
+MP_MATCH_COMPRESSED("stream operation not supported", "\377stream operation\204\206")
+MP_MATCH_COMPRESSED("substring not found", "\377substring\204\243")
+MP_MATCH_COMPRESSED("super() can't find self", "\377super()\203find\310")
+MP_MATCH_COMPRESSED("too many args", "\377\314many\355")
+MP_MATCH_COMPRESSED("tuple index out of range", "\377\302\277\264\215\246")
+MP_MATCH_COMPRESSED("tuple/list has wrong length", "\377\252\263\227\270")
+MP_MATCH_COMPRESSED("type isn't an acceptable base type", "\377\237\300\274\347\361\237")
+MP_MATCH_COMPRESSED("type takes 1 or 3 arguments", "\377\237takes\323\321\333\254")
+MP_MATCH_COMPRESSED("unexpected indent", "\377\253\267")
+MP_MATCH_COMPRESSED("unexpected keyword argument", "\377\253\211\200")
+MP_MATCH_COMPRESSED("unicode name escapes", "\377unicode\216escapes")
+MP_MATCH_COMPRESSED("unindent doesn't match any outer indent level", "\377unindent\231match\354\301\267level")
+MP_MATCH_COMPRESSED("unsupported type for operator", "\377unsupported\237\232operator")
+MP_MATCH_COMPRESSED("value would overflow a %d byte buffer", "\377\247would\224\241\325\367\265")
+MP_MATCH_COMPRESSED("wrong number of arguments", "\377\227\271\215\254")
+MP_MATCH_COMPRESSED("wrong number of values to unpack", "\377\227\271\215\273\226unpack")
+MP_MATCH_COMPRESSED("zero step", "\377\311step")
+// Total input length:      2979
+// Total compressed length: 1305
+// Total data length:       1110
+// Predicted saving:        564
+
+// gzip length:             1850
+// Percentage of gzip:      130.5%
+// zlib length:             1838
+// Percentage of zlib:      131.4%
@@ -0,0 +1,235 @@
+#define MP_MAX_UNCOMPRESSED_TEXT_LEN (73)
+MP_COMPRESSED_DATA("can'\364'%q\247objec\364forma\364argumen\364functio\356argument\363no\364mus\364positiona\354conver\364keywor\344t\357'%s\247specifie\362strin\347attribut\345fo\362o\346require\344typ\345b\345inde\370ar\347invali\344%\344empt\371implemente\344isn'\364unsupporte\344wit\350\341assignmen\364i\356comple\370outsid\345generato\362lengt\350expecte\344overflo\367fro\355afte\362doesn'\364erro\362ha\363in\364missin\347n\357rang\345conversio\356identifie\362a\356nativ\345synta\370bu\364expectin\347nam\345supporte\344to\357fiel\344give\356multipl\345need\363negativ\345nonloca\354sequenc\345tupl\345valu\345allowe\344ou\364struct\272unknow\356%\361cod\345dic\364i\363lis\364o\362zer\357buffe\362impor\364modul\345numbe\362shoul\344specificatio\356value\363incompatibl\345issubclass(\251%\363an\344clas\363foun\344loca\354stor\345take\363expressio\356implicitl\371incomplet\345unexpecte\344.mp\371arg\363automati\343hea\360integers\254numberin\347operatio\356redefine\344sel\346encodin\347defaul\364go\364indice\363intege\362se\364suppor\364befor\345binar\371divid\345inden\364manua\354mktim\345retur\356switc\350unpac\353asyn\343a\364byte\363extr\341")
+MP_MATCH_COMPRESSED("%c needs int or char", "\377%c\276\255\315char")
+MP_MATCH_COMPRESSED("%q index out of range", "\377\310\226\305\222\260")
+MP_MATCH_COMPRESSED("%q indices must be integers, not %s", "\377\310\357\210\225\347\207\330")
+MP_MATCH_COMPRESSED("%q() takes %d positional arguments but %d were given", "\377%q()\336\231\211\206\266\231were\274")
+MP_MATCH_COMPRESSED("'%q' argument required", "\377\201\204\223")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item assignment", "\377\215\202\252\362item\240")
+MP_MATCH_COMPRESSED("'%s' object doesn't support item deletion", "\377\215\202\252\362item deletion")
+MP_MATCH_COMPRESSED("'%s' object has no attribute '%q'", "\377\215\202\254\257\220\201")
+MP_MATCH_COMPRESSED("'%s' object isn't an iterator", "\377\215\202\234\263iterator")
+MP_MATCH_COMPRESSED("'%s' object isn't callable", "\377\215\202\234callable")
+MP_MATCH_COMPRESSED("'%s' object isn't iterable", "\377\215\202\234iterable")
+MP_MATCH_COMPRESSED("'%s' object isn't subscriptable", "\377\215\202\234subscriptable")
+MP_MATCH_COMPRESSED("'=' alignment not allowed in string format specifier", "\377'=' alignment\207\304\241\217\203\216")
+MP_MATCH_COMPRESSED("'await' outside function", "\377'await'\243\205")
+MP_MATCH_COMPRESSED("'break'/'continue' outside loop", "\377'break'/'continue'\243loop")
+MP_MATCH_COMPRESSED("'not' not implemented", "\377'not'\207\233")
+MP_MATCH_COMPRESSED("'return' outside function", "\377'return'\243\205")
+MP_MATCH_COMPRESSED("'yield' outside function", "\377'yield'\243\205")
+MP_MATCH_COMPRESSED("* arg after **", "\377*\227\251**")
+MP_MATCH_COMPRESSED("* arg after kwarg", "\377*\227\251kwarg")
+MP_MATCH_COMPRESSED("*x must be assignment target", "\377*x\210\225\240target")
+MP_MATCH_COMPRESSED("0.0 to a complex power", "\3770.0\214\237\242power")
+MP_MATCH_COMPRESSED("I/O operation on closed file", "\377I/O\351on closed file")
+MP_MATCH_COMPRESSED("LHS of keyword arg must be an id", "\377LHS\222\213\227\210\225\263id")
+MP_MATCH_COMPRESSED("[addrinfo error %d]", "\377[addrinfo\253%d]")
+MP_MATCH_COMPRESSED("__init__() should return None, not '%s'", "\377__init__()\323\371None,\207\215")
+MP_MATCH_COMPRESSED("abort() called", "abort() called")
+MP_MATCH_COMPRESSED("address %08x is not aligned to %d bytes", "\377address %08x\313\207aligned\214\231\376")
+MP_MATCH_COMPRESSED("annotation must be an identifier", "\377annotation\210\225\263\262")
+MP_MATCH_COMPRESSED("arg is an empty sequence", "\377\227\313\263\232\301")
+MP_MATCH_COMPRESSED("arg must be user-type", "\377\227\210\225user-type")
+MP_MATCH_COMPRESSED("argument name reused", "\377\204\270reused")
+MP_MATCH_COMPRESSED("argument num/types mismatch", "\377\204num/types mismatch")
+MP_MATCH_COMPRESSED("argument should be a '%q' not a '%q'", "\377\204\323\225\237\201\207\237\201")
+MP_MATCH_COMPRESSED("array/bytes required on right side", "\377array/bytes\223on right side")
+MP_MATCH_COMPRESSED("async for/with outside async function", "\377\374for/with\243\374\205")
+MP_MATCH_COMPRESSED("attributes not supported", "\377attributes\207\271")
+MP_MATCH_COMPRESSED("bad compile mode", "bad compile mode")
+MP_MATCH_COMPRESSED("bad typecode", "bad typecode")
+MP_MATCH_COMPRESSED("binary op %q not implemented", "\377\364op\310\207\233")
+MP_MATCH_COMPRESSED("bits must be 32 or less", "\377bits\210\22532\315less")
+MP_MATCH_COMPRESSED("buffer too small", "\377\317\272small")
+MP_MATCH_COMPRESSED("bytecode overflow", "\377bytecode\247")
+MP_MATCH_COMPRESSED("bytes value out of range", "\377\376\303\305\222\260")
+MP_MATCH_COMPRESSED("call super().__init__() first", "call super().__init__() first")
+MP_MATCH_COMPRESSED("can't add special method to already-subclassed class", "\377\200add special method\214already-subclassed\332")
+MP_MATCH_COMPRESSED("can't assign to expression", "\377\200assign\214\337")
+MP_MATCH_COMPRESSED("can't cancel self", "\377\200cancel\353")
+MP_MATCH_COMPRESSED("can't cast '%q' to '%q'", "\377\200cast\201\214\201")
+MP_MATCH_COMPRESSED("can't convert %s to complex", "\377\200\212\330\214\242")
+MP_MATCH_COMPRESSED("can't convert %s to float", "\377\200\212\330\214float")
+MP_MATCH_COMPRESSED("can't convert %s to int", "\377\200\212\330\214\255")
+MP_MATCH_COMPRESSED("can't convert '%q' object to %q implicitly", "\377\200\212\201\202\214\310\340")
+MP_MATCH_COMPRESSED("can't convert NaN to int", "\377\200\212NaN\214\255")
+MP_MATCH_COMPRESSED("can't convert inf to int", "\377\200\212inf\214\255")
+MP_MATCH_COMPRESSED("can't convert negative int to unsigned", "\377\200\212\277\255\214unsigned")
+MP_MATCH_COMPRESSED("can't create '%q' instances", "\377\200create\201instances")
+MP_MATCH_COMPRESSED("can't declare nonlocal in outer code", "\377\200declare\300\241outer\311")
+MP_MATCH_COMPRESSED("can't delete expression", "\377\200delete\337")
+MP_MATCH_COMPRESSED("can't do binary op between '%q' and '%q'", "\377\200do\364op between\201\331\201")
+MP_MATCH_COMPRESSED("can't do unary op of '%q'", "\377\200do unary op\222\201")
+MP_MATCH_COMPRESSED("can't implicitly convert '%q' to 'bool'", "\377\200\340\212\201\214'bool'")
+MP_MATCH_COMPRESSED("can't import name %q", "\377\200\320\270\310")
+MP_MATCH_COMPRESSED("can't load from '%q'", "\377\200load\250\201")
+MP_MATCH_COMPRESSED("can't load with '%q' index", "\377\200load\236\201\226")
+MP_MATCH_COMPRESSED("can't perform relative import", "\377\200perform relative\320")
+MP_MATCH_COMPRESSED("can't send non-None value to a just-started generator", "\377\200send non-None\303\214\237just-started\244")
+MP_MATCH_COMPRESSED("can't set attribute", "\377\200\361\220")
+MP_MATCH_COMPRESSED("can't store '%q'", "\377\200\335\201")
+MP_MATCH_COMPRESSED("can't store to '%q'", "\377\200\335\214\201")
+MP_MATCH_COMPRESSED("can't store with '%q' index", "\377\200\335\236\201\226")
+MP_MATCH_COMPRESSED("can't switch from automatic field numbering to manual field specification", "\377\200\372\250\345\273\350\214\367\273\324")
+MP_MATCH_COMPRESSED("can't switch from manual field specification to automatic field numbering", "\377\200\372\250\367\273\324\214\345\273\350")
+MP_MATCH_COMPRESSED("can't truncate-divide a complex number", "\377\200truncate-divide\237\242\322")
+MP_MATCH_COMPRESSED("can't unambiguously get sizeof scalar", "\377\200unambiguously get sizeof scalar")
+MP_MATCH_COMPRESSED("can't wait", "\377\200wait")
+MP_MATCH_COMPRESSED("cannot emit native code for this architecture", "\377cannot emit\264\311\221this architecture")
+MP_MATCH_COMPRESSED("casting", "casting")
+MP_MATCH_COMPRESSED("char not in range(0x110000)", "\377char\207\241range(0x110000)")
+MP_MATCH_COMPRESSED("comparison of int and uint", "\377comparison\222\255\331uint")
+MP_MATCH_COMPRESSED("complex divide by zero", "\377\242\365by\316")
+MP_MATCH_COMPRESSED("conversion to object", "\377\261\214\202")
+MP_MATCH_COMPRESSED("default 'except' must be last", "\377\355'except'\210\225last")
+MP_MATCH_COMPRESSED("dict update sequence has wrong length", "\377\312update\301\254wrong\245")
+MP_MATCH_COMPRESSED("div/mod not implemented for uint", "\377div/mod\207\233\221uint")
+MP_MATCH_COMPRESSED("divide by zero", "\377\365by\316")
+MP_MATCH_COMPRESSED("empty", "\377\232")
+MP_MATCH_COMPRESSED("empty heap", "\377\232\346")
+MP_MATCH_COMPRESSED("empty separator", "\377\232separator")
+MP_MATCH_COMPRESSED("encoding not supported: %q", "\377\354\207supported:\310")
+MP_MATCH_COMPRESSED("end of format while looking for conversion specifier", "\377end\222\203while looking\221\261\216")
+MP_MATCH_COMPRESSED("error in regex", "\377\253\241regex")
+MP_MATCH_COMPRESSED("exceptions must derive from BaseException", "\377exceptions\210derive\250BaseException")
+MP_MATCH_COMPRESSED("expected ':' after format specifier", "\377\246':'\251\203\216")
+MP_MATCH_COMPRESSED("expecting a dict for keyword args", "\377\267\237\312\221\213\344")
+MP_MATCH_COMPRESSED("expecting just a value for set", "\377\267just\237\303\221\361")
+MP_MATCH_COMPRESSED("expecting key:value for dict", "\377\267key:value\221\312")
+MP_MATCH_COMPRESSED("extra keyword arguments given", "\377\377\213\206\274")
+MP_MATCH_COMPRESSED("extra positional arguments given", "\377\377\211\206\274")
+MP_MATCH_COMPRESSED("format", "\377\203")
+MP_MATCH_COMPRESSED("format needs a dict", "\377\203\276\237\312")
+MP_MATCH_COMPRESSED("format string didn't convert all arguments", "\377\203\217didn't\212all\206")
+MP_MATCH_COMPRESSED("format string needs more arguments", "\377\203\217\276more\206")
+MP_MATCH_COMPRESSED("full", "full")
+MP_MATCH_COMPRESSED("function doesn't take keyword arguments", "\377\205\252take\213\206")
+MP_MATCH_COMPRESSED("function expected at most %d arguments, got %d", "\377\205\246\375most\231arguments,\356\231")
+MP_MATCH_COMPRESSED("function got multiple values for argument '%q'", "\377\205\356\275\325\221\204\201")
+MP_MATCH_COMPRESSED("function missing %d required positional arguments", "\377\205\256\231\223\211\206")
+MP_MATCH_COMPRESSED("function missing keyword-only argument", "\377\205\256keyword-only\204")
+MP_MATCH_COMPRESSED("function missing required keyword argument '%q'", "\377\205\256\223\213\204\201")
+MP_MATCH_COMPRESSED("function missing required positional argument #%d", "\377\205\256\223\211\204#%d")
+MP_MATCH_COMPRESSED("function takes %d positional arguments but %d were given", "\377\205\336\231\211\206\266\231were\274")
+MP_MATCH_COMPRESSED("generator already executing", "\377\244already executing")
+MP_MATCH_COMPRESSED("generator ignored GeneratorExit", "\377\244ignored GeneratorExit")
+MP_MATCH_COMPRESSED("generator raised StopIteration", "\377\244raised StopIteration")
+MP_MATCH_COMPRESSED("hash is final", "\377hash\313final")
+MP_MATCH_COMPRESSED("heap must be a list", "\377\346\210\225\237\314")
+MP_MATCH_COMPRESSED("identifier redefined as global", "\377\262\352as global")
+MP_MATCH_COMPRESSED("identifier redefined as nonlocal", "\377\262\352as\300")
+MP_MATCH_COMPRESSED("import * not at module level", "\377\320*\207\375\321level")
+MP_MATCH_COMPRESSED("incompatible .mpy arch", "\377\326\343arch")
+MP_MATCH_COMPRESSED("incompatible .mpy file", "\377\326\343file")
+MP_MATCH_COMPRESSED("incomplete format", "\377\341\203")
+MP_MATCH_COMPRESSED("incomplete format key", "\377\341\203key")
+MP_MATCH_COMPRESSED("incorrect padding", "incorrect padding")
+MP_MATCH_COMPRESSED("int() arg 2 must be >= 2 and <= 36", "\377int()\2272\210\225>= 2\331<= 36")
+MP_MATCH_COMPRESSED("integer needed", "\377\360needed")
+MP_MATCH_COMPRESSED("invalid format", "\377\230\203")
+MP_MATCH_COMPRESSED("invalid format specifier", "\377\230\203\216")
+MP_MATCH_COMPRESSED("invalid micropython decorator", "\377\230micropython decorator")
+MP_MATCH_COMPRESSED("invalid mktime usage", "\377\230\370usage")
+MP_MATCH_COMPRESSED("invalid syntax", "\377\230\265")
+MP_MATCH_COMPRESSED("invalid syntax for number", "\377\230\265\221\322")
+MP_MATCH_COMPRESSED("issubclass() arg 1 must be a class", "\377\327\2271\210\225\237\332")
+MP_MATCH_COMPRESSED("issubclass() arg 2 must be a class or a tuple of classes", "\377\327\2272\210\225\237\332\315\237\302\222classes")
+MP_MATCH_COMPRESSED("join expects a list of str/bytes objects consistent with self object", "\377join expects\237\314\222str/bytes objects consistent\236\353\202")
+MP_MATCH_COMPRESSED("keyword argument(s) not implemented - use normal args instead", "\377\213argument(s)\207\233- use normal\344instead")
+MP_MATCH_COMPRESSED("lhs and rhs should be compatible", "\377lhs\331rhs\323\225compatible")
+MP_MATCH_COMPRESSED("local '%q' has type '%q' but source is '%q'", "\377\334\201\254\224\201\266source\313\201")
+MP_MATCH_COMPRESSED("local '%q' used before type known", "\377\334\201used\363\224known")
+MP_MATCH_COMPRESSED("local variable referenced before assignment", "\377\334variable referenced\363\240")
+MP_MATCH_COMPRESSED("malformed f-string", "malformed f-string")
+MP_MATCH_COMPRESSED("math domain error", "\377math domain\253")
+MP_MATCH_COMPRESSED("memory allocation failed, heap is locked", "\377memory allocation failed,\346\313locked")
+MP_MATCH_COMPRESSED("memoryview offset too large", "\377memoryview offset\272large")
+MP_MATCH_COMPRESSED("mktime needs a tuple of length 8 or 9", "\377\370\276\237\302\222\2458\3159")
+MP_MATCH_COMPRESSED("module '%q' has no attribute '%q'", "\377\321\201\254\257\220\201")
+MP_MATCH_COMPRESSED("multiple *x in assignment", "\377\275*x\241\240")
+MP_MATCH_COMPRESSED("multiple bases have instance lay-out conflict", "\377\275bases have instance lay-out conflict")
+MP_MATCH_COMPRESSED("must raise an object", "\377\210raise\263\202")
+MP_MATCH_COMPRESSED("must use keyword argument for key function", "\377\210use\213\204\221key\205")
+MP_MATCH_COMPRESSED("name '%q' isn't defined", "\377\270\201\234defined")
+MP_MATCH_COMPRESSED("name too long", "\377\270\272long")
+MP_MATCH_COMPRESSED("native code in .mpy unsupported", "\377\264\311\241\343\235")
+MP_MATCH_COMPRESSED("native raise", "\377\264raise")
+MP_MATCH_COMPRESSED("native yield", "\377\264yield")
+MP_MATCH_COMPRESSED("need more than %d values to unpack", "\377need more than\231\325\214\373")
+MP_MATCH_COMPRESSED("negative factorial", "\377\277factorial")
+MP_MATCH_COMPRESSED("negative shift count", "\377\277shift count")
+MP_MATCH_COMPRESSED("no active exception to reraise", "\377\257active exception\214reraise")
+MP_MATCH_COMPRESSED("no binding for nonlocal found", "\377\257binding\221\300\333")
+MP_MATCH_COMPRESSED("no module named '%q'", "\377\257\321named\201")
+MP_MATCH_COMPRESSED("no such attribute", "\377\257such\220")
+MP_MATCH_COMPRESSED("non-default argument follows default argument", "\377non-default\204follows\355\204")
+MP_MATCH_COMPRESSED("non-hex digit", "non-hex digit")
+MP_MATCH_COMPRESSED("not a constant", "\377\207\237constant")
+MP_MATCH_COMPRESSED("object '%s' isn't a tuple or list", "\377\202\215\234\237\302\315\314")
+MP_MATCH_COMPRESSED("object not in sequence", "\377\202\207\241\301")
+MP_MATCH_COMPRESSED("object of type '%s' has no len()", "\377\202\222\224\215\254\257len()")
+MP_MATCH_COMPRESSED("object with buffer protocol required", "\377\202\236\317protocol\223")
+MP_MATCH_COMPRESSED("only slices with step=1 (aka None) are supported", "\377only slices\236step=1 (aka None) are\271")
+MP_MATCH_COMPRESSED("opcode", "opcode")
+MP_MATCH_COMPRESSED("ord() expected a character, but string of length %d found", "\377ord()\246\237character,\266\217\222\245\231\333")
+MP_MATCH_COMPRESSED("overflow converting long int to machine word", "\377\247converting long\255\214machine word")
+MP_MATCH_COMPRESSED("pop from an empty set", "\377pop\250\263\232\361")
+MP_MATCH_COMPRESSED("pop from empty list", "\377pop\250\232\314")
+MP_MATCH_COMPRESSED("popitem(): dictionary is empty", "\377popitem(): dictionary\313\232")
+MP_MATCH_COMPRESSED("positional arg after **", "\377\211\227\251**")
+MP_MATCH_COMPRESSED("positional arg after keyword arg", "\377\211\227\251\213\227")
+MP_MATCH_COMPRESSED("pow() with 3 arguments requires integers", "\377pow()\2363\206requires integers")
+MP_MATCH_COMPRESSED("regex too complex", "\377regex\272\242")
+MP_MATCH_COMPRESSED("requested length %d but object has length %d", "\377requested\245\231\266\202\254\245\231")
+MP_MATCH_COMPRESSED("return expected '%q' but got '%q'", "\377\371\246\201\266\356\201")
+MP_MATCH_COMPRESSED("rsplit(None,n)", "rsplit(None,n)")
+MP_MATCH_COMPRESSED("schedule queue full", "schedule queue full")
+MP_MATCH_COMPRESSED("sign not allowed in string format specifier", "\377sign\207\304\241\217\203\216")
+MP_MATCH_COMPRESSED("sign not allowed with integer format specifier 'c'", "\377sign\207\304\236\360\203\216'c'")
+MP_MATCH_COMPRESSED("single '}' encountered in format string", "\377single '}' encountered\241\203\217")
+MP_MATCH_COMPRESSED("slice step can't be zero", "\377slice step\200\225\316")
+MP_MATCH_COMPRESSED("splitting with sub-captures", "\377splitting\236sub-captures")
+MP_MATCH_COMPRESSED("stream operation not supported", "\377stream\351\207\271")
+MP_MATCH_COMPRESSED("string argument without an encoding", "\377\217\204without\263\354")
+MP_MATCH_COMPRESSED("string index out of range", "\377\217\226\305\222\260")
+MP_MATCH_COMPRESSED("string indices must be integers, not %s", "\377\217\357\210\225\347\207\330")
+MP_MATCH_COMPRESSED("struct: can't index", "\377\306\200\226")
+MP_MATCH_COMPRESSED("struct: index out of range", "\377\306\226\305\222\260")
+MP_MATCH_COMPRESSED("struct: no fields", "\377\306\257fields")
+MP_MATCH_COMPRESSED("substring not found", "\377substring\207\333")
+MP_MATCH_COMPRESSED("super() can't find self", "\377super()\200find\353")
+MP_MATCH_COMPRESSED("syntax error in JSON", "\377\265\253\241JSON")
+MP_MATCH_COMPRESSED("syntax error in uctypes descriptor", "\377\265\253\241uctypes descriptor")
+MP_MATCH_COMPRESSED("ticks interval overflow", "\377ticks interval\247")
+MP_MATCH_COMPRESSED("too many args", "\377\272many\344")
+MP_MATCH_COMPRESSED("too many values to unpack (expected %d)", "\377\272many\325\214\373(expected %d)")
+MP_MATCH_COMPRESSED("tuple index out of range", "\377\302\226\305\222\260")
+MP_MATCH_COMPRESSED("type '%q' isn't an acceptable base type", "\377\224\201\234\263acceptable base\224")
+MP_MATCH_COMPRESSED("type object '%q' has no attribute '%q'", "\377\224\202\201\254\257\220\201")
+MP_MATCH_COMPRESSED("type takes 1 or 3 arguments", "\377\224\3361\3153\206")
+MP_MATCH_COMPRESSED("unexpected indent", "\377\342\366")
+MP_MATCH_COMPRESSED("unexpected keyword argument '%q'", "\377\342\213\204\201")
+MP_MATCH_COMPRESSED("unicode name escapes", "\377unicode\270escapes")
+MP_MATCH_COMPRESSED("unindent doesn't match any outer indent level", "\377unindent\252match any outer\366level")
+MP_MATCH_COMPRESSED("unknown conversion specifier %c", "\377\307\261\216%c")
+MP_MATCH_COMPRESSED("unknown format code '%c' for object of type '%s'", "\377\307\203\311'%c'\221\202\222\224\215")
+MP_MATCH_COMPRESSED("unknown type '%q'", "\377\307\224\201")
+MP_MATCH_COMPRESSED("unmatched '{' in format", "\377unmatched '{'\241\203")
+MP_MATCH_COMPRESSED("unreadable attribute", "\377unreadable\220")
+MP_MATCH_COMPRESSED("unsupported format character '%c' (0x%x) at index %d", "\377\235\203character '%c' (0x%x)\375\226\231")
+MP_MATCH_COMPRESSED("unsupported type for %q: '%s'", "\377\235\224\221%q:\215")
+MP_MATCH_COMPRESSED("unsupported types for %q: '%s', '%s'", "\377\235types\221%q: '%s',\215")
+MP_MATCH_COMPRESSED("value would overflow a %d byte buffer", "\377\303would\247\237\231byte\317")
+MP_MATCH_COMPRESSED("wbits", "wbits")
+MP_MATCH_COMPRESSED("wrong number of arguments", "\377wrong\322\222\206")
+MP_MATCH_COMPRESSED("zero step", "\377\316step")
+// Total input length:      6684
+// Total compressed length: 3129
+// Total data length:       1145
+// Predicted saving:        2410
+
+// gzip length:             3725
+// Percentage of gzip:      114.7%
+// zlib length:             3713
+// Percentage of zlib:      115.1%
@@ -0,0 +1,735 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF0(MP_QSTRnull, 0, 0, "")
+QDEF0(MP_QSTR_, 4794, 0, "")
+QDEF0(MP_QSTR___dir__, 33862, 7, "__dir__")
+QDEF0(MP_QSTR__0x0a_, 11028, 1, "\x0a")
+QDEF0(MP_QSTR__space_, 14134, 1, " ")
+QDEF0(MP_QSTR__star_, 19838, 1, "*")
+QDEF0(MP_QSTR__slash_, 44641, 1, "/")
+QDEF0(MP_QSTR__lt_module_gt_, 64246, 8, "<module>")
+QDEF0(MP_QSTR__, 33877, 1, "_")
+QDEF0(MP_QSTR___call__, 27023, 8, "__call__")
+QDEF0(MP_QSTR___class__, 49688, 9, "__class__")
+QDEF0(MP_QSTR___delitem__, 39125, 11, "__delitem__")
+QDEF0(MP_QSTR___enter__, 53194, 9, "__enter__")
+QDEF0(MP_QSTR___exit__, 462, 8, "__exit__")
+QDEF0(MP_QSTR___getattr__, 43633, 11, "__getattr__")
+QDEF0(MP_QSTR___getitem__, 4336, 11, "__getitem__")
+QDEF0(MP_QSTR___hash__, 62746, 8, "__hash__")
+QDEF0(MP_QSTR___init__, 50439, 8, "__init__")
+QDEF0(MP_QSTR___int__, 57751, 7, "__int__")
+QDEF0(MP_QSTR___iter__, 47376, 8, "__iter__")
+QDEF0(MP_QSTR___len__, 38603, 7, "__len__")
+QDEF0(MP_QSTR___main__, 65289, 8, "__main__")
+QDEF0(MP_QSTR___module__, 44726, 10, "__module__")
+QDEF0(MP_QSTR___name__, 17163, 8, "__name__")
+QDEF0(MP_QSTR___new__, 22326, 7, "__new__")
+QDEF0(MP_QSTR___next__, 34568, 8, "__next__")
+QDEF0(MP_QSTR___qualname__, 28805, 12, "__qualname__")
+QDEF0(MP_QSTR___repr__, 18909, 8, "__repr__")
+QDEF0(MP_QSTR___setitem__, 38373, 11, "__setitem__")
+QDEF0(MP_QSTR___str__, 44321, 7, "__str__")
+QDEF0(MP_QSTR_ArithmeticError, 10028, 15, "ArithmeticError")
+QDEF0(MP_QSTR_AssertionError, 50414, 14, "AssertionError")
+QDEF0(MP_QSTR_AttributeError, 19388, 14, "AttributeError")
+QDEF0(MP_QSTR_BaseException, 14592, 13, "BaseException")
+QDEF0(MP_QSTR_EOFError, 11613, 8, "EOFError")
+QDEF0(MP_QSTR_Ellipsis, 49254, 8, "Ellipsis")
+QDEF0(MP_QSTR_Exception, 63539, 9, "Exception")
+QDEF0(MP_QSTR_GeneratorExit, 13766, 13, "GeneratorExit")
+QDEF0(MP_QSTR_ImportError, 41260, 11, "ImportError")
+QDEF0(MP_QSTR_IndentationError, 32009, 16, "IndentationError")
+QDEF0(MP_QSTR_IndexError, 52330, 10, "IndexError")
+QDEF0(MP_QSTR_KeyError, 45278, 8, "KeyError")
+QDEF0(MP_QSTR_KeyboardInterrupt, 32294, 17, "KeyboardInterrupt")
+QDEF0(MP_QSTR_LookupError, 48036, 11, "LookupError")
+QDEF0(MP_QSTR_MemoryError, 58887, 11, "MemoryError")
+QDEF0(MP_QSTR_NameError, 41443, 9, "NameError")
+QDEF0(MP_QSTR_NoneType, 24583, 8, "NoneType")
+QDEF0(MP_QSTR_NotImplementedError, 49481, 19, "NotImplementedError")
+QDEF0(MP_QSTR_OSError, 47292, 7, "OSError")
+QDEF0(MP_QSTR_OverflowError, 63930, 13, "OverflowError")
+QDEF0(MP_QSTR_RuntimeError, 40943, 12, "RuntimeError")
+QDEF0(MP_QSTR_StopIteration, 27032, 13, "StopIteration")
+QDEF0(MP_QSTR_SyntaxError, 27507, 11, "SyntaxError")
+QDEF0(MP_QSTR_SystemExit, 23024, 10, "SystemExit")
+QDEF0(MP_QSTR_TypeError, 11512, 9, "TypeError")
+QDEF0(MP_QSTR_ValueError, 36053, 10, "ValueError")
+QDEF0(MP_QSTR_ZeroDivisionError, 40057, 17, "ZeroDivisionError")
+QDEF0(MP_QSTR_abs, 7710, 3, "abs")
+QDEF0(MP_QSTR_all, 58877, 3, "all")
+QDEF0(MP_QSTR_any, 44535, 3, "any")
+QDEF0(MP_QSTR_append, 56122, 6, "append")
+QDEF0(MP_QSTR_args, 52917, 4, "args")
+QDEF0(MP_QSTR_bool, 47855, 4, "bool")
+QDEF0(MP_QSTR_builtins, 32697, 8, "builtins")
+QDEF0(MP_QSTR_bytearray, 54543, 9, "bytearray")
+QDEF0(MP_QSTR_bytecode, 22794, 8, "bytecode")
+QDEF0(MP_QSTR_bytes, 38450, 5, "bytes")
+QDEF0(MP_QSTR_callable, 31739, 8, "callable")
+QDEF0(MP_QSTR_chr, 6660, 3, "chr")
+QDEF0(MP_QSTR_classmethod, 6737, 11, "classmethod")
+QDEF0(MP_QSTR_clear, 21292, 5, "clear")
+QDEF0(MP_QSTR_close, 23522, 5, "close")
+QDEF0(MP_QSTR_const, 40761, 5, "const")
+QDEF0(MP_QSTR_copy, 34072, 4, "copy")
+QDEF0(MP_QSTR_count, 30877, 5, "count")
+QDEF0(MP_QSTR_dict, 53089, 4, "dict")
+QDEF0(MP_QSTR_dir, 1139, 3, "dir")
+QDEF0(MP_QSTR_divmod, 11961, 6, "divmod")
+QDEF0(MP_QSTR_end, 48014, 3, "end")
+QDEF0(MP_QSTR_endswith, 64693, 8, "endswith")
+QDEF0(MP_QSTR_eval, 36273, 4, "eval")
+QDEF0(MP_QSTR_exec, 29848, 4, "exec")
+QDEF0(MP_QSTR_extend, 56181, 6, "extend")
+QDEF0(MP_QSTR_find, 14991, 4, "find")
+QDEF0(MP_QSTR_format, 6160, 6, "format")
+QDEF0(MP_QSTR_from_bytes, 4277, 10, "from_bytes")
+QDEF0(MP_QSTR_get, 55911, 3, "get")
+QDEF0(MP_QSTR_getattr, 7291, 7, "getattr")
+QDEF0(MP_QSTR_globals, 16762, 7, "globals")
+QDEF0(MP_QSTR_hasattr, 11193, 7, "hasattr")
+QDEF0(MP_QSTR_hash, 21917, 4, "hash")
+QDEF0(MP_QSTR_id, 30310, 2, "id")
+QDEF0(MP_QSTR_index, 34988, 5, "index")
+QDEF0(MP_QSTR_insert, 33271, 6, "insert")
+QDEF0(MP_QSTR_int, 37600, 3, "int")
+QDEF0(MP_QSTR_isalpha, 16007, 7, "isalpha")
+QDEF0(MP_QSTR_isdigit, 14497, 7, "isdigit")
+QDEF0(MP_QSTR_isinstance, 19574, 10, "isinstance")
+QDEF0(MP_QSTR_islower, 3181, 7, "islower")
+QDEF0(MP_QSTR_isspace, 346, 7, "isspace")
+QDEF0(MP_QSTR_issubclass, 29291, 10, "issubclass")
+QDEF0(MP_QSTR_isupper, 13648, 7, "isupper")
+QDEF0(MP_QSTR_items, 9962, 5, "items")
+QDEF0(MP_QSTR_iter, 11395, 4, "iter")
+QDEF0(MP_QSTR_join, 39686, 4, "join")
+QDEF0(MP_QSTR_key, 29162, 3, "key")
+QDEF0(MP_QSTR_keys, 56396, 4, "keys")
+QDEF0(MP_QSTR_len, 55172, 3, "len")
+QDEF0(MP_QSTR_list, 9228, 4, "list")
+QDEF0(MP_QSTR_little, 48683, 6, "little")
+QDEF0(MP_QSTR_locals, 63457, 6, "locals")
+QDEF0(MP_QSTR_lower, 47101, 5, "lower")
+QDEF0(MP_QSTR_lstrip, 43608, 6, "lstrip")
+QDEF0(MP_QSTR_main, 29981, 4, "main")
+QDEF0(MP_QSTR_map, 42586, 3, "map")
+QDEF0(MP_QSTR_micropython, 6165, 11, "micropython")
+QDEF0(MP_QSTR_next, 46275, 4, "next")
+QDEF0(MP_QSTR_object, 59085, 6, "object")
+QDEF0(MP_QSTR_open, 36882, 4, "open")
+QDEF0(MP_QSTR_ord, 44793, 3, "ord")
+QDEF0(MP_QSTR_pop, 1912, 3, "pop")
+QDEF0(MP_QSTR_popitem, 40131, 7, "popitem")
+QDEF0(MP_QSTR_pow, 62482, 3, "pow")
+QDEF0(MP_QSTR_print, 13711, 5, "print")
+QDEF0(MP_QSTR_range, 44493, 5, "range")
+QDEF0(MP_QSTR_read, 45494, 4, "read")
+QDEF0(MP_QSTR_readinto, 6916, 8, "readinto")
+QDEF0(MP_QSTR_readline, 58885, 8, "readline")
+QDEF0(MP_QSTR_remove, 33171, 6, "remove")
+QDEF0(MP_QSTR_replace, 41890, 7, "replace")
+QDEF0(MP_QSTR_repr, 254, 4, "repr")
+QDEF0(MP_QSTR_reverse, 8240, 7, "reverse")
+QDEF0(MP_QSTR_rfind, 10196, 5, "rfind")
+QDEF0(MP_QSTR_rindex, 58276, 6, "rindex")
+QDEF0(MP_QSTR_round, 43642, 5, "round")
+QDEF0(MP_QSTR_rsplit, 32821, 6, "rsplit")
+QDEF0(MP_QSTR_rstrip, 60906, 6, "rstrip")
+QDEF0(MP_QSTR_self, 64058, 4, "self")
+QDEF0(MP_QSTR_send, 18757, 4, "send")
+QDEF0(MP_QSTR_sep, 28226, 3, "sep")
+QDEF0(MP_QSTR_set, 22453, 3, "set")
+QDEF0(MP_QSTR_setattr, 15620, 7, "setattr")
+QDEF0(MP_QSTR_setdefault, 13803, 10, "setdefault")
+QDEF0(MP_QSTR_sort, 3752, 4, "sort")
+QDEF0(MP_QSTR_sorted, 29649, 6, "sorted")
+QDEF0(MP_QSTR_split, 65088, 5, "split")
+QDEF0(MP_QSTR_start, 18977, 5, "start")
+QDEF0(MP_QSTR_startswith, 12280, 10, "startswith")
+QDEF0(MP_QSTR_staticmethod, 25867, 12, "staticmethod")
+QDEF0(MP_QSTR_step, 37628, 4, "step")
+QDEF0(MP_QSTR_stop, 18098, 4, "stop")
+QDEF0(MP_QSTR_str, 58013, 3, "str")
+QDEF0(MP_QSTR_strip, 57500, 5, "strip")
+QDEF0(MP_QSTR_sum, 49902, 3, "sum")
+QDEF0(MP_QSTR_super, 44135, 5, "super")
+QDEF0(MP_QSTR_throw, 35583, 5, "throw")
+QDEF0(MP_QSTR_to_bytes, 53504, 8, "to_bytes")
+QDEF0(MP_QSTR_tuple, 37940, 5, "tuple")
+QDEF0(MP_QSTR_type, 82, 4, "type")
+QDEF0(MP_QSTR_update, 46430, 6, "update")
+QDEF0(MP_QSTR_upper, 692, 5, "upper")
+QDEF0(MP_QSTR_utf_hyphen_8, 63158, 5, "utf-8")
+QDEF0(MP_QSTR_value, 21055, 5, "value")
+QDEF0(MP_QSTR_values, 12832, 6, "values")
+QDEF0(MP_QSTR_write, 8274, 5, "write")
+QDEF0(MP_QSTR_zip, 18696, 3, "zip")
+QDEF1(MP_QSTR__percent__hash_o, 55071, 3, "%#o")
+QDEF1(MP_QSTR__percent__hash_x, 23918, 3, "%#x")
+QDEF1(MP_QSTR__dot__dot__dot__space_, 39555, 4, "... ")
+QDEF0(MP_QSTR__lt_dictcomp_gt_, 28239, 10, "<dictcomp>")
+QDEF0(MP_QSTR__lt_genexpr_gt_, 52423, 9, "<genexpr>")
+QDEF0(MP_QSTR__lt_lambda_gt_, 21300, 8, "<lambda>")
+QDEF0(MP_QSTR__lt_listcomp_gt_, 55889, 10, "<listcomp>")
+QDEF0(MP_QSTR__lt_setcomp_gt_, 48582, 9, "<setcomp>")
+QDEF1(MP_QSTR__lt_stdin_gt_, 7565, 7, "<stdin>")
+QDEF1(MP_QSTR__lt_string_gt_, 35764, 8, "<string>")
+QDEF1(MP_QSTR__gt__gt__gt__space_, 29677, 4, ">>> ")
+QDEF1(MP_QSTR_AF_INET, 7124, 7, "AF_INET")
+QDEF1(MP_QSTR_AF_INET6, 63502, 8, "AF_INET6")
+QDEF1(MP_QSTR_AF_UNIX, 57699, 7, "AF_UNIX")
+QDEF1(MP_QSTR_ARRAY, 28994, 5, "ARRAY")
+QDEF1(MP_QSTR_AUTO, 13918, 4, "AUTO")
+QDEF1(MP_QSTR_B1000000, 6625, 8, "B1000000")
+QDEF1(MP_QSTR_B115200, 4124, 7, "B115200")
+QDEF1(MP_QSTR_B1152000, 42646, 8, "B1152000")
+QDEF1(MP_QSTR_B230400, 59937, 7, "B230400")
+QDEF1(MP_QSTR_B460800, 8678, 7, "B460800")
+QDEF1(MP_QSTR_B500000, 14085, 7, "B500000")
+QDEF1(MP_QSTR_B57600, 25104, 6, "B57600")
+QDEF1(MP_QSTR_B576000, 63064, 7, "B576000")
+QDEF1(MP_QSTR_B921600, 4143, 7, "B921600")
+QDEF1(MP_QSTR_B9600, 25635, 5, "B9600")
+QDEF1(MP_QSTR_BFINT16, 27195, 7, "BFINT16")
+QDEF1(MP_QSTR_BFINT32, 12206, 7, "BFINT32")
+QDEF1(MP_QSTR_BFINT8, 22788, 6, "BFINT8")
+QDEF1(MP_QSTR_BFUINT16, 10419, 8, "BFUINT16")
+QDEF1(MP_QSTR_BFUINT32, 45661, 8, "BFUINT32")
+QDEF1(MP_QSTR_BFUINT8, 8919, 7, "BFUINT8")
+QDEF1(MP_QSTR_BF_LEN, 47226, 6, "BF_LEN")
+QDEF1(MP_QSTR_BF_POS, 36828, 6, "BF_POS")
+QDEF1(MP_QSTR_BIG_ENDIAN, 19290, 10, "BIG_ENDIAN")
+QDEF1(MP_QSTR_BytesIO, 1572, 7, "BytesIO")
+QDEF1(MP_QSTR_CancelledError, 37154, 14, "CancelledError")
+QDEF1(MP_QSTR_DeflateIO, 2858, 9, "DeflateIO")
+QDEF1(MP_QSTR_EACCES, 41018, 6, "EACCES")
+QDEF1(MP_QSTR_EADDRINUSE, 27067, 10, "EADDRINUSE")
+QDEF1(MP_QSTR_EAGAIN, 51399, 6, "EAGAIN")
+QDEF1(MP_QSTR_EALREADY, 44712, 8, "EALREADY")
+QDEF1(MP_QSTR_EBADF, 25137, 5, "EBADF")
+QDEF1(MP_QSTR_ECONNABORTED, 55540, 12, "ECONNABORTED")
+QDEF1(MP_QSTR_ECONNREFUSED, 10208, 12, "ECONNREFUSED")
+QDEF1(MP_QSTR_ECONNRESET, 6210, 10, "ECONNRESET")
+QDEF1(MP_QSTR_EEXIST, 6907, 6, "EEXIST")
+QDEF1(MP_QSTR_EHOSTUNREACH, 8714, 12, "EHOSTUNREACH")
+QDEF1(MP_QSTR_EINPROGRESS, 59901, 11, "EINPROGRESS")
+QDEF1(MP_QSTR_EINVAL, 30793, 6, "EINVAL")
+QDEF1(MP_QSTR_EIO, 45171, 3, "EIO")
+QDEF1(MP_QSTR_EISDIR, 29278, 6, "EISDIR")
+QDEF1(MP_QSTR_ENOBUFS, 38586, 7, "ENOBUFS")
+QDEF1(MP_QSTR_ENODEV, 41983, 6, "ENODEV")
+QDEF1(MP_QSTR_ENOENT, 3900, 6, "ENOENT")
+QDEF1(MP_QSTR_ENOMEM, 20373, 6, "ENOMEM")
+QDEF1(MP_QSTR_ENOTCONN, 47361, 8, "ENOTCONN")
+QDEF1(MP_QSTR_EOPNOTSUPP, 38222, 10, "EOPNOTSUPP")
+QDEF1(MP_QSTR_EPERM, 23928, 5, "EPERM")
+QDEF1(MP_QSTR_ETIMEDOUT, 35250, 9, "ETIMEDOUT")
+QDEF1(MP_QSTR_FLOAT32, 31957, 7, "FLOAT32")
+QDEF1(MP_QSTR_FLOAT64, 7466, 7, "FLOAT64")
+QDEF1(MP_QSTR_FileIO, 59434, 6, "FileIO")
+QDEF1(MP_QSTR_FrameBuffer, 5401, 11, "FrameBuffer")
+QDEF1(MP_QSTR_FrameBuffer1, 64771, 12, "FrameBuffer1")
+QDEF1(MP_QSTR_GS2_HMSB, 38999, 8, "GS2_HMSB")
+QDEF1(MP_QSTR_GS4_HMSB, 45545, 8, "GS4_HMSB")
+QDEF1(MP_QSTR_GS8, 12875, 3, "GS8")
+QDEF1(MP_QSTR_GZIP, 5677, 4, "GZIP")
+QDEF1(MP_QSTR_INT, 27844, 3, "INT")
+QDEF1(MP_QSTR_INT16, 23199, 5, "INT16")
+QDEF1(MP_QSTR_INT32, 328, 5, "INT32")
+QDEF1(MP_QSTR_INT64, 41815, 5, "INT64")
+QDEF1(MP_QSTR_INT8, 28045, 4, "INT8")
+QDEF1(MP_QSTR_IOBase, 41800, 6, "IOBase")
+QDEF1(MP_QSTR_IP_ADD_MEMBERSHIP, 42351, 17, "IP_ADD_MEMBERSHIP")
+QDEF1(MP_QSTR_IP_DROP_MEMBERSHIP, 2475, 18, "IP_DROP_MEMBERSHIP")
+QDEF1(MP_QSTR_LITTLE_ENDIAN, 33379, 13, "LITTLE_ENDIAN")
+QDEF1(MP_QSTR_LONG, 54501, 4, "LONG")
+QDEF1(MP_QSTR_LONGLONG, 2939, 8, "LONGLONG")
+QDEF1(MP_QSTR_LockType, 21689, 8, "LockType")
+QDEF1(MP_QSTR_MONO_HLSB, 52772, 9, "MONO_HLSB")
+QDEF1(MP_QSTR_MONO_HMSB, 19688, 9, "MONO_HMSB")
+QDEF1(MP_QSTR_MONO_VLSB, 48216, 9, "MONO_VLSB")
+QDEF1(MP_QSTR_MSG_DONTROUTE, 2702, 13, "MSG_DONTROUTE")
+QDEF1(MP_QSTR_MSG_DONTWAIT, 38994, 12, "MSG_DONTWAIT")
+QDEF1(MP_QSTR_MSG_PEEK, 40277, 8, "MSG_PEEK")
+QDEF1(MP_QSTR_MVLSB, 52560, 5, "MVLSB")
+QDEF1(MP_QSTR_NATIVE, 62269, 6, "NATIVE")
+QDEF1(MP_QSTR_None, 18820, 4, "None")
+QDEF1(MP_QSTR_NotImplemented, 41495, 14, "NotImplemented")
+QDEF1(MP_QSTR_OrderedDict, 51219, 11, "OrderedDict")
+QDEF1(MP_QSTR_POLLERR, 47453, 7, "POLLERR")
+QDEF1(MP_QSTR_POLLHUP, 25707, 7, "POLLHUP")
+QDEF1(MP_QSTR_POLLIN, 50006, 6, "POLLIN")
+QDEF1(MP_QSTR_POLLOUT, 30714, 7, "POLLOUT")
+QDEF1(MP_QSTR_PTR, 7789, 3, "PTR")
+QDEF1(MP_QSTR_PinBase, 20975, 7, "PinBase")
+QDEF1(MP_QSTR_RAW, 33633, 3, "RAW")
+QDEF1(MP_QSTR_RGB565, 32974, 6, "RGB565")
+QDEF1(MP_QSTR_RingIO, 43541, 6, "RingIO")
+QDEF1(MP_QSTR_SHORT, 18398, 5, "SHORT")
+QDEF1(MP_QSTR_SOCK_DGRAM, 19290, 10, "SOCK_DGRAM")
+QDEF1(MP_QSTR_SOCK_RAW, 41300, 8, "SOCK_RAW")
+QDEF1(MP_QSTR_SOCK_STREAM, 48126, 11, "SOCK_STREAM")
+QDEF1(MP_QSTR_SOL_SOCKET, 24064, 10, "SOL_SOCKET")
+QDEF1(MP_QSTR_SO_BROADCAST, 5869, 12, "SO_BROADCAST")
+QDEF1(MP_QSTR_SO_ERROR, 2795, 8, "SO_ERROR")
+QDEF1(MP_QSTR_SO_KEEPALIVE, 38283, 12, "SO_KEEPALIVE")
+QDEF1(MP_QSTR_SO_LINGER, 59686, 9, "SO_LINGER")
+QDEF1(MP_QSTR_SO_REUSEADDR, 64615, 12, "SO_REUSEADDR")
+QDEF1(MP_QSTR_Signal, 49577, 6, "Signal")
+QDEF1(MP_QSTR_StopAsyncIteration, 26618, 18, "StopAsyncIteration")
+QDEF1(MP_QSTR_StringIO, 27122, 8, "StringIO")
+QDEF1(MP_QSTR_TCSANOW, 23744, 7, "TCSANOW")
+QDEF1(MP_QSTR_Task, 60839, 4, "Task")
+QDEF1(MP_QSTR_TaskQueue, 61492, 9, "TaskQueue")
+QDEF1(MP_QSTR_TextIOWrapper, 57670, 13, "TextIOWrapper")
+QDEF1(MP_QSTR_UINT, 41792, 4, "UINT")
+QDEF1(MP_QSTR_UINT16, 36060, 6, "UINT16")
+QDEF1(MP_QSTR_UINT32, 12194, 6, "UINT32")
+QDEF1(MP_QSTR_UINT64, 9950, 6, "UINT64")
+QDEF1(MP_QSTR_UINT8, 34348, 5, "UINT8")
+QDEF1(MP_QSTR_ULONG, 56967, 5, "ULONG")
+QDEF1(MP_QSTR_ULONGLONG, 1298, 9, "ULONGLONG")
+QDEF1(MP_QSTR_USHORT, 15588, 6, "USHORT")
+QDEF1(MP_QSTR_UnicodeError, 32430, 12, "UnicodeError")
+QDEF1(MP_QSTR_VOID, 19170, 4, "VOID")
+QDEF1(MP_QSTR_VfsFat, 5117, 6, "VfsFat")
+QDEF1(MP_QSTR_VfsLfs1, 2502, 7, "VfsLfs1")
+QDEF1(MP_QSTR_VfsLfs2, 32352, 7, "VfsLfs2")
+QDEF1(MP_QSTR_VfsPosix, 45050, 8, "VfsPosix")
+QDEF1(MP_QSTR_VfsRom, 24458, 6, "VfsRom")
+QDEF1(MP_QSTR_ViperTypeError, 3010, 14, "ViperTypeError")
+QDEF1(MP_QSTR_ZLIB, 18796, 4, "ZLIB")
+QDEF0(MP_QSTR___abs__, 58485, 7, "__abs__")
+QDEF0(MP_QSTR___add__, 9427, 7, "__add__")
+QDEF1(MP_QSTR___aenter__, 35547, 10, "__aenter__")
+QDEF1(MP_QSTR___aexit__, 31121, 9, "__aexit__")
+QDEF1(MP_QSTR___aiter__, 45894, 9, "__aiter__")
+QDEF1(MP_QSTR___all__, 43208, 7, "__all__")
+QDEF0(MP_QSTR___and__, 38936, 7, "__and__")
+QDEF1(MP_QSTR___anext__, 36341, 9, "__anext__")
+QDEF1(MP_QSTR___bases__, 47191, 9, "__bases__")
+QDEF0(MP_QSTR___bool__, 26821, 8, "__bool__")
+QDEF1(MP_QSTR___build_class__, 20164, 15, "__build_class__")
+QDEF0(MP_QSTR___complex__, 63086, 11, "__complex__")
+QDEF0(MP_QSTR___contains__, 42569, 12, "__contains__")
+QDEF1(MP_QSTR___del__, 20706, 7, "__del__")
+QDEF1(MP_QSTR___delattr__, 11892, 11, "__delattr__")
+QDEF0(MP_QSTR___delete__, 33850, 10, "__delete__")
+QDEF1(MP_QSTR___dict__, 593, 8, "__dict__")
+QDEF0(MP_QSTR___divmod__, 6389, 10, "__divmod__")
+QDEF0(MP_QSTR___eq__, 32195, 6, "__eq__")
+QDEF1(MP_QSTR___file__, 15230, 8, "__file__")
+QDEF0(MP_QSTR___float__, 36716, 9, "__float__")
+QDEF0(MP_QSTR___floordiv__, 40949, 12, "__floordiv__")
+QDEF0(MP_QSTR___ge__, 25406, 6, "__ge__")
+QDEF0(MP_QSTR___get__, 55565, 7, "__get__")
+QDEF1(MP_QSTR___globals__, 23436, 11, "__globals__")
+QDEF0(MP_QSTR___gt__, 33297, 6, "__gt__")
+QDEF0(MP_QSTR___iadd__, 19248, 8, "__iadd__")
+QDEF1(MP_QSTR___import__, 14382, 10, "__import__")
+QDEF0(MP_QSTR___invert__, 6176, 10, "__invert__")
+QDEF0(MP_QSTR___isub__, 56628, 8, "__isub__")
+QDEF0(MP_QSTR___le__, 20967, 6, "__le__")
+QDEF0(MP_QSTR___lshift__, 42673, 10, "__lshift__")
+QDEF0(MP_QSTR___lt__, 39982, 6, "__lt__")
+QDEF0(MP_QSTR___matmul__, 31733, 10, "__matmul__")
+QDEF0(MP_QSTR___mod__, 53380, 7, "__mod__")
+QDEF0(MP_QSTR___mul__, 46079, 7, "__mul__")
+QDEF0(MP_QSTR___ne__, 18222, 6, "__ne__")
+QDEF0(MP_QSTR___neg__, 38733, 7, "__neg__")
+QDEF0(MP_QSTR___or__, 63843, 6, "__or__")
+QDEF1(MP_QSTR___path__, 25508, 8, "__path__")
+QDEF0(MP_QSTR___pos__, 12105, 7, "__pos__")
+QDEF0(MP_QSTR___pow__, 44347, 7, "__pow__")
+QDEF0(MP_QSTR___radd__, 11827, 8, "__radd__")
+QDEF0(MP_QSTR___rand__, 9861, 8, "__rand__")
+QDEF1(MP_QSTR___repl_print__, 42762, 14, "__repl_print__")
+QDEF1(MP_QSTR___reversed__, 16199, 12, "__reversed__")
+QDEF0(MP_QSTR___rfloordiv__, 34570, 13, "__rfloordiv__")
+QDEF0(MP_QSTR___rlshift__, 56224, 11, "__rlshift__")
+QDEF0(MP_QSTR___rmatmul__, 8427, 11, "__rmatmul__")
+QDEF0(MP_QSTR___rmod__, 63599, 8, "__rmod__")
+QDEF0(MP_QSTR___rmul__, 50219, 8, "__rmul__")
+QDEF0(MP_QSTR___ror__, 53903, 7, "__ror__")
+QDEF0(MP_QSTR___rpow__, 38161, 8, "__rpow__")
+QDEF0(MP_QSTR___rrshift__, 36459, 11, "__rrshift__")
+QDEF0(MP_QSTR___rshift__, 64349, 10, "__rshift__")
+QDEF0(MP_QSTR___rsub__, 33823, 8, "__rsub__")
+QDEF0(MP_QSTR___rtruediv__, 14764, 12, "__rtruediv__")
+QDEF0(MP_QSTR___rxor__, 13766, 8, "__rxor__")
+QDEF0(MP_QSTR___set__, 2606, 7, "__set__")
+QDEF1(MP_QSTR___set_name__, 24791, 12, "__set_name__")
+QDEF1(MP_QSTR___setattr__, 37812, 11, "__setattr__")
+QDEF0(MP_QSTR___sub__, 20222, 7, "__sub__")
+QDEF1(MP_QSTR___traceback__, 917, 13, "__traceback__")
+QDEF0(MP_QSTR___truediv__, 12203, 11, "__truediv__")
+QDEF0(MP_QSTR___xor__, 53028, 7, "__xor__")
+QDEF1(MP_QSTR__asyncio, 4729, 8, "_asyncio")
+QDEF1(MP_QSTR__build, 62225, 6, "_build")
+QDEF1(MP_QSTR__machine, 41744, 8, "_machine")
+QDEF1(MP_QSTR__mpy, 46620, 4, "_mpy")
+QDEF1(MP_QSTR__task_queue, 26442, 11, "_task_queue")
+QDEF1(MP_QSTR__thread, 45772, 7, "_thread")
+QDEF1(MP_QSTR_a2b_base64, 24201, 10, "a2b_base64")
+QDEF1(MP_QSTR_abs_tol, 22123, 7, "abs_tol")
+QDEF1(MP_QSTR_accept, 49473, 6, "accept")
+QDEF1(MP_QSTR_acos, 61256, 4, "acos")
+QDEF1(MP_QSTR_acosh, 53240, 5, "acosh")
+QDEF1(MP_QSTR_acquire, 24963, 7, "acquire")
+QDEF1(MP_QSTR_add, 53841, 3, "add")
+QDEF1(MP_QSTR_addressof, 4284, 9, "addressof")
+QDEF1(MP_QSTR_alloc_rate, 45510, 10, "alloc_rate")
+QDEF1(MP_QSTR_allocate_lock, 31411, 13, "allocate_lock")
+QDEF1(MP_QSTR_appendleft, 23481, 10, "appendleft")
+QDEF1(MP_QSTR_argv, 33820, 4, "argv")
+QDEF1(MP_QSTR_array, 31958, 5, "array")
+QDEF1(MP_QSTR_ascii, 63359, 5, "ascii")
+QDEF1(MP_QSTR_asin, 3031, 4, "asin")
+QDEF1(MP_QSTR_asinh, 39319, 5, "asinh")
+QDEF1(MP_QSTR_atan, 36931, 4, "atan")
+QDEF1(MP_QSTR_atan2, 40076, 5, "atan2")
+QDEF1(MP_QSTR_atanh, 62575, 5, "atanh")
+QDEF1(MP_QSTR_atexit, 39463, 6, "atexit")
+QDEF1(MP_QSTR_b2a_base64, 46658, 10, "b2a_base64")
+QDEF1(MP_QSTR_big, 16197, 3, "big")
+QDEF1(MP_QSTR_bin, 2086, 3, "bin")
+QDEF1(MP_QSTR_binascii, 115, 8, "binascii")
+QDEF1(MP_QSTR_bind, 34421, 4, "bind")
+QDEF1(MP_QSTR_blit, 19574, 4, "blit")
+QDEF1(MP_QSTR_bound_method, 12059, 12, "bound_method")
+QDEF1(MP_QSTR_buffer, 11117, 6, "buffer")
+QDEF1(MP_QSTR_buffering, 12901, 9, "buffering")
+QDEF1(MP_QSTR_bytearray_at, 47927, 12, "bytearray_at")
+QDEF1(MP_QSTR_byteorder, 31699, 9, "byteorder")
+QDEF1(MP_QSTR_bytes_at, 44821, 8, "bytes_at")
+QDEF1(MP_QSTR_calcsize, 23804, 8, "calcsize")
+QDEF1(MP_QSTR_cancel, 13917, 6, "cancel")
+QDEF1(MP_QSTR_ceil, 37250, 4, "ceil")
+QDEF1(MP_QSTR_center, 24935, 6, "center")
+QDEF1(MP_QSTR_chdir, 54007, 5, "chdir")
+QDEF1(MP_QSTR_choice, 20416, 6, "choice")
+QDEF1(MP_QSTR_clock, 48148, 5, "clock")
+QDEF1(MP_QSTR_closure, 51967, 7, "closure")
+QDEF1(MP_QSTR_cmath, 46989, 5, "cmath")
+QDEF1(MP_QSTR_code, 23177, 4, "code")
+QDEF1(MP_QSTR_collect, 9985, 7, "collect")
+QDEF1(MP_QSTR_collect_step, 42283, 12, "collect_step")
+QDEF1(MP_QSTR_collections, 27817, 11, "collections")
+QDEF1(MP_QSTR_compact, 24284, 7, "compact")
+QDEF1(MP_QSTR_compile, 54413, 7, "compile")
+QDEF1(MP_QSTR_complex, 3130, 7, "complex")
+QDEF1(MP_QSTR_connect, 59725, 7, "connect")
+QDEF1(MP_QSTR_copysign, 30889, 8, "copysign")
+QDEF1(MP_QSTR_coro, 35679, 4, "coro")
+QDEF1(MP_QSTR_cos, 3074, 3, "cos")
+QDEF1(MP_QSTR_cosh, 52709, 4, "cosh")
+QDEF1(MP_QSTR_crc32, 25415, 5, "crc32")
+QDEF1(MP_QSTR_cur_task, 57737, 8, "cur_task")
+QDEF1(MP_QSTR_data, 7390, 4, "data")
+QDEF1(MP_QSTR_decode, 30900, 6, "decode")
+QDEF1(MP_QSTR_default, 5167, 7, "default")
+QDEF1(MP_QSTR_deflate, 8928, 7, "deflate")
+QDEF1(MP_QSTR_degrees, 17254, 7, "degrees")
+QDEF1(MP_QSTR_delattr, 37579, 7, "delattr")
+QDEF1(MP_QSTR_deleter, 38155, 7, "deleter")
+QDEF1(MP_QSTR_deque, 24389, 5, "deque")
+QDEF1(MP_QSTR_dict_view, 57758, 9, "dict_view")
+QDEF1(MP_QSTR_difference, 26, 10, "difference")
+QDEF1(MP_QSTR_difference_update, 31672, 17, "difference_update")
+QDEF1(MP_QSTR_digest, 17811, 6, "digest")
+QDEF1(MP_QSTR_disable, 42604, 7, "disable")
+QDEF1(MP_QSTR_discard, 58169, 7, "discard")
+QDEF1(MP_QSTR_doc, 18816, 3, "doc")
+QDEF1(MP_QSTR_done, 42188, 4, "done")
+QDEF1(MP_QSTR_dump, 12796, 4, "dump")
+QDEF1(MP_QSTR_dumps, 2301, 5, "dumps")
+QDEF1(MP_QSTR_e, 12558, 1, "e")
+QDEF1(MP_QSTR_ellipse, 55150, 7, "ellipse")
+QDEF1(MP_QSTR_enable, 130, 6, "enable")
+QDEF1(MP_QSTR_encode, 47083, 6, "encode")
+QDEF1(MP_QSTR_encoding, 57829, 8, "encoding")
+QDEF1(MP_QSTR_enumerate, 52858, 9, "enumerate")
+QDEF1(MP_QSTR_erf, 16796, 3, "erf")
+QDEF1(MP_QSTR_erfc, 22536, 4, "erfc")
+QDEF1(MP_QSTR_errno, 44542, 5, "errno")
+QDEF1(MP_QSTR_errorcode, 25702, 9, "errorcode")
+QDEF1(MP_QSTR_exc_info, 57850, 8, "exc_info")
+QDEF1(MP_QSTR_execfile, 34580, 8, "execfile")
+QDEF1(MP_QSTR_executable, 36634, 10, "executable")
+QDEF1(MP_QSTR_exit, 6975, 4, "exit")
+QDEF1(MP_QSTR_exp, 46805, 3, "exp")
+QDEF1(MP_QSTR_expm1, 59116, 5, "expm1")
+QDEF1(MP_QSTR_fabs, 33099, 4, "fabs")
+QDEF1(MP_QSTR_factorial, 11661, 9, "factorial")
+QDEF1(MP_QSTR_file, 48286, 4, "file")
+QDEF1(MP_QSTR_fileno, 4322, 6, "fileno")
+QDEF1(MP_QSTR_fill, 53044, 4, "fill")
+QDEF1(MP_QSTR_fill_rect, 28394, 9, "fill_rect")
+QDEF1(MP_QSTR_filter, 57548, 6, "filter")
+QDEF1(MP_QSTR_float, 50039, 5, "float")
+QDEF1(MP_QSTR_floor, 62965, 5, "floor")
+QDEF1(MP_QSTR_flush, 37417, 5, "flush")
+QDEF1(MP_QSTR_fmod, 50837, 4, "fmod")
+QDEF1(MP_QSTR_framebuf, 39615, 8, "framebuf")
+QDEF1(MP_QSTR_frexp, 20116, 5, "frexp")
+QDEF1(MP_QSTR_fromhex, 10720, 7, "fromhex")
+QDEF1(MP_QSTR_fromkeys, 32403, 8, "fromkeys")
+QDEF1(MP_QSTR_frozenset, 52809, 9, "frozenset")
+QDEF1(MP_QSTR_function, 24300, 8, "function")
+QDEF1(MP_QSTR_gamma, 37104, 5, "gamma")
+QDEF1(MP_QSTR_gc, 40802, 2, "gc")
+QDEF1(MP_QSTR_generator, 1236, 9, "generator")
+QDEF1(MP_QSTR_get_ident, 41733, 9, "get_ident")
+QDEF1(MP_QSTR_getaddrinfo, 14008, 11, "getaddrinfo")
+QDEF1(MP_QSTR_getcwd, 54636, 6, "getcwd")
+QDEF1(MP_QSTR_getenv, 40732, 6, "getenv")
+QDEF1(MP_QSTR_getrandbits, 47235, 11, "getrandbits")
+QDEF1(MP_QSTR_getter, 2059, 6, "getter")
+QDEF1(MP_QSTR_getvalue, 64853, 8, "getvalue")
+QDEF1(MP_QSTR_gmtime, 34623, 6, "gmtime")
+QDEF1(MP_QSTR_group, 23676, 5, "group")
+QDEF1(MP_QSTR_hashlib, 17121, 7, "hashlib")
+QDEF1(MP_QSTR_heap_lock, 54827, 9, "heap_lock")
+QDEF1(MP_QSTR_heap_unlock, 39099, 11, "heap_unlock")
+QDEF1(MP_QSTR_heapify, 27091, 7, "heapify")
+QDEF1(MP_QSTR_heappop, 19652, 7, "heappop")
+QDEF1(MP_QSTR_heappush, 17982, 8, "heappush")
+QDEF1(MP_QSTR_heapq, 62560, 5, "heapq")
+QDEF1(MP_QSTR_help, 8316, 4, "help")
+QDEF1(MP_QSTR_hex, 41271, 3, "hex")
+QDEF1(MP_QSTR_hexlify, 38860, 7, "hexlify")
+QDEF1(MP_QSTR_hline, 2385, 5, "hline")
+QDEF1(MP_QSTR_idle, 23151, 4, "idle")
+QDEF1(MP_QSTR_ignore, 50258, 6, "ignore")
+QDEF1(MP_QSTR_ilistdir, 1001, 8, "ilistdir")
+QDEF1(MP_QSTR_imag, 24791, 4, "imag")
+QDEF1(MP_QSTR_implementation, 35709, 14, "implementation")
+QDEF1(MP_QSTR_indices, 8206, 7, "indices")
+QDEF1(MP_QSTR_inet_ntop, 13525, 9, "inet_ntop")
+QDEF1(MP_QSTR_inet_pton, 29014, 9, "inet_pton")
+QDEF1(MP_QSTR_inf, 14739, 3, "inf")
+QDEF1(MP_QSTR_input, 48226, 5, "input")
+QDEF1(MP_QSTR_intersection, 8871, 12, "intersection")
+QDEF1(MP_QSTR_intersection_update, 58445, 19, "intersection_update")
+QDEF1(MP_QSTR_invert, 30936, 6, "invert")
+QDEF1(MP_QSTR_io, 43344, 2, "io")
+QDEF1(MP_QSTR_ioctl, 6411, 5, "ioctl")
+QDEF1(MP_QSTR_ipoll, 26575, 5, "ipoll")
+QDEF1(MP_QSTR_isclose, 16485, 7, "isclose")
+QDEF1(MP_QSTR_isdisjoint, 15541, 10, "isdisjoint")
+QDEF1(MP_QSTR_isenabled, 59818, 9, "isenabled")
+QDEF1(MP_QSTR_isfinite, 41060, 8, "isfinite")
+QDEF1(MP_QSTR_isinf, 38965, 5, "isinf")
+QDEF1(MP_QSTR_isnan, 54612, 5, "isnan")
+QDEF1(MP_QSTR_issubset, 12513, 8, "issubset")
+QDEF1(MP_QSTR_issuperset, 34006, 10, "issuperset")
+QDEF1(MP_QSTR_itemsize, 31950, 8, "itemsize")
+QDEF1(MP_QSTR_iterable, 55078, 8, "iterable")
+QDEF1(MP_QSTR_iterator, 25105, 8, "iterator")
+QDEF1(MP_QSTR_json, 19942, 4, "json")
+QDEF1(MP_QSTR_kbd_intr, 19071, 8, "kbd_intr")
+QDEF1(MP_QSTR_keepends, 30542, 8, "keepends")
+QDEF1(MP_QSTR_ldexp, 25269, 5, "ldexp")
+QDEF1(MP_QSTR_length, 38981, 6, "length")
+QDEF1(MP_QSTR_lgamma, 17690, 6, "lgamma")
+QDEF1(MP_QSTR_libc_ver, 36625, 8, "libc_ver")
+QDEF1(MP_QSTR_line, 9255, 4, "line")
+QDEF1(MP_QSTR_listdir, 38876, 7, "listdir")
+QDEF1(MP_QSTR_listen, 54958, 6, "listen")
+QDEF1(MP_QSTR_load, 36631, 4, "load")
+QDEF1(MP_QSTR_loads, 14557, 5, "loads")
+QDEF1(MP_QSTR_localtime, 45407, 9, "localtime")
+QDEF1(MP_QSTR_lock, 47928, 4, "lock")
+QDEF1(MP_QSTR_locked, 297, 6, "locked")
+QDEF1(MP_QSTR_log, 26141, 3, "log")
+QDEF1(MP_QSTR_log10, 63222, 5, "log10")
+QDEF1(MP_QSTR_log2, 32045, 4, "log2")
+QDEF1(MP_QSTR_lookahead, 10593, 9, "lookahead")
+QDEF1(MP_QSTR_machine, 1886, 7, "machine")
+QDEF1(MP_QSTR_makefile, 9063, 8, "makefile")
+QDEF1(MP_QSTR_mark_threads, 38233, 12, "mark_threads")
+QDEF1(MP_QSTR_match, 51871, 5, "match")
+QDEF1(MP_QSTR_math, 5544, 4, "math")
+QDEF1(MP_QSTR_max, 35372, 3, "max")
+QDEF1(MP_QSTR_max_pause_us, 22132, 12, "max_pause_us")
+QDEF1(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, 33614, 32, "maximum recursion depth exceeded")
+QDEF1(MP_QSTR_maxsize, 39621, 7, "maxsize")
+QDEF1(MP_QSTR_mem, 44389, 3, "mem")
+QDEF1(MP_QSTR_mem16, 12832, 5, "mem16")
+QDEF1(MP_QSTR_mem32, 2999, 5, "mem32")
+QDEF1(MP_QSTR_mem8, 2689, 4, "mem8")
+QDEF1(MP_QSTR_mem_alloc, 8326, 9, "mem_alloc")
+QDEF1(MP_QSTR_mem_current, 17001, 11, "mem_current")
+QDEF1(MP_QSTR_mem_free, 9709, 8, "mem_free")
+QDEF1(MP_QSTR_mem_info, 51686, 8, "mem_info")
+QDEF1(MP_QSTR_mem_peak, 22290, 8, "mem_peak")
+QDEF1(MP_QSTR_mem_total, 37108, 9, "mem_total")
+QDEF1(MP_QSTR_memoryview, 29018, 10, "memoryview")
+QDEF1(MP_QSTR_min, 9297, 3, "min")
+QDEF1(MP_QSTR_mkdir, 30125, 5, "mkdir")
+QDEF1(MP_QSTR_mkfs, 60897, 4, "mkfs")
+QDEF1(MP_QSTR_mktime, 18517, 6, "mktime")
+QDEF1(MP_QSTR_mode, 49330, 4, "mode")
+QDEF1(MP_QSTR_modf, 40772, 4, "modf")
+QDEF1(MP_QSTR_modify, 43003, 6, "modify")
+QDEF1(MP_QSTR_module, 44058, 6, "module")
+QDEF1(MP_QSTR_modules, 24952, 7, "modules")
+QDEF1(MP_QSTR_mount, 44273, 5, "mount")
+QDEF1(MP_QSTR_mtime, 1007, 5, "mtime")
+QDEF1(MP_QSTR_name, 25009, 4, "name")
+QDEF1(MP_QSTR_namedtuple, 48725, 10, "namedtuple")
+QDEF1(MP_QSTR_nan, 22918, 3, "nan")
+QDEF1(MP_QSTR_native, 42318, 6, "native")
+QDEF1(MP_QSTR_newline, 45618, 7, "newline")
+QDEF1(MP_QSTR_oct, 36688, 3, "oct")
+QDEF1(MP_QSTR_off, 38378, 3, "off")
+QDEF1(MP_QSTR_on, 35146, 2, "on")
+QDEF1(MP_QSTR_opt_level, 59330, 9, "opt_level")
+QDEF1(MP_QSTR_os, 31205, 2, "os")
+QDEF1(MP_QSTR_overhead_pct, 26676, 12, "overhead_pct")
+QDEF1(MP_QSTR_pack, 3741, 4, "pack")
+QDEF1(MP_QSTR_pack_into, 50959, 9, "pack_into")
+QDEF1(MP_QSTR_partition, 21236, 9, "partition")
+QDEF1(MP_QSTR_path, 25802, 4, "path")
+QDEF1(MP_QSTR_pause_ms, 33571, 8, "pause_ms")
+QDEF1(MP_QSTR_pause_us, 12624, 8, "pause_us")
+QDEF1(MP_QSTR_peek, 43029, 4, "peek")
+QDEF1(MP_QSTR_pend_throw, 56835, 10, "pend_throw")
+QDEF1(MP_QSTR_ph_key, 49250, 6, "ph_key")
+QDEF1(MP_QSTR_phase, 62760, 5, "phase")
+QDEF1(MP_QSTR_pi, 23725, 2, "pi")
+QDEF1(MP_QSTR_pixel, 4014, 5, "pixel")
+QDEF1(MP_QSTR_platform, 44952, 8, "platform")
+QDEF1(MP_QSTR_polar, 54256, 5, "polar")
+QDEF1(MP_QSTR_poll, 4644, 4, "poll")
+QDEF1(MP_QSTR_poly, 27525, 4, "poly")
+QDEF1(MP_QSTR_popleft, 57484, 7, "popleft")
+QDEF1(MP_QSTR_preview, 17790, 7, "preview")
+QDEF1(MP_QSTR_print_exception, 3381, 15, "print_exception")
+QDEF1(MP_QSTR_progsize, 34591, 8, "progsize")
+QDEF1(MP_QSTR_property, 28843, 8, "property")
+QDEF1(MP_QSTR_ps1, 12647, 3, "ps1")
+QDEF1(MP_QSTR_ps2, 963, 3, "ps2")
+QDEF1(MP_QSTR_ptr, 19980, 3, "ptr")
+QDEF1(MP_QSTR_ptr16, 50666, 5, "ptr16")
+QDEF1(MP_QSTR_ptr32, 28477, 5, "ptr32")
+QDEF1(MP_QSTR_ptr8, 25220, 4, "ptr8")
+QDEF1(MP_QSTR_push, 15439, 4, "push")
+QDEF1(MP_QSTR_putenv, 51439, 6, "putenv")
+QDEF1(MP_QSTR_python_compiler, 32677, 15, "python_compiler")
+QDEF1(MP_QSTR_qstr_info, 62592, 9, "qstr_info")
+QDEF1(MP_QSTR_r, 54047, 1, "r")
+QDEF1(MP_QSTR_radians, 46503, 7, "radians")
+QDEF1(MP_QSTR_randint, 38753, 7, "randint")
+QDEF1(MP_QSTR_random, 7709, 6, "random")
+QDEF1(MP_QSTR_randrange, 53134, 9, "randrange")
+QDEF1(MP_QSTR_rb, 42784, 2, "rb")
+QDEF1(MP_QSTR_re, 20060, 2, "re")
+QDEF1(MP_QSTR_readblocks, 52039, 10, "readblocks")
+QDEF1(MP_QSTR_readlines, 58615, 9, "readlines")
+QDEF1(MP_QSTR_readonly, 59046, 8, "readonly")
+QDEF1(MP_QSTR_readsize, 40876, 8, "readsize")
+QDEF1(MP_QSTR_real, 49034, 4, "real")
+QDEF1(MP_QSTR_rect, 65081, 4, "rect")
+QDEF1(MP_QSTR_recv, 35977, 4, "recv")
+QDEF1(MP_QSTR_recvfrom, 33997, 8, "recvfrom")
+QDEF1(MP_QSTR_register, 3740, 8, "register")
+QDEF1(MP_QSTR_rel_tol, 31986, 7, "rel_tol")
+QDEF1(MP_QSTR_release, 3150, 7, "release")
+QDEF1(MP_QSTR_rename, 37980, 6, "rename")
+QDEF1(MP_QSTR_reversed, 15069, 8, "reversed")
+QDEF1(MP_QSTR_rmdir, 65241, 5, "rmdir")
+QDEF1(MP_QSTR_rpartition, 3194, 10, "rpartition")
+QDEF1(MP_QSTR_schedule, 30021, 8, "schedule")
+QDEF1(MP_QSTR_schedule_overflow, 13022, 17, "schedule_overflow")
+QDEF1(MP_QSTR_scroll, 22153, 6, "scroll")
+QDEF1(MP_QSTR_search, 55284, 6, "search")
+QDEF1(MP_QSTR_seed, 26026, 4, "seed")
+QDEF1(MP_QSTR_seek, 44715, 4, "seek")
+QDEF1(MP_QSTR_select, 61992, 6, "select")
+QDEF1(MP_QSTR_sendall, 43889, 7, "sendall")
+QDEF1(MP_QSTR_sendto, 12143, 6, "sendto")
+QDEF1(MP_QSTR_separators, 49062, 10, "separators")
+QDEF1(MP_QSTR_setblocking, 64466, 11, "setblocking")
+QDEF1(MP_QSTR_setraw, 4193, 6, "setraw")
+QDEF1(MP_QSTR_setsockopt, 6326, 10, "setsockopt")
+QDEF1(MP_QSTR_setter, 33924, 6, "setter")
+QDEF1(MP_QSTR_settimeout, 4704, 10, "settimeout")
+QDEF1(MP_QSTR_sha256, 40592, 6, "sha256")
+QDEF1(MP_QSTR_signed, 25178, 6, "signed")
+QDEF1(MP_QSTR_sin, 44625, 3, "sin")
+QDEF1(MP_QSTR_single, 54219, 6, "single")
+QDEF1(MP_QSTR_sinh, 15301, 4, "sinh")
+QDEF1(MP_QSTR_sizeof, 8808, 6, "sizeof")
+QDEF1(MP_QSTR_sleep, 53561, 5, "sleep")
+QDEF1(MP_QSTR_sleep_ms, 14461, 8, "sleep_ms")
+QDEF1(MP_QSTR_sleep_us, 2674, 8, "sleep_us")
+QDEF1(MP_QSTR_slice, 29884, 5, "slice")
+QDEF1(MP_QSTR_sockaddr, 2654, 8, "sockaddr")
+QDEF1(MP_QSTR_socket, 14548, 6, "socket")
+QDEF1(MP_QSTR_soft_reset, 38794, 10, "soft_reset")
+QDEF1(MP_QSTR_splitlines, 5957, 10, "splitlines")
+QDEF1(MP_QSTR_sqrt, 53858, 4, "sqrt")
+QDEF1(MP_QSTR_stack_size, 16020, 10, "stack_size")
+QDEF1(MP_QSTR_stack_use, 50017, 9, "stack_use")
+QDEF1(MP_QSTR_start_new_thread, 61887, 16, "start_new_thread")
+QDEF1(MP_QSTR_stat, 21093, 4, "stat")
+QDEF1(MP_QSTR_state, 30766, 5, "state")
+QDEF1(MP_QSTR_stats, 61403, 5, "stats")
+QDEF1(MP_QSTR_statvfs, 48837, 7, "statvfs")
+QDEF1(MP_QSTR_stderr, 44282, 6, "stderr")
+QDEF1(MP_QSTR_stdin, 50522, 5, "stdin")
+QDEF1(MP_QSTR_stdout, 24554, 6, "stdout")
+QDEF1(MP_QSTR_struct, 12548, 6, "struct")
+QDEF1(MP_QSTR_sub, 37200, 3, "sub")
+QDEF1(MP_QSTR_survival_pct, 43638, 12, "survival_pct")
+QDEF1(MP_QSTR_symmetric_difference, 55494, 20, "symmetric_difference")
+QDEF1(MP_QSTR_symmetric_difference_update, 7357, 27, "symmetric_difference_update")
+QDEF1(MP_QSTR_sync, 39816, 4, "sync")
+QDEF1(MP_QSTR_sys, 39640, 3, "sys")
+QDEF1(MP_QSTR_system, 42745, 6, "system")
+QDEF1(MP_QSTR_tan, 55276, 3, "tan")
+QDEF1(MP_QSTR_tanh, 37757, 4, "tanh")
+QDEF1(MP_QSTR_target, 25552, 6, "target")
+QDEF1(MP_QSTR_tau, 9968, 3, "tau")
+QDEF1(MP_QSTR_tcgetattr, 24490, 9, "tcgetattr")
+QDEF1(MP_QSTR_tcsetattr, 28499, 9, "tcsetattr")
+QDEF1(MP_QSTR_tell, 46435, 4, "tell")
+QDEF1(MP_QSTR_termios, 51602, 7, "termios")
+QDEF1(MP_QSTR_text, 25536, 4, "text")
+QDEF1(MP_QSTR_threshold, 1725, 9, "threshold")
+QDEF1(MP_QSTR_ticks_add, 10319, 9, "ticks_add")
+QDEF1(MP_QSTR_ticks_cpu, 9172, 9, "ticks_cpu")
+QDEF1(MP_QSTR_ticks_diff, 34016, 10, "ticks_diff")
+QDEF1(MP_QSTR_ticks_ms, 52303, 8, "ticks_ms")
+QDEF1(MP_QSTR_ticks_us, 13879, 8, "ticks_us")
+QDEF1(MP_QSTR_time, 49006, 4, "time")
+QDEF1(MP_QSTR_time_ns, 27474, 7, "time_ns")
+QDEF1(MP_QSTR_time_pulse_us, 21675, 13, "time_pulse_us")
+QDEF1(MP_QSTR_total_pause_us, 999, 14, "total_pause_us")
+QDEF1(MP_QSTR_trunc, 37894, 5, "trunc")
+QDEF1(MP_QSTR_uctypes, 34495, 7, "uctypes")
+QDEF1(MP_QSTR_uint, 55788, 4, "uint")
+QDEF1(MP_QSTR_umount, 38279, 6, "umount")
+QDEF1(MP_QSTR_unhexlify, 15498, 9, "unhexlify")
+QDEF1(MP_QSTR_uniform, 23608, 7, "uniform")
+QDEF1(MP_QSTR_union, 11109, 5, "union")
+QDEF1(MP_QSTR_unlink, 54375, 6, "unlink")
+QDEF1(MP_QSTR_unpack, 54944, 6, "unpack")
+QDEF1(MP_QSTR_unpack_from, 32819, 11, "unpack_from")
+QDEF1(MP_QSTR_unregister, 49977, 10, "unregister")
+QDEF1(MP_QSTR_unsafe, 11782, 6, "unsafe")
+QDEF1(MP_QSTR_unsetenv, 18367, 8, "unsetenv")
+QDEF1(MP_QSTR_urandom, 33122, 7, "urandom")
+QDEF1(MP_QSTR_usys, 40182, 4, "usys")
+QDEF1(MP_QSTR_utf8, 57784, 4, "utf8")
+QDEF1(MP_QSTR_version, 59374, 7, "version")
+QDEF1(MP_QSTR_version_info, 64051, 12, "version_info")
+QDEF1(MP_QSTR_vfs, 35067, 3, "vfs")
+QDEF1(MP_QSTR_viper, 31351, 5, "viper")
+QDEF1(MP_QSTR_vline, 14692, 5, "vline")
+QDEF1(MP_QSTR_websocket, 47343, 9, "websocket")
+QDEF1(MP_QSTR_writeblocks, 39332, 11, "writeblocks")
+QDEF1(MP_QSTR__brace_open__colon__hash_b_brace_close_, 36121, 5, "{:#b}")
@@ -300,6 +300,44 @@ static mp_obj_t extra_coverage(void) {
         mp_printf(&mp_plat_print, "%d\n", info_slow.free == info_fast.free);
     }
 
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // thread allocation buffers
+    {
+        mp_printf(&mp_plat_print, "# GC thread alloc buffer\n");
+        gc_info_t info0;
+        gc_info_t info1;
+
+        // a collection retires the buffers, so the next small allocation
+        // refills its buffer with a run of objects
+        gc_collect();
+        gc_info(&info0);
+        byte *p0 = gc_alloc(MICROPY_BYTES_PER_GC_BLOCK, 0);
+        gc_info(&info1);
+        mp_printf(&mp_plat_print, "%d\n", (int)((info0.free - info1.free) / MICROPY_BYTES_PER_GC_BLOCK));
+
+        // the following objects of that size come from the buffer
+        byte *p1 = gc_alloc(MICROPY_BYTES_PER_GC_BLOCK, 0);
+        gc_info(&info0);
+        mp_printf(&mp_plat_print, "%d %d\n", p1 == p0 + MICROPY_BYTES_PER_GC_BLOCK, info0.free == info1.free);
+
+        // releasing the buffer, as done when a thread finishes, frees the
+        // objects that weren't handed out
+        gc_alloc_buffer_release();
+        gc_info(&info1);
+        mp_printf(&mp_plat_print, "%d\n", (int)((info1.free - info0.free) / MICROPY_BYTES_PER_GC_BLOCK));
+
+        // and the next small allocation refills it
+        byte *p2 = gc_alloc(MICROPY_BYTES_PER_GC_BLOCK, 0);
+        gc_info(&info0);
+        mp_printf(&mp_plat_print, "%d\n", (int)((info1.free - info0.free) / MICROPY_BYTES_PER_GC_BLOCK));
+
+        gc_free(p0);
+        gc_free(p1);
+        gc_free(p2);
+        gc_alloc_buffer_release();
+    }
+    #endif
+
     // GC initialisation and allocation stress test, to check the logic behind ALLOC_TABLE_GAP_BYTE
     // (the following test should fail when ALLOC_TABLE_GAP_BYTE=0)
     {
@@ -763,8 +801,10 @@ static mp_obj_t extra_coverage(void) {
         #if MICROPY_STACKLESS
         code_state->prev = NULL;
         #endif
-        #if MICROPY_PY_SYS_SETTRACE
+        #if MICROPY_VM_CODE_STATE_CHAIN
         code_state->prev_state = NULL;
+        #endif
+        #if MICROPY_PY_SYS_SETTRACE
         code_state->frame = NULL;
         #endif
 
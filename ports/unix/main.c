@@ -67,6 +67,11 @@ static uint emit_opt = MP_EMIT_OPT_NONE;
 long heap_size = 1024 * 1024 * (sizeof(mp_uint_t) / 4);
 #endif
 
+#if MICROPY_GC_ALLOC_PROFILE
+// Sample every n'th allocation if non-zero, set with -X allocprof=<n>
+static long alloc_profile_period = 0;
+#endif
+
 // Number of heaps to assign by default if MICROPY_GC_SPLIT_HEAP=1
 #ifndef MICROPY_GC_SPLIT_HEAP_N_HEAPS
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS (1)
@@ -307,6 +312,10 @@ static void print_help(char **argv) {
         , heap_size);
     impl_opts_cnt++;
     #endif
+    #if MICROPY_GC_ALLOC_PROFILE
+    printf("  allocprof=<n> -- sample every n'th allocation, print folded stacks to stderr at exit\n");
+    impl_opts_cnt++;
+    #endif
     #if defined(__APPLE__)
     printf("  realtime -- set thread priority to realtime\n");
     impl_opts_cnt++;
@@ -386,6 +395,14 @@ static void pre_process_options(int argc, char **argv) {
                         goto invalid_arg;
                     }
                 #endif
+                #if MICROPY_GC_ALLOC_PROFILE
+                } else if (strncmp(argv[a + 1], "allocprof=", sizeof("allocprof=") - 1) == 0) {
+                    char *end;
+                    alloc_profile_period = strtol(argv[a + 1] + sizeof("allocprof=") - 1, &end, 0);
+                    if (*end != 0 || alloc_profile_period <= 0) {
+                        goto invalid_arg;
+                    }
+                #endif
                 #if defined(__APPLE__)
                 } else if (strcmp(argv[a + 1], "realtime") == 0) {
                     #if MICROPY_PY_THREAD
@@ -495,6 +512,10 @@ MP_NOINLINE int main_(int argc, char **argv) {
 
     mp_init();
 
+    #if MICROPY_GC_ALLOC_PROFILE
+    gc_alloc_profile(alloc_profile_period);
+    #endif
+
     #if MICROPY_EMIT_NATIVE
     // Set default emitter options
     MP_STATE_VM(default_emit_opt) = emit_opt;
@@ -734,6 +755,12 @@ MP_NOINLINE int main_(int argc, char **argv) {
     mp_thread_deinit();
     #endif
 
+    #if MICROPY_GC_ALLOC_PROFILE
+    if (alloc_profile_period != 0) {
+        gc_alloc_profile_print(&mp_stderr_print);
+    }
+    #endif
+
     #if defined(MICROPY_UNIX_COVERAGE)
     gc_sweep_all();
     #endif
@@ -742,14 +769,20 @@ MP_NOINLINE int main_(int argc, char **argv) {
 
     #if MICROPY_ENABLE_GC && !defined(NDEBUG)
     // We don't really need to free memory since we are about to exit the
-    // process, but doing so helps to find memory leaks.
-    #if !MICROPY_GC_SPLIT_HEAP
-    free(heap);
-    #else
-    for (size_t i = 0; i < MICROPY_GC_SPLIT_HEAP_N_HEAPS; i++) {
-        free(heaps[i]);
-    }
+    // process, but doing so helps to find memory leaks.  Threads that were
+    // cancelled above may not have stopped yet, so then leave the heap alone.
+    #if MICROPY_PY_THREAD
+    if (!mp_thread_unix_threads_cancelled)
     #endif
+    {
+        #if !MICROPY_GC_SPLIT_HEAP
+        free(heap);
+        #else
+        for (size_t i = 0; i < MICROPY_GC_SPLIT_HEAP_N_HEAPS; i++) {
+            free(heaps[i]);
+        }
+        #endif
+    }
     #endif
 
     #if MICROPY_PY_SYS_EXECUTABLE && !defined(NDEBUG)
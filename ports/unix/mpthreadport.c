@@ -75,6 +75,8 @@ static pthread_key_t tls_key;
 static mp_thread_recursive_mutex_t thread_mutex;
 static mp_thread_t *thread;
 
+bool mp_thread_unix_threads_cancelled = false;
+
 // this is used to synchronise the signal handler of the thread
 // it's needed because we can't use any pthread calls in a signal handler
 #if defined(__APPLE__)
@@ -169,6 +171,7 @@ void mp_thread_deinit(void) {
     while (thread->next != NULL) {
         mp_thread_t *th = thread;
         thread = thread->next;
+        mp_thread_unix_threads_cancelled = true;
         #if defined(__ANDROID__)
         pthread_kill(th->id, MP_THREAD_TERMINATE_SIGNAL);
         #else
@@ -211,6 +214,15 @@ void mp_thread_gc_others(void) {
     mp_thread_unix_end_atomic_section();
 }
 
+#if MICROPY_GC_COMPACT && !MICROPY_PY_THREAD_GIL
+bool mp_thread_is_only_thread(void) {
+    mp_thread_unix_begin_atomic_section();
+    bool only = thread->next == NULL;
+    mp_thread_unix_end_atomic_section();
+    return only;
+}
+#endif
+
 mp_state_thread_t *mp_thread_get_state(void) {
     return (mp_state_thread_t *)pthread_getspecific(tls_key);
 }
@@ -371,6 +383,85 @@ void mp_thread_recursive_mutex_unlock(mp_thread_recursive_mutex_t *mutex) {
 
 #endif // MICROPY_PY_THREAD_RECURSIVE_MUTEX
 
+#if MICROPY_GC_PARALLEL_MARK
+
+// Helper threads for the parallel mark phase of the GC.  They are not Python
+// threads: they are created when first needed and then wait for more work.
+static pthread_t gc_worker_thread[MICROPY_GC_PARALLEL_MARK_MAX_THREADS];
+static size_t gc_worker_num_threads;
+static pthread_mutex_t gc_worker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gc_worker_start_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t gc_worker_done_cond = PTHREAD_COND_INITIALIZER;
+static unsigned int gc_worker_generation;
+static void (*gc_worker_fun)(size_t id);
+static size_t gc_worker_num_running;
+static size_t gc_worker_num_done;
+
+static void *gc_worker_entry(void *arg) {
+    size_t id = (uintptr_t)arg;
+    unsigned int generation = 0;
+    pthread_mutex_lock(&gc_worker_mutex);
+    for (;;) {
+        while (generation == gc_worker_generation) {
+            pthread_cond_wait(&gc_worker_start_cond, &gc_worker_mutex);
+        }
+        generation = gc_worker_generation;
+        if (id < gc_worker_num_running) {
+            void (*fun)(size_t) = gc_worker_fun;
+            pthread_mutex_unlock(&gc_worker_mutex);
+            fun(id);
+            pthread_mutex_lock(&gc_worker_mutex);
+            if (++gc_worker_num_done == gc_worker_num_running - 1) {
+                pthread_cond_signal(&gc_worker_done_cond);
+            }
+        }
+    }
+    return NULL;
+}
+
+bool mp_thread_gc_run_workers(void (*worker)(size_t id), size_t n_workers) {
+    pthread_mutex_lock(&gc_worker_mutex);
+
+    // Start any helper threads that are needed.  Signals are blocked in them,
+    // so they are still delivered to the Python threads.
+    if (gc_worker_num_threads + 1 < n_workers) {
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        while (gc_worker_num_threads + 1 < n_workers) {
+            size_t id = gc_worker_num_threads + 1;
+            if (pthread_create(&gc_worker_thread[id], NULL, gc_worker_entry, (void *)(uintptr_t)id) != 0) {
+                break;
+            }
+            pthread_detach(gc_worker_thread[id]);
+            gc_worker_num_threads += 1;
+        }
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+        if (gc_worker_num_threads + 1 < n_workers) {
+            pthread_mutex_unlock(&gc_worker_mutex);
+            return false;
+        }
+    }
+
+    gc_worker_fun = worker;
+    gc_worker_num_running = n_workers;
+    gc_worker_num_done = 0;
+    gc_worker_generation += 1;
+    pthread_cond_broadcast(&gc_worker_start_cond);
+    pthread_mutex_unlock(&gc_worker_mutex);
+
+    worker(0);
+
+    pthread_mutex_lock(&gc_worker_mutex);
+    while (gc_worker_num_done < n_workers - 1) {
+        pthread_cond_wait(&gc_worker_done_cond, &gc_worker_mutex);
+    }
+    pthread_mutex_unlock(&gc_worker_mutex);
+    return true;
+}
+
+#endif // MICROPY_GC_PARALLEL_MARK
+
 #endif // MICROPY_PY_THREAD
 
 // this is used even when MICROPY_PY_THREAD is disabled
@@ -34,6 +34,9 @@ void mp_thread_init(void);
 void mp_thread_deinit(void);
 void mp_thread_gc_others(void);
 
+// Set by mp_thread_deinit() if it cancelled threads, which may still be running.
+extern bool mp_thread_unix_threads_cancelled;
+
 // Unix version of "enable/disable IRQs".
 // Functions as a port-global lock for any code that must be serialised.
 void mp_thread_unix_begin_atomic_section(void);
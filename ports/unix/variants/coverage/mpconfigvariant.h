@@ -40,12 +40,18 @@
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_PY_SYS_SETTRACE        (1)
+#define MICROPY_GC_ALLOC_PROFILE       (1)
 #define MICROPY_TRACKED_ALLOC          (1)
 #define MICROPY_WARNINGS_CATEGORY      (1)
 #undef MICROPY_VFS_ROM_IOCTL
 #define MICROPY_VFS_ROM_IOCTL          (1)
 #define MICROPY_PY_CRYPTOLIB_CTR       (1)
 #define MICROPY_SCHEDULER_STATIC_NODES (1)
+#define MICROPY_GC_DEFERRED_FINALISERS (1)
+#define MICROPY_SCHEDULER_STATS        (1)
+#define MICROPY_OPT_VM_STACK_CACHE     (1)
+#define MICROPY_EMIT_NATIVE_TIERING    (1)
+#define MICROPY_EMIT_NATIVE_TIERING_BUDGET (1024 * 1024)
 
 // Enable os.uname for attrtuple coverage test
 #define MICROPY_PY_OS_UNAME            (1)
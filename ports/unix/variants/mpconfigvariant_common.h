@@ -69,16 +69,59 @@
 #define MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF (1)
 #define MICROPY_EMERGENCY_EXCEPTION_BUF_SIZE (256)
 
-// Allow loading of .mpy files.
+// Allow loading of .mpy files, and load functions from ROMFS when first needed.
 #define MICROPY_PERSISTENT_CODE_LOAD   (1)
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (!MICROPY_PERSISTENT_CODE_SAVE)
 
 // Extra memory debugging.
 #define MICROPY_MALLOC_USES_ALLOCATED_SIZE (1)
 #define MICROPY_MEM_STATS              (1)
 
+// Index free runs of GC blocks to keep multi-block allocations fast.
+#define MICROPY_GC_FREE_RUN_INDEX      (1)
+
+// Allow the GC sweep to be done in steps, via gc.collect_step().
+#define MICROPY_GC_INCREMENTAL         (1)
+
+// Allow the GC mark phase to use several threads, via gc.mark_threads().
+#define MICROPY_GC_PARALLEL_MARK       (MICROPY_PY_THREAD)
+
+// Allow the GC to move some object payloads down the heap, via gc.compact().
+#define MICROPY_GC_COMPACT             (1)
+
+// Allow the GC allocation threshold to adapt to targets, via gc.target().
+#define MICROPY_GC_ADAPTIVE_THRESHOLD  (1)
+
+// Let each thread allocate small objects without taking the GC mutex.
+#define MICROPY_GC_THREAD_ALLOC_BUFFER (MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL)
+
+// Let interrupt handlers and threads schedule callbacks without a lock, and
+// allow callbacks that don't fit in the queue to overflow to the heap.
+#define MICROPY_SCHEDULER_LOCK_FREE    (1)
+#define MICROPY_SCHEDULER_OVERFLOW     (1)
+
 // Enable a small performance boost for the VM.
 #define MICROPY_OPT_COMPUTED_GOTO      (1)
 
+// Give name lookups in the VM their own cache at each instruction.
+#define MICROPY_OPT_INLINE_CACHE       (1)
+
+// Memoise lookups of globals and builtins, using versions of maps.
+#define MICROPY_OPT_MAP_VERSION        (1)
+
+// Save RAM for instances of the same class by sharing their member names.
+#define MICROPY_OPT_INSTANCE_SHARED_KEYS (1)
+
+// Hash qstrs a word at a time and index the ones created at runtime.
+#define MICROPY_QSTR_HASH_WORDWISE     (1)
+#define MICROPY_QSTR_HASH_INDEX        (1)
+
+// Emit and execute fused opcodes for common sequences of opcodes.
+#define MICROPY_OPT_FUSED_OPCODES      (1)
+
+// Specialise opcodes in bytecode on the heap for the types they operate on.
+#define MICROPY_OPT_QUICKEN            (1)
+
 // Return number of collected objects from gc.collect().
 #define MICROPY_PY_GC_COLLECT_RETVAL   (1)
 
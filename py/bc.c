@@ -85,9 +85,37 @@ mp_uint_t mp_decode_uint_value(const byte *ptr) {
 const byte *mp_decode_uint_skip(const byte *ptr) {
     while ((*ptr++) & 0x80) {
     }
+
     return ptr;
 }
 
+#if MICROPY_OPT_QUICKEN
+// The generic opcode that each quickened opcode specialises, starting from
+// MP_BC_BINARY_OP_INT_MULTI.
+static const byte quickened_to_generic[] = {
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_LESS,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_MORE,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_LESS_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_MORE_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NOT_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_INPLACE_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_INPLACE_SUBTRACT,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_SUBTRACT,
+    MP_BC_LOAD_SUBSCR,
+    MP_BC_LOAD_SUBSCR,
+    MP_BC_STORE_SUBSCR,
+};
+
+byte mp_bc_unquicken(byte opcode) {
+    if (opcode >= MP_BC_BINARY_OP_INT_MULTI && opcode <= MP_BC_STORE_SUBSCR_LIST_INT) {
+        return quickened_to_generic[opcode - MP_BC_BINARY_OP_INT_MULTI];
+    }
+    return opcode;
+}
+#endif
+
 static MP_NORETURN void fun_pos_args_mismatch(mp_obj_fun_bc_t *f, size_t expected, size_t given) {
     #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
     // generic message, used also for other argument issues
@@ -325,8 +353,10 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     #if MICROPY_STACKLESS
     code_state->prev = NULL;
     #endif
-    #if MICROPY_PY_SYS_SETTRACE
+    #if MICROPY_VM_CODE_STATE_CHAIN
     code_state->prev_state = NULL;
+    #endif
+    #if MICROPY_PY_SYS_SETTRACE
     code_state->frame = NULL;
     #endif
     mp_setup_code_state_helper(code_state, n_args, n_kw, args);
@@ -51,14 +51,15 @@
 // Nibbles in magic number are: BB BB BB BB BB BO VV QU
 #define MP_BC_FORMAT(op) ((0x000003a4 >> (2 * ((op) >> 4))) & 3)
 
-// Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
-#define MP_BC_BASE_RESERVED                 (0x00) // ----------------
-#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDII---
+// Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op,
+// Fused, Quickened
+#define MP_BC_BASE_RESERVED                 (0x00) // --QQQQQQQQQQQQQ-
+#define MP_BC_BASE_QSTR_O                   (0x10) // LLLLLLSSSDDIIFF-
 #define MP_BC_BASE_VINT_E                   (0x20) // MMLLLLSSDDBBBBBB
 #define MP_BC_BASE_VINT_O                   (0x30) // UUMMCCCC--------
-#define MP_BC_BASE_JUMP_E                   (0x40) // J-JJJJJEEEEF----
+#define MP_BC_BASE_JUMP_E                   (0x40) // JFJJJJJEEEEF----
 #define MP_BC_BASE_BYTE_O                   (0x50) // LLLLSSDTTTTTEEFF
-#define MP_BC_BASE_BYTE_E                   (0x60) // --BREEEYYI------
+#define MP_BC_BASE_BYTE_E                   (0x60) // FFBREEEYYI------
 #define MP_BC_LOAD_CONST_SMALL_INT_MULTI    (0x70) // LLLLLLLLLLLLLLLL
 //                                          (0x80) // LLLLLLLLLLLLLLLL
 //                                          (0x90) // LLLLLLLLLLLLLLLL
@@ -159,4 +160,23 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// Fused opcodes, see MICROPY_OPT_FUSED_OPCODES.  The op of BINARY_OP_SMALL_INT
+// is one of ADD, SUBTRACT, INPLACE_ADD and INPLACE_SUBTRACT.
+#define MP_BC_LOAD_FAST_2                   (MP_BC_BASE_BYTE_E + 0x00) // extra byte: two locals < 16, first in high nibble
+#define MP_BC_LOAD_FAST0_ATTR               (MP_BC_BASE_QSTR_O + 0x0d) // qstr; LOAD_FAST 0 then LOAD_ATTR
+#define MP_BC_STORE_FAST0_ATTR              (MP_BC_BASE_QSTR_O + 0x0e) // qstr; LOAD_FAST 0 then STORE_ATTR
+#define MP_BC_BINARY_OP_SMALL_INT           (MP_BC_BASE_BYTE_E + 0x01) // extra byte: small int + 16, op in top 2 bits
+#define MP_BC_POP_JUMP_IF_COMPARE           (MP_BC_BASE_JUMP_E + 0x01) // signed relative bytecode offset; then a byte: op | jump-if-true << 7
+
+// Quickened opcodes, see MICROPY_OPT_QUICKEN.  These are only written by the VM
+// over the generic opcode that they specialise, and are never saved.
+#define MP_BC_BINARY_OP_INT_MULTI           (MP_BC_BASE_RESERVED + 0x02) // + op, for MP_BINARY_OP_LESS to MP_BINARY_OP_NOT_EQUAL
+#define MP_BC_BINARY_OP_INT_INPLACE_ADD     (MP_BC_BASE_RESERVED + 0x08)
+#define MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT (MP_BC_BASE_RESERVED + 0x09)
+#define MP_BC_BINARY_OP_INT_ADD             (MP_BC_BASE_RESERVED + 0x0a)
+#define MP_BC_BINARY_OP_INT_SUBTRACT        (MP_BC_BASE_RESERVED + 0x0b)
+#define MP_BC_LOAD_SUBSCR_LIST_INT          (MP_BC_BASE_RESERVED + 0x0c)
+#define MP_BC_LOAD_SUBSCR_DICT_STR          (MP_BC_BASE_RESERVED + 0x0d)
+#define MP_BC_STORE_SUBSCR_LIST_INT         (MP_BC_BASE_RESERVED + 0x0e)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
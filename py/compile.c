@@ -205,6 +205,14 @@ typedef struct _compiler_t {
     #endif
 
     mp_emit_common_t emit_common;
+
+    #if MICROPY_EMIT_NATIVE_TIERING
+    uint32_t source_hash;
+    // Function to compile with the native emitter, see mp_compile_native_tier.
+    qstr tier_name;
+    size_t tier_line;
+    mp_raw_code_t *tier_rc;
+    #endif
 } compiler_t;
 
 #if MICROPY_COMP_ALLOW_TOP_LEVEL_AWAIT
@@ -340,6 +348,14 @@ static void apply_to_single_or_list(compiler_t *comp, mp_parse_node_t pn, pn_kin
     }
 }
 
+// Whether the node is a statement that never continues on to the next statement.
+static bool compile_node_is_flow_end(mp_parse_node_t pn) {
+    return MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_return_stmt)
+           || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_raise_stmt)
+           || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_break_stmt)
+           || MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_continue_stmt);
+}
+
 static void compile_generic_all_nodes(compiler_t *comp, mp_parse_node_struct_t *pns) {
     int num_nodes = MP_PARSE_NODE_STRUCT_NUM_NODES(pns);
     for (int i = 0; i < num_nodes; i++) {
@@ -349,6 +365,11 @@ static void compile_generic_all_nodes(compiler_t *comp, mp_parse_node_struct_t *
             compile_error_set_line(comp, pns->nodes[i]);
             return;
         }
+        // optimisation: don't emit unreachable statements after return/raise/break/continue,
+        // but still include them in the scope pass so they define variables as in CPython
+        if (comp->pass > MP_PASS_SCOPE && compile_node_is_flow_end(pns->nodes[i])) {
+            return;
+        }
     }
 }
 
@@ -789,6 +810,18 @@ static qstr compile_funcdef_helper(compiler_t *comp, mp_parse_node_struct_t *pns
         scope_t *s = scope_new_and_link(comp, SCOPE_FUNCTION, (mp_parse_node_t)pns, emit_options);
         // store the function scope so the compiling function can use it at each pass
         pns->nodes[4] = (mp_parse_node_t)s;
+        #if MICROPY_EMIT_NATIVE_TIERING
+        // remember where the function is so it can be found again when promoting
+        // it, unless it was given a native emitter with a decorator
+        if (emit_options == MP_EMIT_OPT_NONE || emit_options == MP_EMIT_OPT_BYTECODE) {
+            s->raw_code->tier_line = pns->source_line;
+            s->raw_code->tier_hash = comp->source_hash;
+            if (s->simple_name == comp->tier_name && pns->source_line == comp->tier_line) {
+                s->emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+                comp->tier_rc = s->raw_code;
+            }
+        }
+        #endif
     }
 
     // get the scope for this function
@@ -2122,6 +2155,18 @@ static void compile_test_if_expr(compiler_t *comp, mp_parse_node_struct_t *pns)
     assert(MP_PARSE_NODE_IS_STRUCT_KIND(pns->nodes[1], PN_test_if_else));
     mp_parse_node_struct_t *pns_test_if_else = (mp_parse_node_struct_t *)pns->nodes[1];
 
+    // optimisation: only compile the value selected by a constant condition, except in
+    // the scope pass where both values are needed for scope analysis
+    if (comp->pass > MP_PASS_SCOPE) {
+        if (mp_parse_node_is_const_true(pns_test_if_else->nodes[0])) {
+            compile_node(comp, pns->nodes[0]);
+            return;
+        } else if (mp_parse_node_is_const_false(pns_test_if_else->nodes[0])) {
+            compile_node(comp, pns_test_if_else->nodes[1]);
+            return;
+        }
+    }
+
     uint l_fail = comp_next_label(comp);
     uint l_end = comp_next_label(comp);
     c_if_cond(comp, pns_test_if_else->nodes[0], false, l_fail); // condition
@@ -3478,18 +3523,14 @@ static void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_EXPOSE_MP_COMPILE_TO_RAW_CODE
-static
-#endif
-void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
-    // put compiler state on the stack, it's relatively small
-    compiler_t comp_state = {0};
-    compiler_t *comp = &comp_state;
-
+static void compile_to_raw_code(compiler_t *comp, mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
     comp->is_repl = is_repl;
     comp->break_label = INVALID_LABEL;
     comp->continue_label = INVALID_LABEL;
     mp_emit_common_init(&comp->emit_common, source_file);
+    #if MICROPY_EMIT_NATIVE_TIERING
+    comp->source_hash = parse_tree->source_hash;
+    #endif
 
     // create the module scope
     #if MICROPY_EMIT_NATIVE
@@ -3694,6 +3735,25 @@ emit_finished:
     }
 }
 
+#if !MICROPY_EXPOSE_MP_COMPILE_TO_RAW_CODE
+static
+#endif
+void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
+    // put compiler state on the stack, it's relatively small
+    compiler_t comp_state = {0};
+    compile_to_raw_code(&comp_state, parse_tree, source_file, is_repl, cm);
+}
+
+#if MICROPY_EMIT_NATIVE_TIERING
+mp_raw_code_t *mp_compile_native_tier(mp_parse_tree_t *parse_tree, qstr source_file, qstr name, size_t line, mp_compiled_module_t *cm) {
+    compiler_t comp_state = {0};
+    comp_state.tier_name = name;
+    comp_state.tier_line = line;
+    compile_to_raw_code(&comp_state, parse_tree, source_file, false, cm);
+    return comp_state.tier_rc;
+}
+#endif
+
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl) {
     mp_compiled_module_t cm;
     cm.context = m_new_obj(mp_module_context_t);
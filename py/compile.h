@@ -48,6 +48,13 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm);
 #endif
 
+#if MICROPY_EMIT_NATIVE_TIERING
+// this has the same semantics as mp_compile_to_raw_code, except that the
+// function with the given name whose def is on the given line is compiled
+// with the native emitter; returns its raw code, or NULL if there's none
+mp_raw_code_t *mp_compile_native_tier(mp_parse_tree_t *parse_tree, qstr source_file, qstr name, size_t line, mp_compiled_module_t *cm);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
@@ -73,6 +73,13 @@ struct _emit_t {
 
     size_t n_info;
     size_t n_cell;
+
+    #if MICROPY_OPT_FUSED_OPCODES
+    // The opcode just written, and its offset, if it may be fused with the
+    // next opcode, otherwise MP_BC_BASE_RESERVED.
+    byte fuse_opcode;
+    size_t fuse_offset;
+    #endif
 };
 
 emit_t *emit_bc_new(mp_emit_common_t *emit_common) {
@@ -145,6 +152,9 @@ static void emit_write_code_info_bytes_lines(emit_t *emit, mp_uint_t bytes_to_sk
 // all functions must go through this one to emit byte code
 static uint8_t *emit_get_cur_to_write_bytecode(void *emit_in, size_t num_bytes_to_write) {
     emit_t *emit = emit_in;
+    #if MICROPY_OPT_FUSED_OPCODES
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    #endif
     if (emit->suppress) {
         return emit->dummy_data;
     }
@@ -164,6 +174,34 @@ static void emit_write_bytecode_raw_byte(emit_t *emit, byte b1) {
     c[0] = b1;
 }
 
+#if MICROPY_OPT_FUSED_OPCODES
+// Fusing an opcode with the previous one works by going back to the offset of
+// the previous one and writing the fused opcode over it.  This is only done if
+// nothing else was written in between and no label or line number refers to
+// the offset of the second opcode.
+
+// Record that the opcode that was just written at the given offset may be
+// fused with the next one.
+static void emit_fuse_set(emit_t *emit, size_t offset, byte opcode) {
+    if (MP_EMIT_FUSED_OPCODES && !emit->suppress) {
+        emit->fuse_opcode = opcode;
+        emit->fuse_offset = offset;
+    }
+}
+
+// If the previous opcode may be fused and is in the range first to last, then
+// remove it and return it, otherwise return MP_BC_BASE_RESERVED.
+static byte emit_fuse_take(emit_t *emit, byte first, byte last) {
+    byte opcode = emit->fuse_opcode;
+    if (first <= opcode && opcode <= last) {
+        emit->bytecode_offset = emit->fuse_offset;
+        emit->fuse_opcode = MP_BC_BASE_RESERVED;
+        return opcode;
+    }
+    return MP_BC_BASE_RESERVED;
+}
+#endif
+
 static void emit_write_bytecode_byte(emit_t *emit, int stack_adj, byte b1) {
     mp_emit_bc_adjust_stack_size(emit, stack_adj);
     byte *c = emit_get_cur_to_write_bytecode(emit, 1);
@@ -290,6 +328,9 @@ void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     emit->bytecode_offset = 0;
     emit->code_info_offset = 0;
     emit->overflow = false;
+    #if MICROPY_OPT_FUSED_OPCODES
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    #endif
 
     // Write local state size, exception stack size, scope flags and number of arguments
     {
@@ -442,6 +483,9 @@ void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t source_line) {
         emit_write_code_info_bytes_lines(emit, bytes_to_skip, lines_to_skip);
         emit->last_source_line_offset = emit->bytecode_offset;
         emit->last_source_line = source_line;
+        #if MICROPY_OPT_FUSED_OPCODES
+        emit->fuse_opcode = MP_BC_BASE_RESERVED;
+        #endif
     }
     #else
     (void)emit;
@@ -454,6 +498,11 @@ void mp_emit_bc_label_assign(emit_t *emit, mp_uint_t l) {
     // should be emitted (until another unconditional flow control).
     emit->suppress = false;
 
+    #if MICROPY_OPT_FUSED_OPCODES
+    // The next opcode can be jumped to, so can't be fused with the previous one.
+    emit->fuse_opcode = MP_BC_BASE_RESERVED;
+    #endif
+
     if (emit->pass == MP_PASS_SCOPE) {
         return;
     }
@@ -494,8 +543,14 @@ void mp_emit_bc_load_const_small_int(emit_t *emit, mp_int_t arg) {
     assert(MP_SMALL_INT_FITS(arg));
     if (-MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS <= arg
         && arg < MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS) {
+        #if MICROPY_OPT_FUSED_OPCODES
+        size_t offset = emit->bytecode_offset;
+        #endif
         emit_write_bytecode_byte(emit, 1,
             MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS + arg);
+        #if MICROPY_OPT_FUSED_OPCODES
+        emit_fuse_set(emit, offset, MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS + arg);
+        #endif
     } else {
         emit_write_bytecode_byte_int(emit, 1, MP_BC_LOAD_CONST_SMALL_INT, arg);
     }
@@ -518,7 +573,19 @@ void mp_emit_bc_load_local(emit_t *emit, qstr qst, mp_uint_t local_num, int kind
     MP_STATIC_ASSERT(MP_BC_LOAD_FAST_N + MP_EMIT_IDOP_LOCAL_DEREF == MP_BC_LOAD_DEREF);
     (void)qst;
     if (kind == MP_EMIT_IDOP_LOCAL_FAST && local_num <= 15) {
+        #if MICROPY_OPT_FUSED_OPCODES
+        byte prev = emit_fuse_take(emit, MP_BC_LOAD_FAST_MULTI, MP_BC_LOAD_FAST_MULTI + 15);
+        if (prev != MP_BC_BASE_RESERVED) {
+            emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_2);
+            emit_write_bytecode_raw_byte(emit, (prev - MP_BC_LOAD_FAST_MULTI) << 4 | local_num);
+            return;
+        }
+        size_t offset = emit->bytecode_offset;
+        #endif
         emit_write_bytecode_byte(emit, 1, MP_BC_LOAD_FAST_MULTI + local_num);
+        #if MICROPY_OPT_FUSED_OPCODES
+        emit_fuse_set(emit, offset, MP_BC_LOAD_FAST_MULTI + local_num);
+        #endif
     } else {
         emit_write_bytecode_byte_uint(emit, 1, MP_BC_LOAD_FAST_N + kind, local_num);
     }
@@ -553,6 +620,18 @@ void mp_emit_bc_subscr(emit_t *emit, int kind) {
 }
 
 void mp_emit_bc_attr(emit_t *emit, qstr qst, int kind) {
+    #if MICROPY_OPT_FUSED_OPCODES
+    if (kind != MP_EMIT_ATTR_DELETE
+        && emit_fuse_take(emit, MP_BC_LOAD_FAST_MULTI, MP_BC_LOAD_FAST_MULTI) != MP_BC_BASE_RESERVED) {
+        // The object is local 0, usually self.
+        if (kind == MP_EMIT_ATTR_LOAD) {
+            emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_FAST0_ATTR, qst);
+        } else {
+            emit_write_bytecode_byte_qstr(emit, -2, MP_BC_STORE_FAST0_ATTR, qst);
+        }
+        return;
+    }
+    #endif
     if (kind == MP_EMIT_ATTR_LOAD) {
         emit_write_bytecode_byte_qstr(emit, 0, MP_BC_LOAD_ATTR, qst);
     } else {
@@ -620,6 +699,14 @@ void mp_emit_bc_jump(emit_t *emit, mp_uint_t label) {
 }
 
 void mp_emit_bc_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
+    #if MICROPY_OPT_FUSED_OPCODES
+    byte prev = emit_fuse_take(emit, MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_LESS, MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_IS);
+    if (prev != MP_BC_BASE_RESERVED) {
+        emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_COMPARE, label);
+        emit_write_bytecode_raw_byte(emit, (prev - MP_BC_BINARY_OP_MULTI) | cond << 7);
+        return;
+    }
+    #endif
     if (cond) {
         emit_write_bytecode_byte_label(emit, -1, MP_BC_POP_JUMP_IF_TRUE, label);
     } else {
@@ -729,7 +816,27 @@ void mp_emit_bc_binary_op(emit_t *emit, mp_binary_op_t op) {
         invert = true;
         op = MP_BINARY_OP_IS;
     }
+    #if MICROPY_OPT_FUSED_OPCODES
+    byte prev = MP_BC_BASE_RESERVED;
+    if (op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_SUBTRACT
+        || op == MP_BINARY_OP_INPLACE_ADD || op == MP_BINARY_OP_INPLACE_SUBTRACT) {
+        prev = emit_fuse_take(emit, MP_BC_LOAD_CONST_SMALL_INT_MULTI,
+            MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1);
+    }
+    if (prev != MP_BC_BASE_RESERVED) {
+        // The right-hand side is a small int from -16 to 47.
+        emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_SMALL_INT);
+        emit_write_bytecode_raw_byte(emit, (prev - MP_BC_LOAD_CONST_SMALL_INT_MULTI)
+            | (op == MP_BINARY_OP_SUBTRACT || op == MP_BINARY_OP_INPLACE_SUBTRACT) << 6
+            | (op == MP_BINARY_OP_INPLACE_ADD || op == MP_BINARY_OP_INPLACE_SUBTRACT) << 7);
+    } else {
+        size_t offset = emit->bytecode_offset;
+        emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+        emit_fuse_set(emit, offset, MP_BC_BINARY_OP_MULTI + op);
+    }
+    #else
     emit_write_bytecode_byte(emit, -1, MP_BC_BINARY_OP_MULTI + op);
+    #endif
     if (invert) {
         emit_write_bytecode_byte(emit, 0, MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NOT);
     }
@@ -35,7 +35,9 @@
 #include "py/mphal.h"
 #include "py/runtime0.h"
 #include "py/bc.h"
+#include "py/gc.h"
 #include "py/objfun.h"
+#include "py/persistentcode.h"
 #include "py/profile.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -150,6 +152,10 @@ void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, cons
     rc->asm_type_sig = asm_type_sig;
     #endif
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    rc->tier_size = fun_len;
+    #endif
+
     #if DEBUG_PRINT
     DEBUG_printf("assign native: kind=%d fun=%p len=" UINT_FMT " flags=%x\n", kind, fun_data, fun_len, (uint)scope_flags);
     for (mp_uint_t i = 0; i < fun_len; i++) {
@@ -181,7 +187,7 @@ mp_obj_t mp_make_function_from_proto_fun(mp_proto_fun_t proto_fun, const mp_modu
     // def_kw_args must be MP_OBJ_NULL or a dict
     assert(def_args == NULL || def_args[1] == MP_OBJ_NULL || mp_obj_is_type(def_args[1], &mp_type_dict));
 
-    #if MICROPY_MODULE_FROZEN_MPY || MICROPY_PY_FUNCTION_ATTRS_CODE
+    #if MICROPY_MODULE_FROZEN_MPY || MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PY_FUNCTION_ATTRS_CODE
     if (mp_proto_fun_is_bytecode(proto_fun)) {
         const uint8_t *bc = proto_fun;
         mp_obj_t fun = mp_obj_new_fun_bc(def_args, bc, context, NULL);
@@ -196,6 +202,13 @@ mp_obj_t mp_make_function_from_proto_fun(mp_proto_fun_t proto_fun, const mp_modu
     // the proto-function is a mp_raw_code_t
     const mp_raw_code_t *rc = proto_fun;
 
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    if (rc->kind == MP_CODE_BYTECODE_LAZY) {
+        // load the function from its .mpy file now that it's needed
+        mp_raw_code_load_lazy((mp_raw_code_t *)rc);
+    }
+    #endif
+
     // make the function, depending on the raw code kind
     mp_obj_t fun;
     switch (rc->kind) {
@@ -230,6 +243,26 @@ mp_obj_t mp_make_function_from_proto_fun(mp_proto_fun_t proto_fun, const mp_modu
             self_fun->rc = rc;
             #endif
 
+            #if MICROPY_OPT_INLINE_CACHE
+            // share the inline cache with other functions made from the same
+            // raw code, eg each time a list comprehension runs, unless the raw
+            // code is in ROM
+            if (gc_is_heap_ptr(rc)) {
+                mp_obj_fun_bc_t *cache_fun = (mp_obj_fun_bc_t *)MP_OBJ_TO_PTR(fun);
+                cache_fun->inline_cache = rc->inline_cache;
+                cache_fun->inline_cache_rc = (mp_raw_code_t *)rc;
+            }
+            #endif
+
+            #if MICROPY_EMIT_NATIVE_TIERING
+            // count calls against the raw code if it may be promoted to native
+            // code (tier_line is only set for functions compiled from source,
+            // so a raw code in ROM is never written to)
+            if (rc->tier_line != 0 && !rc->is_generator) {
+                ((mp_obj_fun_bc_t *)MP_OBJ_TO_PTR(fun))->tier_rc = (mp_raw_code_t *)rc;
+            }
+            #endif
+
             break;
     }
 
@@ -52,6 +52,7 @@ typedef enum {
     MP_CODE_NATIVE_PY,
     MP_CODE_NATIVE_VIPER,
     MP_CODE_NATIVE_ASM,
+    MP_CODE_BYTECODE_LAZY, // not yet loaded from a .mpy file, see MICROPY_PERSISTENT_CODE_LOAD_LAZY
 } mp_raw_code_kind_t;
 
 // An mp_proto_fun_t points to static information about a non-instantiated function.
@@ -69,7 +70,8 @@ static inline bool mp_proto_fun_is_bytecode(mp_proto_fun_t proto_fun) {
 
 // The mp_raw_code_t struct appears in the following places:
 // compiled bytecode: instance in RAM, referenced by outer scope, usually freed after first (and only) use
-// mpy file: instance in RAM, created when .mpy file is loaded (same comments as above)
+// mpy file: instance in RAM, created when .mpy file is loaded (same comments as above),
+//           except for bytecode without children which is referenced directly
 // frozen: instance in ROM
 typedef struct _mp_raw_code_t {
     uint8_t proto_fun_indicator[2];
@@ -77,6 +79,22 @@ typedef struct _mp_raw_code_t {
     bool is_generator;
     const void *fun_data;
     struct _mp_raw_code_t **children;
+    #if MICROPY_OPT_INLINE_CACHE
+    // Shared by the functions made from this raw code, if it's in RAM.
+    struct _mp_inline_cache_t *inline_cache;
+    #endif
+    #if MICROPY_EMIT_NATIVE_TIERING
+    // State for promoting this function to native code, see py/nativetier.c.
+    // tier_line is the source line of the def, or 0 if it can't be promoted.
+    // tier_hash is the hash of the source that it was compiled from.
+    // tier_count counts calls and branches.
+    // tier_size is the size of native code, which counts against the budget.
+    uint32_t tier_line;
+    uint32_t tier_hash;
+    uint32_t tier_count;
+    uint32_t tier_size;
+    struct _mp_obj_fun_bc_t *tier_native;
+    #endif
     #if MICROPY_PERSISTENT_CODE_SAVE
     uint32_t fun_data_len; // for mp_raw_code_save
     uint16_t n_children;
@@ -107,6 +125,16 @@ typedef struct _mp_raw_code_truncated_t {
     bool is_generator;
     const void *fun_data;
     struct _mp_raw_code_t **children;
+    #if MICROPY_OPT_INLINE_CACHE
+    struct _mp_inline_cache_t *inline_cache;
+    #endif
+    #if MICROPY_EMIT_NATIVE_TIERING
+    uint32_t tier_line;
+    uint32_t tier_hash;
+    uint32_t tier_count;
+    uint32_t tier_size;
+    struct _mp_obj_fun_bc_t *tier_native;
+    #endif
     #if MICROPY_PERSISTENT_CODE_SAVE
     uint32_t fun_data_len;
     uint16_t n_children;
@@ -197,6 +197,7 @@ typedef enum {
     VTYPE_PTR8 = 0x00 | MP_NATIVE_TYPE_PTR8,
     VTYPE_PTR16 = 0x00 | MP_NATIVE_TYPE_PTR16,
     VTYPE_PTR32 = 0x00 | MP_NATIVE_TYPE_PTR32,
+    VTYPE_FLOAT = 0x00 | MP_NATIVE_TYPE_FLOAT,
 
     VTYPE_PTR_NONE = 0x50 | MP_NATIVE_TYPE_PTR,
 
@@ -223,6 +224,10 @@ static qstr vtype_to_qstr(vtype_kind_t vtype) {
             return MP_QSTR_ptr16;
         case VTYPE_PTR32:
             return MP_QSTR_ptr32;
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case VTYPE_FLOAT:
+            return MP_QSTR_float;
+        #endif
         case VTYPE_PTR_NONE:
         default:
             return MP_QSTR_None;
@@ -2332,6 +2337,8 @@ static void emit_native_pop_except_jump(emit_t *emit, mp_uint_t label, bool with
     emit_native_jump(emit, label);
 }
 
+static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op);
+
 static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     vtype_kind_t vtype = peek_vtype(emit, 0);
     if (vtype == VTYPE_INT || vtype == VTYPE_UINT) {
@@ -2358,6 +2365,14 @@ static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
             EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                 MP_ERROR_TEXT("'not' not implemented"), mp_binary_op_method_name[op]);
         }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (vtype == VTYPE_FLOAT && (op == MP_UNARY_OP_POSITIVE || op == MP_UNARY_OP_NEGATIVE)) {
+        if (op == MP_UNARY_OP_NEGATIVE) {
+            // Negate by multiplying by -1, which keeps the sign of zero right.
+            emit_post_push_imm(emit, VTYPE_INT, -1);
+            emit_native_binary_op(emit, MP_BINARY_OP_MULTIPLY);
+        }
+    #endif
     } else if (vtype == VTYPE_PYOBJ) {
         emit_pre_pop_reg(emit, &vtype, REG_ARG_2);
         emit_call_with_imm_arg(emit, MP_F_UNARY_OP, op, REG_ARG_1);
@@ -2368,6 +2383,51 @@ static void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     }
 }
 
+#if MICROPY_PY_BUILTINS_FLOAT
+// Convert the object at the given position on the stack (1 is the top) to a
+// viper float, in place.
+static void emit_native_stack_obj_to_float(emit_t *emit, int pos) {
+    vtype_kind_t vtype;
+    emit_access_stack(emit, pos, &vtype, REG_ARG_1);
+    emit_call_with_imm_arg(emit, MP_F_CONVERT_OBJ_TO_NATIVE, VTYPE_FLOAT, REG_ARG_2);
+    stack_info_t *si = &emit->stack_info[emit->stack_size - pos];
+    si->vtype = VTYPE_FLOAT;
+    si->kind = STACK_REG;
+    si->data.u_reg = REG_RET;
+}
+
+// Arithmetic where one argument is a float and the other is a float, an int
+// or an object.  The result stays unboxed in a machine word.
+static void emit_native_binary_op_float(emit_t *emit, mp_binary_op_t op, vtype_kind_t vtype_lhs, vtype_kind_t vtype_rhs) {
+    // floats are immutable, so inplace and normal ops are equivalent
+    if (MP_BINARY_OP_INPLACE_OR <= op && op <= MP_BINARY_OP_INPLACE_POWER) {
+        op += MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR;
+    }
+    bool is_comparison = op <= MP_BINARY_OP_NOT_EQUAL;
+    if (!is_comparison && (op < MP_BINARY_OP_ADD || op > MP_BINARY_OP_POWER || op == MP_BINARY_OP_MAT_MULTIPLY)) {
+        adjust_stack(emit, -1);
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            MP_ERROR_TEXT("binary op %q not implemented"), mp_binary_op_method_name[op]);
+        return;
+    }
+    if (vtype_lhs == VTYPE_PYOBJ) {
+        emit_native_stack_obj_to_float(emit, 2);
+    } else if (vtype_rhs == VTYPE_PYOBJ) {
+        emit_native_stack_obj_to_float(emit, 1);
+    }
+    emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
+    mp_uint_t op_flags = op;
+    if (vtype_lhs == VTYPE_INT) {
+        op_flags |= MP_NATIVE_FLOAT_OP_LHS_INT;
+    }
+    if (vtype_rhs == VTYPE_INT) {
+        op_flags |= MP_NATIVE_FLOAT_OP_RHS_INT;
+    }
+    emit_call_with_imm_arg(emit, MP_F_NATIVE_FLOAT_OP, op_flags, REG_ARG_1);
+    emit_post_push_reg(emit, is_comparison ? VTYPE_BOOL : VTYPE_FLOAT, REG_RET);
+}
+#endif
+
 static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
     DEBUG_printf("binary_op(" UINT_FMT ")\n", op);
     vtype_kind_t vtype_lhs = peek_vtype(emit, 1);
@@ -2638,6 +2698,11 @@ static void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
             EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
                 MP_ERROR_TEXT("binary op %q not implemented"), mp_binary_op_method_name[op]);
         }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if ((vtype_lhs == VTYPE_FLOAT && (vtype_rhs == VTYPE_FLOAT || vtype_rhs == VTYPE_INT || vtype_rhs == VTYPE_PYOBJ))
+               || (vtype_rhs == VTYPE_FLOAT && (vtype_lhs == VTYPE_INT || vtype_lhs == VTYPE_PYOBJ))) {
+        emit_native_binary_op_float(emit, op, vtype_lhs, vtype_rhs);
+    #endif
     } else if (vtype_lhs == VTYPE_PYOBJ && vtype_rhs == VTYPE_PYOBJ) {
         emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
         bool invert = false;
@@ -2812,6 +2877,48 @@ static void emit_native_make_closure(emit_t *emit, scope_t *scope, mp_uint_t n_c
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
+#if MICROPY_PY_BUILTINS_FLOAT
+// Cast the value on top of the stack to or from a float, which converts it
+// rather than reinterpreting its bits.  The cast itself is below it.
+static void emit_native_cast_float(emit_t *emit, vtype_kind_t vtype_cast) {
+    vtype_kind_t vtype = peek_vtype(emit, 0);
+    if (vtype == vtype_cast) {
+        // float(float)
+        emit_fold_stack_top(emit, REG_ARG_1);
+    } else if (vtype_cast == VTYPE_FLOAT && vtype == VTYPE_PYOBJ) {
+        emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
+        emit_pre_pop_discard(emit);
+        emit_call_with_imm_arg(emit, MP_F_CONVERT_OBJ_TO_NATIVE, VTYPE_FLOAT, REG_ARG_2);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_RET);
+    } else if (vtype_cast == VTYPE_FLOAT && (vtype == VTYPE_INT || vtype == VTYPE_BOOL)) {
+        // float(x) is x + 0, done as floats
+        emit_pre_pop_reg(emit, &vtype, REG_ARG_2);
+        emit_pre_pop_discard(emit);
+        ASM_MOV_REG_IMM(emit->as, REG_ARG_3, 0);
+        emit_call_with_imm_arg(emit, MP_F_NATIVE_FLOAT_OP,
+            MP_BINARY_OP_ADD | MP_NATIVE_FLOAT_OP_LHS_INT | MP_NATIVE_FLOAT_OP_RHS_INT, REG_ARG_1);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_RET);
+    } else if (vtype == VTYPE_FLOAT && (vtype_cast == VTYPE_INT || vtype_cast == VTYPE_UINT)) {
+        emit_pre_pop_reg(emit, &vtype, REG_ARG_2);
+        emit_pre_pop_discard(emit);
+        emit_call_with_imm_arg(emit, MP_F_NATIVE_FLOAT_OP, MP_NATIVE_FLOAT_OP_TO_INT, REG_ARG_1);
+        emit_post_push_reg(emit, vtype_cast, REG_RET);
+    } else if (vtype == VTYPE_FLOAT && vtype_cast == VTYPE_BOOL) {
+        // bool(x) is x != 0
+        emit_pre_pop_reg(emit, &vtype, REG_ARG_2);
+        emit_pre_pop_discard(emit);
+        ASM_MOV_REG_IMM(emit->as, REG_ARG_3, 0);
+        emit_call_with_imm_arg(emit, MP_F_NATIVE_FLOAT_OP,
+            MP_BINARY_OP_NOT_EQUAL | MP_NATIVE_FLOAT_OP_RHS_INT, REG_ARG_1);
+        emit_post_push_reg(emit, VTYPE_BOOL, REG_RET);
+    } else {
+        adjust_stack(emit, -1);
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            MP_ERROR_TEXT("can't cast '%q' to '%q'"), vtype_to_qstr(vtype), vtype_to_qstr(vtype_cast));
+    }
+}
+#endif
+
 static void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_uint_t n_keyword, mp_uint_t star_flags) {
     DEBUG_printf("call_function(n_pos=" UINT_FMT ", n_kw=" UINT_FMT ", star_flags=" UINT_FMT ")\n", n_positional, n_keyword, star_flags);
 
@@ -2826,6 +2933,12 @@ static void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
         assert(!star_flags);
         DEBUG_printf("  cast to %d\n", vtype_fun);
         vtype_kind_t vtype_cast = peek_stack(emit, 1)->data.u_imm;
+        #if MICROPY_PY_BUILTINS_FLOAT
+        if (vtype_cast == VTYPE_FLOAT || peek_vtype(emit, 0) == VTYPE_FLOAT) {
+            emit_native_cast_float(emit, vtype_cast);
+            return;
+        }
+        #endif
         switch (peek_vtype(emit, 0)) {
             case VTYPE_PYOBJ: {
                 vtype_kind_t vtype;
@@ -102,6 +102,7 @@ static const char *const fun_name_table[MP_F_NUMBER_OF] = {
     [MP_F_SMALL_INT_MODULO] = "small_int_modulo",
     [MP_F_NATIVE_YIELD_FROM] = "native_yield_from",
     [MP_F_SETJMP] = "setjmp",
+    [MP_F_NATIVE_FLOAT_OP] = "native_float_op",
 };
 
 static void asm_debug_end_pass(asm_debug_t *as) {
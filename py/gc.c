@@ -36,6 +36,23 @@
 #include <valgrind/memcheck.h>
 #endif
 
+#if MICROPY_GC_ALLOC_PROFILE
+#include "py/bc.h"
+#include "py/objfun.h"
+#endif
+
+#if MICROPY_GC_ADAPTIVE_THRESHOLD
+#include "py/mphal.h"
+#endif
+
+#if MICROPY_GC_COMPACT
+#include "py/binary.h"
+#include "py/objarray.h"
+#include "py/objlist.h"
+#include "py/objstr.h"
+#include "py/objtype.h"
+#endif
+
 #if MICROPY_ENABLE_GC
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -119,6 +136,22 @@
 #define WTB_CLEAR(area, block) do { area->gc_weakref_table_start[(block) / BLOCKS_PER_WTB] &= (~(1 << ((block) & 7))); } while (0)
 #endif
 
+#if MICROPY_GC_INCREMENTAL
+// Values of gc_sweep_phase
+#define GC_SWEEP_PHASE_NONE (0)
+#define GC_SWEEP_PHASE_REQUESTED (1) // the next collection will leave its sweep pending
+#define GC_SWEEP_PHASE_FINALISE (2) // running finalisers
+#define GC_SWEEP_PHASE_FREE (3) // freeing blocks
+#define GC_SWEEP_PENDING() (MP_STATE_MEM(gc_sweep_phase) >= GC_SWEEP_PHASE_FINALISE)
+#else
+#define GC_SWEEP_PENDING() (0)
+#endif
+
+#if MICROPY_GC_FREE_RUN_INDEX
+// Size class c of the free-run index covers runs of at least this many blocks.
+#define FREE_RUN_CLASS_BLOCKS(c) ((size_t)2 << (c))
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_MUTEX_INIT() mp_thread_recursive_mutex_init(&MP_STATE_MEM(gc_mutex))
 #define GC_ENTER() mp_thread_recursive_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
@@ -139,8 +172,85 @@ static void gc_mark_subtree(mp_state_mem_area_t *area, size_t block);
 static void gc_mark_subtree(size_t block);
 #endif
 static void gc_deal_with_stack_overflow(void);
+#if MICROPY_GC_PARALLEL_MARK
+static bool gc_mark_deque_push(mp_state_mem_mark_deque_t *dq, void *ptr);
+static void gc_mark_parallel(bool rescan);
+#endif
 static void gc_sweep_run_finalisers(void);
+#if MICROPY_PY_WEAKREF
+static void gc_sweep_weakrefs(const mp_state_mem_area_t *area, size_t wtb_idx);
+#endif
 static void gc_sweep_free_blocks(void);
+#if MICROPY_GC_COMPACT
+static void gc_compact_count(const void *ptr, bool past_end);
+#endif
+
+#if MICROPY_GC_FREE_RUN_INDEX
+// Smallest size class whose runs can hold n_blocks (capped at the largest class).
+static size_t gc_free_run_class_ceil(size_t n_blocks) {
+    size_t c = 0;
+    while (c + 1 < MICROPY_GC_FREE_RUN_NUM_CLASSES && FREE_RUN_CLASS_BLOCKS(c) < n_blocks) {
+        c++;
+    }
+    return c;
+}
+
+// Largest size class whose runs are no longer than n_blocks (n_blocks >= 2).
+static size_t gc_free_run_class_floor(size_t n_blocks) {
+    size_t c = 0;
+    while (c + 1 < MICROPY_GC_FREE_RUN_NUM_CLASSES && FREE_RUN_CLASS_BLOCKS(c + 1) <= n_blocks) {
+        c++;
+    }
+    return c;
+}
+
+// Record that blocks [start, end) form a free run.
+static void gc_free_run_add(mp_state_mem_area_t *area, size_t start, size_t end) {
+    size_t atb_index = start / BLOCKS_PER_ATB;
+    for (size_t c = 0; c < MICROPY_GC_FREE_RUN_NUM_CLASSES && FREE_RUN_CLASS_BLOCKS(c) <= end - start; c++) {
+        if (atb_index < area->gc_free_run_atb_index[c]) {
+            area->gc_free_run_atb_index[c] = atb_index;
+        }
+    }
+}
+
+// Blocks [start, end) were just freed outside of a sweep.  They may have joined
+// free neighbours, so extend the run in both directions before recording it.
+// A neighbouring run at least as long as the largest class is already covered
+// by the index, so there is no need to walk further than that.
+static void gc_free_run_freed(mp_state_mem_area_t *area, size_t start, size_t end) {
+    size_t limit = FREE_RUN_CLASS_BLOCKS(MICROPY_GC_FREE_RUN_NUM_CLASSES - 1);
+    size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    for (size_t n = 0; n < limit && start > 0 && ATB_GET_KIND(area, start - 1) == AT_FREE; n++) {
+        start--;
+    }
+    for (size_t n = 0; n < limit && end < max_block && ATB_GET_KIND(area, end) == AT_FREE; n++) {
+        end++;
+    }
+    gc_free_run_add(area, start, end);
+}
+
+// The sweep found a used block; close off the free run before it, if any, and
+// return the start of the next potential run.
+static inline size_t gc_free_run_sweep_used(mp_state_mem_area_t *area, size_t free_run_start, size_t block) {
+    if (block > free_run_start) {
+        gc_free_run_add(area, free_run_start, block);
+    }
+    return block + 1;
+}
+
+// A scan for n_blocks, starting from a point before which no such run exists,
+// either stopped at end_block or (if end_block is the end of the area) found
+// nothing.  No run of n_blocks or more can start before the block after it.
+static void gc_free_run_advance(mp_state_mem_area_t *area, size_t n_blocks, size_t end_block) {
+    size_t atb_index = (end_block + 1) / BLOCKS_PER_ATB;
+    for (size_t c = gc_free_run_class_ceil(n_blocks); c < MICROPY_GC_FREE_RUN_NUM_CLASSES; c++) {
+        if (FREE_RUN_CLASS_BLOCKS(c) >= n_blocks && area->gc_free_run_atb_index[c] < atb_index) {
+            area->gc_free_run_atb_index[c] = atb_index;
+        }
+    }
+}
+#endif
 
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
@@ -202,6 +312,9 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         );
 
     area->gc_last_free_atb_index = 0;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    memset(area->gc_free_run_atb_index, 0, sizeof(area->gc_free_run_atb_index));
+    #endif
     area->gc_last_used_block = 0;
 
     #if MICROPY_GC_SPLIT_HEAP
@@ -248,12 +361,51 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    #if MICROPY_GC_PARALLEL_MARK
+    // mark on a single thread, until told otherwise
+    MP_STATE_MEM(gc_mark_threads) = 1;
+    MP_STATE_MEM(gc_mark_deque) = NULL;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL
+    MP_STATE_MEM(gc_sweep_phase) = GC_SWEEP_PHASE_NONE;
+    #endif
+
+    #if MICROPY_GC_ALLOC_PROFILE
+    MP_STATE_MEM(gc_alloc_profile_period) = 0;
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // run finalisers during the sweep, until told otherwise
+    MP_STATE_MEM(gc_finaliser_batch) = 0;
+    MP_STATE_MEM(gc_finaliser_inline) = false;
+    MP_STATE_MEM(gc_finaliser_queue_len) = 0;
+    MP_STATE_MEM(gc_finalisers_run) = 0;
+    #endif
+
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // any buffers left over from a previous heap are no longer valid
+    memset(MP_STATE_THREAD(gc_alloc_buffer), 0, sizeof(MP_STATE_THREAD(gc_alloc_buffer)));
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    MP_STATE_MEM(gc_target_pause_us) = 0;
+    MP_STATE_MEM(gc_target_overhead_pct) = 0;
+    MP_STATE_MEM(gc_stats_collections) = 0;
+    MP_STATE_MEM(gc_stats_used_blocks) = 0;
+    MP_STATE_MEM(gc_stats_alloc_rate) = 0;
+    MP_STATE_MEM(gc_stats_survival_pct) = 0;
+    MP_STATE_MEM(gc_stats_pause_us) = 0;
+    MP_STATE_MEM(gc_stats_max_pause_us) = 0;
+    MP_STATE_MEM(gc_stats_total_pause_us) = 0;
+    #endif
+
     GC_MUTEX_INIT();
 }
 
@@ -391,6 +543,16 @@ bool gc_is_locked(void) {
     return MP_STATE_THREAD(gc_lock_depth) != 0;
 }
 
+// Returns whether ptr points into the GC heap, anywhere within a block.
+bool gc_is_heap_ptr(const void *ptr) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        if (ptr >= (void *)area->gc_pool_start && ptr < (void *)area->gc_pool_end) {
+            return true;
+        }
+    }
+    return false;
+}
+
 #if MICROPY_GC_SPLIT_HEAP
 // Returns the area to which this pointer belongs, or NULL if it isn't
 // allocated on the GC-managed heap.
@@ -435,7 +597,14 @@ static inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
 #endif
 
 void gc_collect_start(void) {
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    mp_uint_t start_us = mp_hal_ticks_us();
+    #endif
     gc_collect_start_common();
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    MP_STATE_MEM(gc_stats_start_us) = start_us;
+    MP_STATE_MEM(gc_stats_alloc_blocks) = MP_STATE_MEM(gc_alloc_amount);
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
@@ -453,16 +622,47 @@ void gc_collect_start(void) {
     ptrs = (void **)(void *)MP_STATE_THREAD(pystack_start);
     gc_collect_root(ptrs, (MP_STATE_THREAD(pystack_cur) - MP_STATE_THREAD(pystack_start)) / sizeof(void *));
     #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // Keep objects alive until their queued finaliser has run.
+    gc_collect_root(MP_STATE_MEM(gc_finaliser_queue), MP_STATE_MEM(gc_finaliser_queue_len));
+    #endif
 }
 
 static void gc_collect_start_common(void) {
+    #if MICROPY_GC_INCREMENTAL
+    // Complete any pending sweep before marking again.
+    gc_sweep_finish();
+    #endif
     GC_ENTER();
     assert((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) == 0);
     MP_STATE_THREAD(gc_lock_depth) |= GC_COLLECT_FLAG;
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    if (MP_STATE_MEM(gc_finaliser_inline)) {
+        // Forget the queue, so that its objects are finalised by this sweep
+        // if they are unreachable.
+        MP_STATE_MEM(gc_finaliser_queue_len) = 0;
+    }
+    #endif
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // Retire all allocation buffers.  This must happen before other threads
+    // are scanned: a thread that already checked its buffer's epoch will take
+    // at most the object at its buffer's next pointer, which the scan of that
+    // thread's state marks.  The rest of each buffer is freed by this sweep.
+    MP_STATE_MEM(gc_alloc_buffer_epoch) += 1;
+    #endif
 }
 
 void gc_collect_root(void **ptrs, size_t len) {
+    #if MICROPY_GC_COMPACT
+    if (MP_STATE_MEM(gc_compact_census)) {
+        for (size_t i = 0; i < len; i++) {
+            gc_compact_count(gc_get_ptr(ptrs, i), true);
+        }
+        return;
+    }
+    #endif
     #if !MICROPY_GC_SPLIT_HEAP
     mp_state_mem_area_t *area = &MP_STATE_MEM(area);
     #endif
@@ -484,6 +684,13 @@ void gc_collect_root(void **ptrs, size_t len) {
             // An unmarked head: mark it, and mark all its children
             TRACE_MARK_R(ptr_block, ptr);
             ATB_HEAD_TO_MARK(area, block);
+            #if MICROPY_GC_PARALLEL_MARK
+            // Leave its children to the parallel mark in gc_collect_end().
+            if (MP_STATE_MEM(gc_mark_threads) > 1
+                && gc_mark_deque_push(&MP_STATE_MEM(gc_mark_deque)[0], (void *)PTR_FROM_BLOCK(area, block))) {
+                continue;
+            }
+            #endif
             #if MICROPY_GC_SPLIT_HEAP
             gc_mark_subtree(area, block);
             #else
@@ -571,13 +778,364 @@ static void gc_mark_subtree(size_t block)
     }
 }
 
+#if MICROPY_GC_PARALLEL_MARK
+// The parallel mark phase.  Each thread marks blocks from its own deque, then
+// steals from the other deques when it runs out.  Mark bits are set with an
+// atomic OR, so that each block is pushed by exactly one thread.  Other bits
+// of the ATB don't change while marking, so they can be read without atomics.
+
+static bool gc_mark_deque_push(mp_state_mem_mark_deque_t *dq, void *ptr) {
+    mp_int_t b = dq->bottom;
+    mp_int_t t = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+    if (b - t >= MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE) {
+        return false;
+    }
+    __atomic_store_n(&dq->ptrs[b % MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE], ptr, __ATOMIC_RELAXED);
+    __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// Take the most recently pushed block, only called by the owning thread.
+static void *gc_mark_deque_pop(mp_state_mem_mark_deque_t *dq) {
+    mp_int_t b = dq->bottom - 1;
+    __atomic_store_n(&dq->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    mp_int_t t = __atomic_load_n(&dq->top, __ATOMIC_RELAXED);
+    if (t > b) {
+        // Empty.
+        __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    void *ptr = __atomic_load_n(&dq->ptrs[b % MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE], __ATOMIC_RELAXED);
+    if (t == b) {
+        // The last entry, race any thieves for it.
+        if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+            ptr = NULL;
+        }
+        __atomic_store_n(&dq->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return ptr;
+}
+
+// Take the oldest block, called by threads other than the owner.
+static void *gc_mark_deque_steal(mp_state_mem_mark_deque_t *dq) {
+    mp_int_t t = __atomic_load_n(&dq->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    mp_int_t b = __atomic_load_n(&dq->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b) {
+        return NULL;
+    }
+    void *ptr = __atomic_load_n(&dq->ptrs[t % MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&dq->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        // Lost the race with another thread.
+        return NULL;
+    }
+    return ptr;
+}
+
+// Mark the unmarked children of the given block and push them on the deque.
+static void gc_mark_parallel_scan(mp_state_mem_mark_deque_t *dq, mp_state_mem_area_t *area, size_t block) {
+    size_t n_blocks = 0;
+    do {
+        n_blocks += 1;
+    } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+
+    void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
+    for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
+        void *ptr = *ptrs;
+        #if MICROPY_GC_SPLIT_HEAP
+        mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
+        if (!ptr_area) {
+            continue;
+        }
+        #else
+        if (!VERIFY_PTR(ptr)) {
+            continue;
+        }
+        mp_state_mem_area_t *ptr_area = area;
+        #endif
+        size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
+        if (ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD) {
+            continue;
+        }
+        // Another thread may get there first, and only one of them may push it.
+        byte *atb = &ptr_area->gc_alloc_table_start[ptr_block / BLOCKS_PER_ATB];
+        byte old = __atomic_fetch_or(atb, AT_MARK << BLOCK_SHIFT(ptr_block), __ATOMIC_RELAXED);
+        if (((old >> BLOCK_SHIFT(ptr_block)) & 3) != AT_HEAD) {
+            continue;
+        }
+        if (!gc_mark_deque_push(dq, ptr)) {
+            // Its children will be found by gc_deal_with_stack_overflow().
+            __atomic_store_n(&MP_STATE_MEM(gc_stack_overflow), 1, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void gc_mark_parallel_scan_ptr(mp_state_mem_mark_deque_t *dq, void *ptr) {
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+    #else
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+    gc_mark_parallel_scan(dq, area, BLOCK_FROM_PTR(area, ptr));
+}
+
+static void gc_mark_parallel_worker(size_t id) {
+    size_t n_threads = MP_STATE_MEM(gc_mark_threads);
+    mp_state_mem_mark_deque_t *dq = &MP_STATE_MEM(gc_mark_deque)[id];
+    void *ptr;
+
+    if (MP_STATE_MEM(gc_mark_rescan)) {
+        // Rescan this thread's share of each area for marked blocks, which
+        // may have unmarked children after the deques overflowed.
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            size_t n_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+            size_t end = n_blocks / n_threads * (id + 1);
+            if (id + 1 == n_threads) {
+                end = n_blocks;
+            }
+            for (size_t block = n_blocks / n_threads * id; block < end; block++) {
+                if (ATB_GET_KIND(area, block) == AT_MARK) {
+                    gc_mark_parallel_scan(dq, area, block);
+                    while ((ptr = gc_mark_deque_pop(dq)) != NULL) {
+                        gc_mark_parallel_scan_ptr(dq, ptr);
+                    }
+                }
+            }
+        }
+    }
+
+    for (;;) {
+        ptr = gc_mark_deque_pop(dq);
+        for (size_t i = 1; ptr == NULL && i < n_threads; i++) {
+            ptr = gc_mark_deque_steal(&MP_STATE_MEM(gc_mark_deque)[(id + i) % n_threads]);
+        }
+        if (ptr != NULL) {
+            gc_mark_parallel_scan_ptr(dq, ptr);
+            continue;
+        }
+
+        // Out of work.  An idle thread never pushes, and its deque is empty,
+        // so once all threads are idle the marking is complete.
+        __atomic_add_fetch(&MP_STATE_MEM(gc_mark_idle), 1, __ATOMIC_SEQ_CST);
+        for (;;) {
+            if (__atomic_load_n(&MP_STATE_MEM(gc_mark_idle), __ATOMIC_SEQ_CST) == n_threads) {
+                return;
+            }
+            bool work = false;
+            for (size_t i = 0; i < n_threads; i++) {
+                mp_state_mem_mark_deque_t *other = &MP_STATE_MEM(gc_mark_deque)[i];
+                if (__atomic_load_n(&other->top, __ATOMIC_RELAXED) < __atomic_load_n(&other->bottom, __ATOMIC_RELAXED)) {
+                    work = true;
+                    break;
+                }
+            }
+            if (work) {
+                __atomic_sub_fetch(&MP_STATE_MEM(gc_mark_idle), 1, __ATOMIC_SEQ_CST);
+                break;
+            }
+            MICROPY_GC_PARALLEL_MARK_WAIT();
+        }
+    }
+}
+
+// Mark the children of the roots left on the first deque by gc_collect_root(),
+// or rescan the heap if rescan is true, using all the mark threads.
+static void gc_mark_parallel(bool rescan) {
+    mp_state_mem_mark_deque_t *dq = &MP_STATE_MEM(gc_mark_deque)[0];
+    if (MP_STATE_MEM(gc_mark_threads) <= 1 || (!rescan && dq->top == dq->bottom)) {
+        return;
+    }
+    MP_STATE_MEM(gc_mark_rescan) = rescan;
+    MP_STATE_MEM(gc_mark_idle) = 0;
+    if (!mp_thread_gc_run_workers(gc_mark_parallel_worker, MP_STATE_MEM(gc_mark_threads))) {
+        // No helper threads, so go back to marking on this thread alone.
+        MP_STATE_MEM(gc_mark_threads) = 1;
+        void *ptr;
+        while ((ptr = gc_mark_deque_pop(dq)) != NULL) {
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+            gc_mark_subtree(area, BLOCK_FROM_PTR(area, ptr));
+            #else
+            mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+            gc_mark_subtree(BLOCK_FROM_PTR(area, ptr));
+            #endif
+        }
+        if (rescan) {
+            MP_STATE_MEM(gc_stack_overflow) = 1;
+        }
+    }
+}
+
+// The deques are a heap block that nothing points to.  It is marked once the
+// mark phase is over, so that it isn't freed but its stale entries aren't traced.
+static void gc_mark_parallel_keep_deques(void) {
+    void *ptr = MP_STATE_MEM(gc_mark_deque);
+    if (ptr == NULL) {
+        return;
+    }
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+    #else
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+    size_t block = BLOCK_FROM_PTR(area, ptr);
+    if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        ATB_HEAD_TO_MARK(area, block);
+    }
+}
+
+bool gc_mark_threads(size_t n_threads) {
+    assert(1 <= n_threads && n_threads <= MICROPY_GC_PARALLEL_MARK_MAX_THREADS);
+    // Go back to one mark thread and free the old deques before allocating
+    // the new ones, which are large, so that their memory can be reused.
+    GC_ENTER();
+    void *old_dq = MP_STATE_MEM(gc_mark_deque);
+    MP_STATE_MEM(gc_mark_threads) = 1;
+    MP_STATE_MEM(gc_mark_deque) = NULL;
+    GC_EXIT();
+    gc_free(old_dq);
+    if (n_threads == 1) {
+        return true;
+    }
+    mp_state_mem_mark_deque_t *dq = gc_alloc(n_threads * sizeof(mp_state_mem_mark_deque_t), 0);
+    if (dq == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < n_threads; i++) {
+        dq[i].top = 0;
+        dq[i].bottom = 0;
+    }
+    GC_ENTER();
+    MP_STATE_MEM(gc_mark_threads) = n_threads;
+    MP_STATE_MEM(gc_mark_deque) = dq;
+    GC_EXIT();
+    return true;
+}
+#endif
+
+#if MICROPY_GC_ADAPTIVE_THRESHOLD
+// The controller never sets the threshold below this fraction of the heap.
+#define GC_ADAPT_MIN_THRESHOLD_DIV (64)
+
+// Update the collection statistics at the end of a full collection, and if a
+// target is set then retune the allocation threshold for the next one.
+static void gc_adapt_threshold(void) {
+    mp_uint_t now = mp_hal_ticks_us();
+    mp_uint_t pause_us = now - MP_STATE_MEM(gc_stats_start_us);
+    size_t alloc_blocks = MP_STATE_MEM(gc_stats_alloc_blocks);
+    gc_info_t info;
+    gc_info_fast(&info);
+    size_t total_blocks = info.total / BYTES_PER_BLOCK;
+    size_t used_blocks = info.used / BYTES_PER_BLOCK;
+
+    if (MP_STATE_MEM(gc_stats_collections) > 0) {
+        // Allocation rate while the program ran since the last collection,
+        // smoothed because the workload may be bursty.
+        mp_uint_t run_us = MP_STATE_MEM(gc_stats_start_us) - MP_STATE_MEM(gc_stats_end_us);
+        size_t rate = (uint64_t)alloc_blocks * 1000000 / MAX(run_us, 1);
+        if (MP_STATE_MEM(gc_stats_alloc_rate) != 0) {
+            rate = (3 * (uint64_t)MP_STATE_MEM(gc_stats_alloc_rate) + rate) / 4;
+        }
+        MP_STATE_MEM(gc_stats_alloc_rate) = rate;
+    }
+
+    // Fraction of the blocks in use before the collection that survived it.
+    size_t used_before = MP_STATE_MEM(gc_stats_used_blocks) + alloc_blocks;
+    MP_STATE_MEM(gc_stats_survival_pct) = used_before == 0 ? 100 : MIN(100, (uint64_t)used_blocks * 100 / used_before);
+    MP_STATE_MEM(gc_stats_used_blocks) = used_blocks;
+
+    MP_STATE_MEM(gc_stats_collections) += 1;
+    MP_STATE_MEM(gc_stats_pause_us) = pause_us;
+    MP_STATE_MEM(gc_stats_max_pause_us) = MAX(MP_STATE_MEM(gc_stats_max_pause_us), pause_us);
+    MP_STATE_MEM(gc_stats_total_pause_us) += pause_us;
+    MP_STATE_MEM(gc_stats_end_us) = now;
+
+    mp_uint_t target_pause_us = MP_STATE_MEM(gc_target_pause_us);
+    mp_uint_t target_pct = MP_STATE_MEM(gc_target_overhead_pct);
+    if (target_pause_us == 0 && target_pct == 0) {
+        return;
+    }
+    uint64_t threshold = total_blocks;
+    if (target_pct != 0) {
+        // Collecting after every T blocks, at R blocks per second, spends
+        // pause / (pause + T / R) of the time collecting.  Use the smallest T
+        // that stays within the target, to keep memory use and pauses low.
+        threshold = (uint64_t)MP_STATE_MEM(gc_stats_alloc_rate) * pause_us * (100 - target_pct) / (target_pct * 1000000);
+    }
+    if (target_pause_us != 0 && pause_us != 0) {
+        // Sweeping and finalising take longer the more garbage there is, so
+        // scale the current threshold by how far the pause was from the
+        // target, growing it by at most a factor of two each time.  This
+        // takes priority over the overhead target.
+        uint64_t current = MP_STATE_MEM(gc_alloc_threshold) == (size_t)-1 ? alloc_blocks : MP_STATE_MEM(gc_alloc_threshold);
+        threshold = MIN(threshold, MIN(current * target_pause_us / pause_us, 2 * current));
+    }
+    MP_STATE_MEM(gc_alloc_threshold) = MAX(total_blocks / GC_ADAPT_MIN_THRESHOLD_DIV, MIN(threshold, total_blocks));
+}
+
+void gc_target(mp_uint_t pause_us, mp_uint_t overhead_pct) {
+    GC_ENTER();
+    MP_STATE_MEM(gc_target_pause_us) = pause_us;
+    MP_STATE_MEM(gc_target_overhead_pct) = overhead_pct;
+    if ((pause_us != 0 || overhead_pct != 0) && MP_STATE_MEM(gc_alloc_threshold) == (size_t)-1) {
+        // Start with a collection every 1/8th of the heap, which the first
+        // collection then corrects.
+        gc_info_t info;
+        gc_info_fast(&info);
+        MP_STATE_MEM(gc_alloc_threshold) = info.total / BYTES_PER_BLOCK / 8;
+    }
+    GC_EXIT();
+}
+#endif
+
 void gc_sweep_all(void) {
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    MP_STATE_MEM(gc_finaliser_inline) = true;
+    #endif
     gc_collect_start_common();
     gc_collect_end();
 }
 
 void gc_collect_end(void) {
+    #if MICROPY_GC_COMPACT
+    if (MP_STATE_MEM(gc_compact_census)) {
+        // Nothing was marked, so there is nothing to sweep.
+        MP_STATE_THREAD(gc_lock_depth) &= ~GC_COLLECT_FLAG;
+        GC_EXIT();
+        return;
+    }
+    #endif
+    #if MICROPY_GC_PARALLEL_MARK
+    gc_mark_parallel(false);
+    #endif
     gc_deal_with_stack_overflow();
+    #if MICROPY_GC_PARALLEL_MARK
+    gc_mark_parallel_keep_deques();
+    #endif
+    #if MICROPY_GC_INCREMENTAL
+    if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_REQUESTED) {
+        // Leave finalisers and freeing of blocks to gc_sweep_step().  Weak
+        // references are cleared now, so they can't be used to reach an
+        // unmarked object before it is freed.
+        #if MICROPY_PY_WEAKREF
+        for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            for (size_t wtb_idx = 0; wtb_idx <= area->gc_last_used_block / BLOCKS_PER_WTB; wtb_idx++) {
+                gc_sweep_weakrefs(area, wtb_idx);
+            }
+        }
+        #endif
+        MP_STATE_MEM(gc_sweep_phase) = GC_SWEEP_PHASE_FINALISE;
+        MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
+        MP_STATE_MEM(gc_sweep).block = 0;
+        MP_STATE_THREAD(gc_lock_depth) &= ~GC_COLLECT_FLAG;
+        GC_EXIT();
+        #if MICROPY_PY_WEAKREF
+        gc_weakref_sweep();
+        #endif
+        return;
+    }
+    #endif
     gc_sweep_run_finalisers();
     gc_sweep_free_blocks();
     #if MICROPY_GC_SPLIT_HEAP
@@ -586,6 +1144,9 @@ void gc_collect_end(void) {
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         area->gc_last_free_atb_index = 0;
     }
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    gc_adapt_threshold();
+    #endif
     MP_STATE_THREAD(gc_lock_depth) &= ~GC_COLLECT_FLAG;
     GC_EXIT();
     #if MICROPY_PY_WEAKREF
@@ -597,6 +1158,13 @@ static void gc_deal_with_stack_overflow(void) {
     while (MP_STATE_MEM(gc_stack_overflow)) {
         MP_STATE_MEM(gc_stack_overflow) = 0;
 
+        #if MICROPY_GC_PARALLEL_MARK
+        if (MP_STATE_MEM(gc_mark_threads) > 1) {
+            gc_mark_parallel(true);
+            continue;
+        }
+        #endif
+
         // scan entire memory looking for blocks which have been marked but not their children
         for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
             for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
@@ -614,129 +1182,436 @@ static void gc_deal_with_stack_overflow(void) {
     }
 }
 
-// Run finalisers for all to-be-freed blocks
-static void gc_sweep_run_finalisers(void) {
-    #if MICROPY_ENABLE_FINALISER || MICROPY_PY_WEAKREF
-    #if MICROPY_ENABLE_FINALISER && MICROPY_PY_WEAKREF
-    MP_STATIC_ASSERT(BLOCKS_PER_FTB == BLOCKS_PER_WTB);
-    #endif
-    for (const mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
-        assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
-        // Small speed optimisation: skip over empty FTB blocks
-        size_t ftb_end = area->gc_last_used_block / BLOCKS_PER_FTB; // index is inclusive
-        for (size_t ftb_idx = 0; ftb_idx <= ftb_end; ftb_idx++) {
-            #if MICROPY_ENABLE_FINALISER
-            byte ftb = area->gc_finaliser_table_start[ftb_idx];
-            size_t block = ftb_idx * BLOCKS_PER_FTB;
-            while (ftb) {
-                MICROPY_GC_HOOK_LOOP(block);
-                if (ftb & 1) { // FTB_GET(area, block) shortcut
-                    if (ATB_GET_KIND(area, block) == AT_HEAD) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
-                        // clear finaliser flag
-                        FTB_CLEAR(area, block);
-                    }
-                }
-                ftb >>= 1;
-                block++;
-            }
-            #endif
-            #if MICROPY_PY_WEAKREF
-            byte wtb = area->gc_weakref_table_start[ftb_idx];
-            block = ftb_idx * BLOCKS_PER_WTB;
-            while (wtb) {
-                MICROPY_GC_HOOK_LOOP(block);
-                if (wtb & 1) { // WTB_GET(area, block) shortcut
-                    if (ATB_GET_KIND(area, block) == AT_HEAD) {
-                        mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        gc_weakref_about_to_be_freed(obj);
-                        WTB_CLEAR(area, block);
-                    }
-                }
-                wtb >>= 1;
-                block++;
-            }
-            #endif
+#if MICROPY_ENABLE_FINALISER
+// Call the __del__ method of the given object, if it has one
+static void gc_call_finaliser(mp_obj_base_t *obj) {
+    // if the object has a type then see if it has a __del__ method
+    mp_obj_t dest[2];
+    mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+    if (dest[0] != MP_OBJ_NULL) {
+        // load_method returned a method, execute it in a protected environment
+        #if MICROPY_ENABLE_SCHEDULER
+        mp_sched_lock();
+        #endif
+        mp_call_function_1_protected(dest[0], dest[1]);
+        #if MICROPY_ENABLE_SCHEDULER
+        mp_sched_unlock();
+        #endif
+        #if MICROPY_GC_DEFERRED_FINALISERS
+        MP_STATE_MEM(gc_finalisers_run) += 1;
+        #endif
+    }
+}
+
+#if MICROPY_GC_DEFERRED_FINALISERS
+static mp_sched_node_t gc_finaliser_sched_node;
+
+// Scheduled callback that runs a batch of queued finalisers, and schedules
+// itself again if there are more left.  Each object's finaliser flag is
+// cleared before its finaliser runs, and the object is then freed by a later
+// collection once it is unreachable.
+static void gc_run_deferred_finalisers(mp_sched_node_t *node) {
+    // A batch size of 0 means finalisers are no longer deferred, so finish
+    // off whatever is still queued.
+    size_t n = MP_STATE_MEM(gc_finaliser_batch);
+    for (n = n ? n : (size_t)-1; n > 0; --n) {
+        GC_ENTER();
+        if (MP_STATE_MEM(gc_finaliser_queue_len) == 0) {
+            GC_EXIT();
+            return;
         }
+        mp_obj_base_t *obj = MP_STATE_MEM(gc_finaliser_queue)[--MP_STATE_MEM(gc_finaliser_queue_len)];
+        #if MICROPY_GC_SPLIT_HEAP
+        mp_state_mem_area_t *area = gc_get_ptr_area(obj);
+        #else
+        mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+        #endif
+        FTB_CLEAR(area, BLOCK_FROM_PTR(area, obj));
+        GC_EXIT();
+        gc_call_finaliser(obj);
+    }
+    if (MP_STATE_MEM(gc_finaliser_queue_len) != 0) {
+        // Let other code run before doing the next batch.
+        mp_sched_schedule_node(node, gc_run_deferred_finalisers);
     }
-    #endif // MICROPY_ENABLE_FINALISER || MICROPY_PY_WEAKREF
 }
 
-// Free unmarked heads and their tails
-static void gc_sweep_free_blocks(void) {
-    #if MICROPY_PY_GC_COLLECT_RETVAL
+// Try to queue the given unreachable object so that its finaliser runs later
+// from the scheduler.  The object, and everything it refers to, is marked so
+// that this sweep keeps it.  Returns false if the finaliser must run now.
+static bool gc_defer_finaliser(mp_state_mem_area_t *area, size_t block) {
+    if (MP_STATE_MEM(gc_finaliser_batch) == 0
+        || MP_STATE_MEM(gc_finaliser_inline)
+        || MP_STATE_MEM(gc_finaliser_queue_len) == MICROPY_GC_DEFERRED_FINALISERS_MAX) {
+        return false;
+    }
+    ATB_HEAD_TO_MARK(area, block);
+    #if MICROPY_GC_SPLIT_HEAP
+    gc_mark_subtree(area, block);
+    #else
+    gc_mark_subtree(block);
+    #endif
+    gc_deal_with_stack_overflow();
+    MP_STATE_MEM(gc_finaliser_queue)[MP_STATE_MEM(gc_finaliser_queue_len)++] = (void *)PTR_FROM_BLOCK(area, block);
+    mp_sched_schedule_node(&gc_finaliser_sched_node, gc_run_deferred_finalisers);
+    return true;
+}
+#endif
+
+// Run (or queue) finalisers for the to-be-freed blocks covered by the given FTB entry
+static void gc_sweep_finalisers(mp_state_mem_area_t *area, size_t ftb_idx) {
+    byte ftb = area->gc_finaliser_table_start[ftb_idx];
+    size_t block = ftb_idx * BLOCKS_PER_FTB;
+    while (ftb) {
+        MICROPY_GC_HOOK_LOOP(block);
+        if (ftb & 1) { // FTB_GET(area, block) shortcut
+            if (ATB_GET_KIND(area, block) == AT_HEAD) {
+                mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+                if (obj->type != NULL) {
+                    #if MICROPY_GC_DEFERRED_FINALISERS
+                    if (gc_defer_finaliser(area, block)) {
+                        // keep the finaliser flag until the finaliser has run
+                        ftb >>= 1;
+                        block++;
+                        continue;
+                    }
+                    #endif
+                    gc_call_finaliser(obj);
+                }
+                // clear finaliser flag
+                FTB_CLEAR(area, block);
+            }
+        }
+        ftb >>= 1;
+        block++;
+    }
+}
+#endif
+
+#if MICROPY_PY_WEAKREF
+// Clear weak references to the to-be-freed blocks covered by the given WTB entry
+static void gc_sweep_weakrefs(const mp_state_mem_area_t *area, size_t wtb_idx) {
+    byte wtb = area->gc_weakref_table_start[wtb_idx];
+    size_t block = wtb_idx * BLOCKS_PER_WTB;
+    while (wtb) {
+        MICROPY_GC_HOOK_LOOP(block);
+        if (wtb & 1) { // WTB_GET(area, block) shortcut
+            if (ATB_GET_KIND(area, block) == AT_HEAD) {
+                mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+                gc_weakref_about_to_be_freed(obj);
+                WTB_CLEAR(area, block);
+            }
+        }
+        wtb >>= 1;
+        block++;
+    }
+}
+#endif
+
+// Run finalisers for all to-be-freed blocks
+static void gc_sweep_run_finalisers(void) {
+    #if MICROPY_ENABLE_FINALISER || MICROPY_PY_WEAKREF
+    #if MICROPY_ENABLE_FINALISER && MICROPY_PY_WEAKREF
+    MP_STATIC_ASSERT(BLOCKS_PER_FTB == BLOCKS_PER_WTB);
+    #endif
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        // Small speed optimisation: skip over empty FTB blocks
+        size_t ftb_end = area->gc_last_used_block / BLOCKS_PER_FTB; // index is inclusive
+        for (size_t ftb_idx = 0; ftb_idx <= ftb_end; ftb_idx++) {
+            #if MICROPY_ENABLE_FINALISER
+            gc_sweep_finalisers(area, ftb_idx);
+            #endif
+            #if MICROPY_PY_WEAKREF
+            gc_sweep_weakrefs(area, ftb_idx);
+            #endif
+        }
+    }
+    #endif // MICROPY_ENABLE_FINALISER || MICROPY_PY_WEAKREF
+}
+
+static void gc_sweep_area_begin(mp_state_mem_sweep_t *sweep) {
+    sweep->block = 0;
+    sweep->last_used_block = 0;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    sweep->free_run_start = 0;
+    #endif
+    sweep->free_tail = false;
+}
+
+// Free unmarked heads and their tails, from sweep->block up to (but not
+// including) end_block of the given area
+static void gc_sweep_area_blocks(mp_state_mem_area_t *area, mp_state_mem_sweep_t *sweep, size_t end_block) {
+    bool free_tail = sweep->free_tail;
+    size_t last_used_block = sweep->last_used_block;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t free_run_start = sweep->free_run_start;
+    #endif
+
+    for (size_t block = sweep->block; block < end_block; block++) {
+        MICROPY_GC_HOOK_LOOP(block);
+        #if MICROPY_OPT_GC_FAST_SWEEP
+        if ((block & (BLOCKS_PER_ATB - 1)) == 0 && block + BLOCKS_PER_ATB <= end_block) {
+            byte *atb = &area->gc_alloc_table_start[block / BLOCKS_PER_ATB];
+            byte a = *atb;
+            // If there are no marked heads, and the first block isn't the tail
+            // of a marked object, then all four blocks are free or to be freed.
+            if ((a & (a >> 1) & 0x55) == 0 && (free_tail || (a & ATB_MASK_0) != AT_TAIL)) {
+                if (a != 0) {
+                    #if MICROPY_PY_GC_COLLECT_RETVAL
+                    for (byte heads = a & 0x55; heads != 0; heads &= heads - 1) {
+                        MP_STATE_MEM(gc_collected)++;
+                    }
+                    #endif
+                    *atb = 0;
+                    free_tail = true;
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BLOCKS_PER_ATB * BYTES_PER_BLOCK);
+                    #endif
+                }
+                block += BLOCKS_PER_ATB - 1;
+                continue;
+            }
+        }
+        #endif
+        switch (ATB_GET_KIND(area, block)) {
+            case AT_HEAD:
+                free_tail = true;
+                DEBUG_printf("gc_sweep_free_blocks(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
+                #if MICROPY_PY_GC_COLLECT_RETVAL
+                MP_STATE_MEM(gc_collected)++;
+                #endif
+                // fall through to free the head
+                MP_FALLTHROUGH
+
+            case AT_TAIL:
+                if (free_tail) {
+                    ATB_ANY_TO_FREE(area, block);
+                    #if CLEAR_ON_SWEEP
+                    memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
+                    #endif
+                } else {
+                    last_used_block = block;
+                    #if MICROPY_GC_FREE_RUN_INDEX
+                    free_run_start = gc_free_run_sweep_used(area, free_run_start, block);
+                    #endif
+                }
+                break;
+
+            case AT_MARK:
+                ATB_MARK_TO_HEAD(area, block);
+                free_tail = false;
+                last_used_block = block;
+                #if MICROPY_GC_FREE_RUN_INDEX
+                free_run_start = gc_free_run_sweep_used(area, free_run_start, block);
+                #endif
+                break;
+        }
+    }
+
+    sweep->block = end_block;
+    sweep->free_tail = free_tail;
+    sweep->last_used_block = last_used_block;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    sweep->free_run_start = free_run_start;
+    #endif
+}
+
+// Finish the sweep of an area.  Returns true if the area is now empty.
+static bool gc_sweep_area_end(mp_state_mem_area_t *area, mp_state_mem_sweep_t *sweep) {
+    area->gc_last_used_block = sweep->last_used_block;
+
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // Everything after the last swept block is free.
+    gc_free_run_add(area, sweep->free_run_start, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+    #endif
+
+    return sweep->last_used_block == 0;
+}
+
+// Free unmarked heads and their tails
+static void gc_sweep_free_blocks(void) {
+    #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
-    int free_tail = 0;
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     mp_state_mem_area_t *prev_area = NULL;
     #endif
 
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
-        size_t last_used_block = 0;
+        mp_state_mem_sweep_t sweep;
         assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        #if MICROPY_GC_FREE_RUN_INDEX
+        // Rebuild the free-run index from scratch as the blocks are swept.
+        for (size_t c = 0; c < MICROPY_GC_FREE_RUN_NUM_CLASSES; c++) {
+            area->gc_free_run_atb_index[c] = area->gc_alloc_table_byte_len;
+        }
+        #endif
 
-        for (size_t block = 0; block <= area->gc_last_used_block; block++) {
-            MICROPY_GC_HOOK_LOOP(block);
-            switch (ATB_GET_KIND(area, block)) {
-                case AT_HEAD:
-                    free_tail = 1;
-                    DEBUG_printf("gc_sweep_free_blocks(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
-                    #if MICROPY_PY_GC_COLLECT_RETVAL
-                    MP_STATE_MEM(gc_collected)++;
-                    #endif
-                    // fall through to free the head
-                    MP_FALLTHROUGH
+        gc_sweep_area_begin(&sweep);
+        gc_sweep_area_blocks(area, &sweep, area->gc_last_used_block + 1);
+        bool empty = gc_sweep_area_end(area, &sweep);
+        (void)empty;
 
-                case AT_TAIL:
-                    if (free_tail) {
-                        ATB_ANY_TO_FREE(area, block);
-                        #if CLEAR_ON_SWEEP
-                        memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
-                        #endif
-                    } else {
-                        last_used_block = block;
-                    }
-                    break;
+        #if MICROPY_GC_SPLIT_HEAP_AUTO
+        // Free any empty area, aside from the first one
+        if (empty && prev_area != NULL) {
+            DEBUG_printf("gc_sweep_free_blocks free empty area %p\n", area);
+            NEXT_AREA(prev_area) = NEXT_AREA(area);
+            MP_PLAT_FREE_HEAP(area);
+            area = prev_area;
+        }
+        prev_area = area;
+        #endif
+    }
+}
 
-                case AT_MARK:
-                    ATB_MARK_TO_HEAD(area, block);
-                    free_tail = 0;
-                    last_used_block = block;
-                    break;
+#if MICROPY_GC_INCREMENTAL
+// Whether the given block, just allocated, is still to be reached by a pending
+// incremental sweep.
+static bool gc_sweep_is_ahead(mp_state_mem_area_t *area, size_t block) {
+    if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FINALISE) {
+        return true;
+    }
+    if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FREE) {
+        for (mp_state_mem_area_t *a = MP_STATE_MEM(gc_sweep_area); a != NULL; a = NEXT_AREA(a)) {
+            if (a == area) {
+                return a != MP_STATE_MEM(gc_sweep_area) || block >= MP_STATE_MEM(gc_sweep).block;
+            }
+        }
+    }
+    return false;
+}
+
+// Blocks start_block to end_block (inclusive) were just allocated as a chain.
+// If a pending sweep hasn't reached the head yet then mark it, so the sweep
+// keeps it.  Otherwise make sure the sweep accounts for it when it computes
+// the last used block of the area.
+static void gc_sweep_note_alloc(mp_state_mem_area_t *area, size_t start_block, size_t end_block) {
+    if (gc_sweep_is_ahead(area, start_block)) {
+        ATB_HEAD_TO_MARK(area, start_block);
+    } else if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FREE && area == MP_STATE_MEM(gc_sweep_area)) {
+        MP_STATE_MEM(gc_sweep).last_used_block = MAX(MP_STATE_MEM(gc_sweep).last_used_block, end_block);
+    }
+}
+
+// The sweep is resuming at the given block.  If it's a tail then the mutator
+// may have extended a live chain into it, so check whether the chain's head
+// survived rather than trusting the state saved by the previous step.
+static bool gc_sweep_resume_free_tail(mp_state_mem_area_t *area, size_t block) {
+    if (ATB_GET_KIND(area, block) != AT_TAIL) {
+        return false;
+    }
+    while (block > 0) {
+        block -= 1;
+        int kind = ATB_GET_KIND(area, block);
+        if (kind != AT_TAIL) {
+            return kind == AT_FREE;
+        }
+    }
+    return false;
+}
+
+bool gc_sweep_pending(void) {
+    return MP_STATE_MEM(gc_sweep_phase) >= GC_SWEEP_PHASE_FINALISE;
+}
+
+void gc_collect_incremental(void) {
+    gc_sweep_finish();
+    MP_STATE_MEM(gc_sweep_phase) = GC_SWEEP_PHASE_REQUESTED;
+    gc_collect();
+}
+
+bool gc_sweep_step(size_t n_blocks) {
+    GC_ENTER();
+    if (!gc_sweep_pending() || (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG)) {
+        // Nothing to do, or called from a finaliser during a sweep.
+        GC_EXIT();
+        return !gc_sweep_pending();
+    }
+    MP_STATE_THREAD(gc_lock_depth) |= GC_COLLECT_FLAG;
+
+    mp_state_mem_sweep_t *sweep = &MP_STATE_MEM(gc_sweep);
+    while (n_blocks > 0) {
+        mp_state_mem_area_t *area = MP_STATE_MEM(gc_sweep_area);
+        if (area == NULL) {
+            if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FINALISE) {
+                // All finalisers have run, now free the blocks.
+                MP_STATE_MEM(gc_sweep_phase) = GC_SWEEP_PHASE_FREE;
+                MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
+                #if MICROPY_GC_SPLIT_HEAP_AUTO
+                MP_STATE_MEM(gc_sweep_prev_area) = NULL;
+                #endif
+                #if MICROPY_PY_GC_COLLECT_RETVAL
+                MP_STATE_MEM(gc_collected) = 0;
+                #endif
+                gc_sweep_area_begin(sweep);
+                continue;
             }
+            MP_STATE_MEM(gc_sweep_phase) = GC_SWEEP_PHASE_NONE;
+            break;
         }
 
-        area->gc_last_used_block = last_used_block;
+        size_t end_block = area->gc_last_used_block + 1;
+        size_t step_end = sweep->block + MIN(n_blocks, end_block - sweep->block);
+        n_blocks -= step_end - sweep->block;
 
+        if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FINALISE) {
+            #if MICROPY_ENABLE_FINALISER
+            for (size_t ftb_idx = sweep->block / BLOCKS_PER_FTB; ftb_idx * BLOCKS_PER_FTB < step_end; ftb_idx++) {
+                gc_sweep_finalisers(area, ftb_idx);
+            }
+            #endif
+            sweep->block = (step_end + BLOCKS_PER_FTB - 1) & ~(BLOCKS_PER_FTB - 1);
+            if (sweep->block >= end_block) {
+                MP_STATE_MEM(gc_sweep_area) = NEXT_AREA(area);
+                sweep->block = 0;
+            }
+            continue;
+        }
+
+        // Free blocks, letting allocations reuse them straight away.
+        if (sweep->block > 0) {
+            sweep->free_tail = gc_sweep_resume_free_tail(area, sweep->block);
+        }
+        if (sweep->block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+            area->gc_last_free_atb_index = sweep->block / BLOCKS_PER_ATB;
+        }
+        #if MICROPY_GC_SPLIT_HEAP
+        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+        #endif
+        gc_sweep_area_blocks(area, sweep, step_end);
+        if (step_end < end_block) {
+            continue;
+        }
+        bool empty = gc_sweep_area_end(area, sweep);
+        (void)empty;
+        MP_STATE_MEM(gc_sweep_area) = NEXT_AREA(area);
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
-        if (last_used_block == 0 && prev_area != NULL) {
-            DEBUG_printf("gc_sweep_free_blocks free empty area %p\n", area);
+        mp_state_mem_area_t *prev_area = MP_STATE_MEM(gc_sweep_prev_area);
+        if (empty && prev_area != NULL) {
+            DEBUG_printf("gc_sweep_step free empty area %p\n", area);
             NEXT_AREA(prev_area) = NEXT_AREA(area);
             MP_PLAT_FREE_HEAP(area);
             area = prev_area;
         }
-        prev_area = area;
+        MP_STATE_MEM(gc_sweep_prev_area) = area;
         #endif
+        gc_sweep_area_begin(sweep);
     }
+
+    MP_STATE_THREAD(gc_lock_depth) &= ~GC_COLLECT_FLAG;
+    bool done = !gc_sweep_pending();
+    GC_EXIT();
+    return done;
 }
 
+void gc_sweep_finish(void) {
+    gc_sweep_step((size_t)-1);
+}
+#endif
+
 // Address sanitizer needs to know that the access to ptrs[i] must always be
 // considered OK, even if it's a load from an address that would normally be
 // prohibited (due to being undefined, in a red zone, etc).
@@ -775,6 +1650,7 @@ void gc_info(gc_info_t *info) {
                     break;
 
                 case AT_HEAD:
+                case AT_MARK: // only outside a collection while a sweep is pending
                     info->used += 1;
                     len = 1;
                     break;
@@ -783,10 +1659,6 @@ void gc_info(gc_info_t *info) {
                     info->used += 1;
                     len += 1;
                     break;
-
-                case AT_MARK:
-                    // shouldn't happen
-                    break;
             }
 
             block++;
@@ -796,7 +1668,7 @@ void gc_info(gc_info_t *info) {
                 kind = ATB_GET_KIND(area, block);
             }
 
-            if (finish || kind == AT_FREE || kind == AT_HEAD) {
+            if (finish || kind != AT_TAIL) {
                 if (len == 1) {
                     info->num_1block += 1;
                 } else if (len == 2) {
@@ -805,7 +1677,7 @@ void gc_info(gc_info_t *info) {
                 if (len > info->max_block) {
                     info->max_block = len;
                 }
-                if (finish || kind == AT_HEAD) {
+                if (finish || kind != AT_FREE) {
                     if (len_free > info->max_free) {
                         info->max_free = len_free;
                     }
@@ -844,6 +1716,308 @@ void gc_info_fast(gc_info_t *info) {
     GC_EXIT();
 }
 
+#if MICROPY_GC_COMPACT
+// Compaction can only move a block when it knows every pointer to that block,
+// so that they can all be updated.  The heap is scanned conservatively, so
+// gc_compact() limits itself to payload blocks owned by objects of a few
+// known types, and only moves one if the owner's field is the sole reference
+// to it found by a census of the roots and the heap.  Unlike marking, which
+// only follows pointers to the head block, the census counts any pointer into
+// a payload, so that pointers held by C code part way through a payload pin
+// it in place.  Pointers in the roots to just past the end of a payload count
+// too, in case C code is only holding the end of an array it walks backwards.
+
+// Return the area holding the head block that starts at ptr, or NULL.
+static mp_state_mem_area_t *gc_compact_head_area(const void *ptr) {
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+    if (area == NULL) {
+        return NULL;
+    }
+    #else
+    if (!VERIFY_PTR(ptr)) {
+        return NULL;
+    }
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+    return ATB_GET_KIND(area, BLOCK_FROM_PTR(area, ptr)) == AT_HEAD ? area : NULL;
+}
+
+static size_t gc_compact_n_blocks(const mp_state_mem_area_t *area, size_t block) {
+    size_t n_blocks = 1;
+    while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+        n_blocks += 1;
+    }
+    return n_blocks;
+}
+
+#define GC_COMPACT_BLOCKS(n_bytes) (((n_bytes) + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK)
+
+// Return true if ptr is the start of an allocation big enough to be a type
+// object, and that is one.
+static bool gc_compact_is_type(const void *ptr) {
+    mp_state_mem_area_t *area = gc_compact_head_area(ptr);
+    return area != NULL
+           && gc_compact_n_blocks(area, BLOCK_FROM_PTR(area, ptr)) >= GC_COMPACT_BLOCKS(sizeof(mp_obj_type_t))
+           && ((const mp_obj_base_t *)ptr)->type == &mp_type_type;
+}
+
+// If the n_blocks at obj hold an object that owns a movable payload then
+// return the address of the owner's pointer to it, and the payload's size in
+// bytes in *n_bytes.  An allocation is only taken to be such an object if its
+// size matches, and later the size of the payload must match as well.
+static void **gc_compact_owner_field(void *obj, size_t n_blocks, size_t *n_bytes) {
+    const mp_obj_type_t *type = ((mp_obj_base_t *)obj)->type;
+    mp_map_t *map = NULL;
+    if (type == &mp_type_list && n_blocks == GC_COMPACT_BLOCKS(sizeof(mp_obj_list_t))) {
+        mp_obj_list_t *o = obj;
+        *n_bytes = o->alloc * sizeof(mp_obj_t);
+        return (void **)&o->items;
+    }
+    #if MICROPY_PY_BUILTINS_BYTEARRAY || MICROPY_PY_ARRAY
+    if ((0
+         #if MICROPY_PY_BUILTINS_BYTEARRAY
+         || type == &mp_type_bytearray
+         #endif
+         #if MICROPY_PY_ARRAY
+         || type == &mp_type_array
+         #endif
+         ) && n_blocks == GC_COMPACT_BLOCKS(sizeof(mp_obj_array_t))) {
+        mp_obj_array_t *o = obj;
+        *n_bytes = (o->len + o->free) * mp_binary_get_size('@', o->typecode, NULL);
+        return &o->items;
+    }
+    #endif
+    if ((type == &mp_type_str || type == &mp_type_bytes) && n_blocks == GC_COMPACT_BLOCKS(sizeof(mp_obj_str_t))) {
+        mp_obj_str_t *o = obj;
+        *n_bytes = o->len + 1;
+        return (void **)&o->data;
+    }
+    if ((type == &mp_type_dict
+         #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+         || type == &mp_type_ordereddict
+         #endif
+         ) && n_blocks == GC_COMPACT_BLOCKS(sizeof(mp_obj_dict_t))) {
+        map = &((mp_obj_dict_t *)obj)->map;
+    } else if (gc_compact_is_type(type)
+               && mp_obj_is_instance_type(type)
+               && n_blocks >= GC_COMPACT_BLOCKS(sizeof(mp_obj_instance_t))) {
+        // An instance of a class defined in Python.
+        map = &((mp_obj_instance_t *)obj)->members;
+        #if MICROPY_OPT_INSTANCE_SHARED_KEYS
+        if (mp_obj_instance_members_are_split((mp_obj_instance_t *)obj)) {
+            *n_bytes = map->used * sizeof(mp_obj_t);
+            return (void **)&map->table;
+        }
+        #endif
+    }
+    if (map != NULL && !map->is_fixed) {
+        *n_bytes = map->alloc * sizeof(mp_map_elem_t);
+        return (void **)&map->table;
+    }
+    return NULL;
+}
+
+// Choose the highest payloads in the heap that start below gc_compact_ceiling
+// and could move down, and sort them by address.
+static void gc_compact_select(void) {
+    mp_state_mem_compact_t *cands = MP_STATE_MEM(gc_compact);
+    size_t n = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        // Payloads can only move down into free blocks after the first one.
+        size_t first_free = 0;
+        while (first_free <= area->gc_last_used_block && ATB_GET_KIND(area, first_free) != AT_FREE) {
+            first_free += 1;
+        }
+        for (size_t block = 0; block <= area->gc_last_used_block; block++) {
+            if (ATB_GET_KIND(area, block) != AT_HEAD) {
+                continue;
+            }
+            size_t n_bytes = 0;
+            void **field = gc_compact_owner_field((void *)PTR_FROM_BLOCK(area, block), gc_compact_n_blocks(area, block), &n_bytes);
+            if (field == NULL || n_bytes == 0) {
+                continue;
+            }
+            byte *start = *field;
+            mp_state_mem_area_t *payload_area = gc_compact_head_area(start);
+            if (payload_area == NULL || start >= MP_STATE_MEM(gc_compact_ceiling)) {
+                continue;
+            }
+            size_t payload_block = BLOCK_FROM_PTR(payload_area, start);
+            if (payload_area != area || payload_block < first_free
+                || gc_compact_n_blocks(area, payload_block) != GC_COMPACT_BLOCKS(n_bytes)
+                #if MICROPY_ENABLE_FINALISER
+                || FTB_GET(area, payload_block)
+                #endif
+                #if MICROPY_PY_WEAKREF
+                || WTB_GET(area, payload_block)
+                #endif
+                ) {
+                continue;
+            }
+            // Insert it in order, dropping the lowest payload if full.
+            size_t i = n;
+            if (n < MICROPY_GC_COMPACT_MAX_CANDIDATES) {
+                n += 1;
+            } else if (start > cands[0].start) {
+                memmove(&cands[0], &cands[1], (--i) * sizeof(*cands));
+            } else {
+                continue;
+            }
+            for (; i > 0 && cands[i - 1].start > start; --i) {
+                cands[i] = cands[i - 1];
+            }
+            cands[i].owner_field = field;
+            cands[i].start = start;
+            cands[i].n_bytes = GC_COMPACT_BLOCKS(n_bytes) * BYTES_PER_BLOCK;
+            cands[i].refs = 0;
+        }
+    }
+    MP_STATE_MEM(gc_compact_n) = n;
+}
+
+// Count ptr as a reference to any candidate payload that it points into, or
+// just past the end of if past_end is true.
+static void gc_compact_count(const void *ptr, bool past_end) {
+    mp_state_mem_compact_t *cands = MP_STATE_MEM(gc_compact);
+    size_t n = MP_STATE_MEM(gc_compact_n);
+    if (n == 0 || (const byte *)ptr < cands[0].start || (const byte *)ptr > cands[n - 1].start + cands[n - 1].n_bytes) {
+        return;
+    }
+    // Find the last candidate that starts at or before ptr.
+    size_t lo = 0;
+    size_t hi = n;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (cands[mid].start <= (const byte *)ptr) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    if ((const byte *)ptr < cands[lo].start + cands[lo].n_bytes + past_end) {
+        cands[lo].refs += 1;
+    }
+    if (past_end && lo > 0 && (const byte *)ptr == cands[lo - 1].start + cands[lo - 1].n_bytes) {
+        cands[lo - 1].refs += 1;
+    }
+}
+
+// Return the start of the smallest run of at least n_blocks free blocks that
+// ends before the given block, or -1 if there isn't one.  Filling the tightest
+// holes first leaves larger runs of free blocks intact.
+static size_t gc_compact_find_hole(const mp_state_mem_area_t *area, size_t n_blocks, size_t limit) {
+    size_t best = (size_t)-1;
+    size_t best_run = (size_t)-1;
+    size_t run = 0;
+    for (size_t block = 0; block <= limit; block++) {
+        if (block < limit && ATB_GET_KIND(area, block) == AT_FREE) {
+            run += 1;
+            continue;
+        }
+        if (run >= n_blocks && run < best_run) {
+            best = block - run;
+            best_run = run;
+            if (run == n_blocks) {
+                // Can't do better than an exact fit.
+                break;
+            }
+        }
+        run = 0;
+    }
+    return best;
+}
+
+// Overwrite the part of the C stack that gc_compact_select() used, so that any
+// pointers to payloads it left there aren't counted by the census.
+static MP_NOINLINE void gc_compact_clear_stack(void) {
+    volatile byte buf[2048];
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = 0;
+    }
+}
+
+// Move the selected payloads that are only referenced by their owner down
+// into the tightest free space below them.  Returns the number of bytes moved.
+static size_t gc_compact_move(void) {
+    // Count the references from the roots, using a collection in census mode,
+    // then from every word of the heap.  Words in garbage are counted too,
+    // which is safe because it can only pin more payloads.
+    MP_STATE_MEM(gc_compact_census) = true;
+    gc_collect();
+    MP_STATE_MEM(gc_compact_census) = false;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        void **ptrs = (void **)area->gc_pool_start;
+        for (size_t block = 0; block <= area->gc_last_used_block; block++, ptrs += BYTES_PER_BLOCK / sizeof(void *)) {
+            if (ATB_GET_KIND(area, block) == AT_FREE) {
+                continue;
+            }
+            for (size_t i = 0; i < BYTES_PER_BLOCK / sizeof(void *); i++) {
+                gc_compact_count(ptrs[i], false);
+            }
+        }
+    }
+
+    size_t moved = 0;
+    for (size_t i = MP_STATE_MEM(gc_compact_n); i-- > 0;) {
+        mp_state_mem_compact_t *cand = &MP_STATE_MEM(gc_compact)[i];
+        if (cand->refs != 1 || *cand->owner_field != cand->start) {
+            continue;
+        }
+        mp_state_mem_area_t *area = gc_compact_head_area(cand->start);
+        size_t n_blocks = cand->n_bytes / BYTES_PER_BLOCK;
+        size_t dest_block = gc_compact_find_hole(area, n_blocks, BLOCK_FROM_PTR(area, cand->start));
+        if (dest_block == (size_t)-1) {
+            continue;
+        }
+        // Claim the hole.  This can't break the invariants of
+        // gc_last_free_atb_index or the free-run index, which are lower bounds.
+        ATB_FREE_TO_HEAD(area, dest_block);
+        for (size_t bl = dest_block + 1; bl < dest_block + n_blocks; bl++) {
+            ATB_FREE_TO_TAIL(area, bl);
+        }
+        byte *dest = (byte *)PTR_FROM_BLOCK(area, dest_block);
+        memcpy(dest, cand->start, cand->n_bytes);
+        *cand->owner_field = dest;
+        gc_free(cand->start);
+        moved += cand->n_bytes;
+    }
+    return moved;
+}
+
+size_t gc_compact(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) != 0) {
+        return 0;
+    }
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    // Other threads could load a pointer to a payload after the census.
+    if (!mp_thread_is_only_thread()) {
+        return 0;
+    }
+    #endif
+
+    // Free all garbage, so that every allocation left is live, then work down
+    // through the heap a group of candidates at a time.  The position reached
+    // is kept out of the C stack, so the census doesn't count it.
+    gc_collect();
+    size_t moved = 0;
+    MP_STATE_MEM(gc_compact_ceiling) = (byte *)UINTPTR_MAX;
+    for (;;) {
+        GC_ENTER();
+        gc_compact_select();
+        GC_EXIT();
+        if (MP_STATE_MEM(gc_compact_n) == 0) {
+            break;
+        }
+        MP_STATE_MEM(gc_compact_ceiling) = MP_STATE_MEM(gc_compact)[0].start;
+        gc_compact_clear_stack();
+        moved += gc_compact_move();
+    }
+    MP_STATE_MEM(gc_compact_n) = 0;
+    return moved;
+}
+#endif
+
 #if MICROPY_PY_WEAKREF
 // Mark the GC heap pointer as having a weakref.
 void gc_weakref_mark(void *ptr) {
@@ -857,12 +2031,140 @@ void gc_weakref_mark(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || (ATB_GET_KIND(area, block) == AT_MARK && GC_SWEEP_PENDING()));
 
     WTB_SET(area, block);
 }
 #endif
 
+#if MICROPY_GC_ALLOC_PROFILE
+// Record the Python stack of the current thread against an allocation of
+// n_bytes.  Called with the GC mutex held, so it must not allocate.
+static void gc_alloc_profile_sample(size_t n_bytes) {
+    MP_STATE_MEM(gc_alloc_profile_countdown) = MP_STATE_MEM(gc_alloc_profile_period);
+
+    mp_state_mem_alloc_frame_t frames[MICROPY_GC_ALLOC_PROFILE_DEPTH];
+    size_t depth = 0;
+    size_t hash = 0;
+    for (const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+         code_state != NULL && depth < MICROPY_GC_ALLOC_PROFILE_DEPTH;
+         code_state = code_state->prev_state) {
+        // Decode the prelude to find the name and line info, as done for tracebacks.
+        const mp_obj_fun_bc_t *fun_bc = code_state->fun_bc;
+        const byte *ip = fun_bc->bytecode;
+        MP_BC_PRELUDE_SIG_DECODE(ip);
+        MP_BC_PRELUDE_SIZE_DECODE(ip);
+        const byte *line_info_top = ip + n_info;
+        const byte *bytecode_start = ip + n_info + n_cell;
+        size_t bc = code_state->ip > bytecode_start ? code_state->ip - bytecode_start : 0;
+        qstr block_name = mp_decode_uint_value(ip);
+        for (size_t i = 0; i < 1 + n_pos_args + n_kwonly_args; ++i) {
+            ip = mp_decode_uint_skip(ip);
+        }
+        mp_state_mem_alloc_frame_t *frame = &frames[depth++];
+        #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+        frame->block_name = fun_bc->context->constants.qstr_table[block_name];
+        frame->source_file = fun_bc->context->constants.qstr_table[0];
+        #else
+        frame->block_name = block_name;
+        frame->source_file = fun_bc->context->constants.source_file;
+        #endif
+        frame->line = mp_bytecode_get_source_line(ip, line_info_top, bc);
+        hash = (hash * 31 + frame->block_name) * 31 + frame->line;
+    }
+
+    if (depth > 0) {
+        // Find the entry for this stack, using linear probing from its hash.
+        mp_state_mem_alloc_site_t *sites = MP_STATE_MEM(gc_alloc_profile_sites);
+        for (size_t n = 0, i = hash % MICROPY_GC_ALLOC_PROFILE_SITES; n < MICROPY_GC_ALLOC_PROFILE_SITES; ++n) {
+            mp_state_mem_alloc_site_t *site = &sites[i];
+            if (site->count == 0) {
+                site->depth = depth;
+                memcpy(site->frames, frames, depth * sizeof(*frames));
+            } else if (site->depth != depth || memcmp(site->frames, frames, depth * sizeof(*frames)) != 0) {
+                if (++i == MICROPY_GC_ALLOC_PROFILE_SITES) {
+                    i = 0;
+                }
+                continue;
+            }
+            site->count += 1;
+            site->bytes += n_bytes;
+            return;
+        }
+    }
+
+    // No Python stack, or the table is full.
+    MP_STATE_MEM(gc_alloc_profile_other_count) += 1;
+    MP_STATE_MEM(gc_alloc_profile_other_bytes) += n_bytes;
+}
+
+void gc_alloc_profile(size_t period) {
+    GC_ENTER();
+    memset(MP_STATE_MEM(gc_alloc_profile_sites), 0, sizeof(MP_STATE_MEM(gc_alloc_profile_sites)));
+    MP_STATE_MEM(gc_alloc_profile_other_count) = 0;
+    MP_STATE_MEM(gc_alloc_profile_other_bytes) = 0;
+    MP_STATE_MEM(gc_alloc_profile_period) = period;
+    MP_STATE_MEM(gc_alloc_profile_countdown) = period;
+    GC_EXIT();
+}
+
+// Print the sampled stacks in the "folded" format used by flame graph tools:
+// one line per stack, with its frames outermost first, then the sample count.
+void gc_alloc_profile_print(const mp_print_t *print) {
+    // Don't sample any allocations made while printing.
+    size_t period = MP_STATE_MEM(gc_alloc_profile_period);
+    MP_STATE_MEM(gc_alloc_profile_period) = 0;
+    for (size_t i = 0; i < MICROPY_GC_ALLOC_PROFILE_SITES; ++i) {
+        const mp_state_mem_alloc_site_t *site = &MP_STATE_MEM(gc_alloc_profile_sites)[i];
+        if (site->count == 0) {
+            continue;
+        }
+        for (size_t j = site->depth; j-- > 0;) {
+            const mp_state_mem_alloc_frame_t *frame = &site->frames[j];
+            mp_printf(print, "%q (%q:%u)%s", frame->block_name, frame->source_file,
+                (uint)frame->line, j > 0 ? ";" : "");
+        }
+        mp_printf(print, " %u\n", (uint)site->count);
+    }
+    if (MP_STATE_MEM(gc_alloc_profile_other_count) != 0) {
+        mp_printf(print, "[unknown] %u\n", (uint)MP_STATE_MEM(gc_alloc_profile_other_count));
+    }
+    MP_STATE_MEM(gc_alloc_profile_period) = period;
+}
+#endif
+
+#if MICROPY_GC_THREAD_ALLOC_BUFFER
+// Take the next object from this thread's buffer of n_blocks sized objects.
+// The objects were allocated and cleared when the buffer was filled, so this
+// doesn't need the GC mutex.  Returns NULL if the buffer is empty or has been
+// retired by a collection.
+static inline void *gc_alloc_from_buffer(size_t n_blocks) {
+    mp_state_thread_alloc_buffer_t *buf = &MP_STATE_THREAD(gc_alloc_buffer)[n_blocks - 1];
+    if (buf->next == buf->end || buf->epoch != MP_STATE_MEM(gc_alloc_buffer_epoch)) {
+        return NULL;
+    }
+    void *ptr = buf->next;
+    buf->next += n_blocks * BYTES_PER_BLOCK;
+    return ptr;
+}
+
+void gc_alloc_buffer_release(void) {
+    GC_ENTER();
+    for (size_t n_blocks = 1; n_blocks <= MICROPY_GC_THREAD_ALLOC_BUFFER_MAX_BLOCKS; n_blocks++) {
+        mp_state_thread_alloc_buffer_t *buf = &MP_STATE_THREAD(gc_alloc_buffer)[n_blocks - 1];
+        // A retired buffer's objects are freed by the collection that retired it.
+        if (buf->epoch == MP_STATE_MEM(gc_alloc_buffer_epoch)) {
+            for (byte *ptr = buf->next; ptr < buf->end; ptr += n_blocks * BYTES_PER_BLOCK) {
+                gc_free(ptr);
+            }
+        }
+        buf->next = NULL;
+        buf->end = NULL;
+    }
+    GC_EXIT();
+}
+#endif
+
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     bool has_finaliser = alloc_flags & GC_ALLOC_FLAG_HAS_FINALISER;
     size_t n_blocks = ((n_bytes + BYTES_PER_BLOCK - 1) & (~(BYTES_PER_BLOCK - 1))) / BYTES_PER_BLOCK;
@@ -878,6 +2180,28 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         return NULL;
     }
 
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // Small objects come from this thread's allocation buffer.  If that is
+    // empty then allocate a run of objects to refill it, unless sampling
+    // allocations, which must see each one.  The buffer isn't refilled while
+    // an incremental sweep is pending, because all of its objects would then
+    // survive that sweep, not just the ones handed out.
+    size_t obj_blocks = n_blocks;
+    if (!has_finaliser && n_blocks <= MICROPY_GC_THREAD_ALLOC_BUFFER_MAX_BLOCKS
+        #if MICROPY_GC_ALLOC_PROFILE
+        && MP_STATE_MEM(gc_alloc_profile_period) == 0
+        #endif
+        ) {
+        void *ptr = gc_alloc_from_buffer(n_blocks);
+        if (ptr != NULL) {
+            return ptr;
+        }
+        if (!GC_SWEEP_PENDING()) {
+            n_blocks *= MICROPY_GC_THREAD_ALLOC_BUFFER_OBJS;
+        }
+    }
+    #endif
+
     GC_ENTER();
 
     mp_state_mem_area_t *area;
@@ -909,8 +2233,18 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            size_t scan_start = area->gc_last_free_atb_index;
+            #if MICROPY_GC_FREE_RUN_INDEX
+            // Multi-block allocations first look from the first run that is
+            // known to be big enough, skipping the fragmented start of the heap.
+            bool scan_fallback = false;
+            if (n_blocks > 1) {
+                scan_start = area->gc_free_run_atb_index[gc_free_run_class_ceil(n_blocks)];
+            }
+        rescan:
+            #endif
             n_free = 0;
-            for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
+            for (i = scan_start; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
                 byte a = area->gc_alloc_table_start[i];
                 // *FORMAT-OFF*
@@ -921,6 +2255,21 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
                 // *FORMAT-ON*
             }
 
+            #if MICROPY_GC_FREE_RUN_INDEX
+            if (n_blocks > 1 && !scan_fallback) {
+                // Nothing big enough from there to the end of the area.  Smaller
+                // runs that still fit may exist before scan_start, so look for
+                // them from the start of the next smaller class.
+                gc_free_run_advance(area, n_blocks, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB - 1);
+                size_t lower_start = area->gc_free_run_atb_index[gc_free_run_class_floor(n_blocks)];
+                scan_fallback = true;
+                if (lower_start < scan_start) {
+                    scan_start = lower_start;
+                    goto rescan;
+                }
+            }
+            #endif
+
             // No free blocks found on this heap. Mark this heap as
             // filled, so we won't try to find free space here again until
             // space is freed.
@@ -931,8 +2280,25 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             #endif
         }
 
+        #if MICROPY_GC_THREAD_ALLOC_BUFFER
+        if (n_blocks != obj_blocks) {
+            // No room to refill the buffer, so just allocate the one object.
+            n_blocks = obj_blocks;
+            continue;
+        }
+        #endif
+
         GC_EXIT();
         // nothing found!
+        #if MICROPY_GC_INCREMENTAL
+        if (gc_sweep_pending()) {
+            // Blocks found unreachable by the last collection are still to be
+            // freed, so finish that before trying a new collection.
+            gc_sweep_finish();
+            GC_ENTER();
+            continue;
+        }
+        #endif
         if (collected) {
             #if MICROPY_GC_SPLIT_HEAP_AUTO
             if (!added && gc_try_add_heap(n_bytes)) {
@@ -943,7 +2309,15 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             return NULL;
         }
         DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering GC\n", n_bytes);
+        #if MICROPY_GC_DEFERRED_FINALISERS
+        // Memory is needed now, so don't keep unreachable objects around to
+        // be finalised later.
+        MP_STATE_MEM(gc_finaliser_inline) = true;
         gc_collect();
+        MP_STATE_MEM(gc_finaliser_inline) = false;
+        #else
+        gc_collect();
+        #endif
         collected = 1;
         GC_ENTER();
     }
@@ -966,15 +2340,46 @@ found:
         area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    if (n_blocks > 1) {
+        gc_free_run_advance(area, n_blocks, end_block);
+    }
+    #endif
+
     area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
 
-    // mark first block as used head
-    ATB_FREE_TO_HEAD(area, start_block);
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    if (n_blocks != obj_blocks) {
+        // Refilling the buffer: the run is split into separate objects, the
+        // first of which is returned and the rest handed out later.
+        for (size_t bl = start_block; bl <= end_block; bl += obj_blocks) {
+            ATB_FREE_TO_HEAD(area, bl);
+            for (size_t tail = bl + 1; tail < bl + obj_blocks; tail++) {
+                ATB_FREE_TO_TAIL(area, tail);
+            }
+            #if MICROPY_GC_INCREMENTAL
+            gc_sweep_note_alloc(area, bl, bl + obj_blocks - 1);
+            #endif
+        }
+        mp_state_thread_alloc_buffer_t *buf = &MP_STATE_THREAD(gc_alloc_buffer)[obj_blocks - 1];
+        buf->next = area->gc_pool_start + (start_block + obj_blocks) * BYTES_PER_BLOCK;
+        buf->end = area->gc_pool_start + (end_block + 1) * BYTES_PER_BLOCK;
+        buf->epoch = MP_STATE_MEM(gc_alloc_buffer_epoch);
+    } else
+    #endif
+    {
+        // mark first block as used head
+        ATB_FREE_TO_HEAD(area, start_block);
 
-    // mark rest of blocks as used tail
-    // TODO for a run of many blocks can make this more efficient
-    for (size_t bl = start_block + 1; bl <= end_block; bl++) {
-        ATB_FREE_TO_TAIL(area, bl);
+        // mark rest of blocks as used tail
+        // TODO for a run of many blocks can make this more efficient
+        for (size_t bl = start_block + 1; bl <= end_block; bl++) {
+            ATB_FREE_TO_TAIL(area, bl);
+        }
+
+        #if MICROPY_GC_INCREMENTAL
+        gc_sweep_note_alloc(area, start_block, end_block);
+        #endif
     }
 
     // get pointer to first block
@@ -986,6 +2391,12 @@ found:
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    #if MICROPY_GC_ALLOC_PROFILE
+    if (MP_STATE_MEM(gc_alloc_profile_period) != 0 && --MP_STATE_MEM(gc_alloc_profile_countdown) == 0) {
+        gc_alloc_profile_sample(n_bytes);
+    }
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -1055,7 +2466,7 @@ void gc_free(void *ptr) {
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
     assert(ATB_GET_KIND(area, block) == AT_HEAD
-        || (ATB_GET_KIND(area, block) == AT_MARK && (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG)));
+        || (ATB_GET_KIND(area, block) == AT_MARK && ((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) || GC_SWEEP_PENDING())));
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1087,11 +2498,18 @@ void gc_free(void *ptr) {
     }
 
     // free head and all of its tail blocks
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t start_block = block;
+    #endif
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    #if MICROPY_GC_FREE_RUN_INDEX
+    gc_free_run_freed(area, start_block, block);
+    #endif
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1115,7 +2533,7 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        if (ATB_GET_KIND(area, block) == AT_HEAD || (ATB_GET_KIND(area, block) == AT_MARK && GC_SWEEP_PENDING())) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1161,7 +2579,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_GET_KIND(area, block) == AT_HEAD || (ATB_GET_KIND(area, block) == AT_MARK && GC_SWEEP_PENDING()));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1217,6 +2635,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             area->gc_last_free_atb_index = (block + new_blocks) / BLOCKS_PER_ATB;
         }
 
+        #if MICROPY_GC_FREE_RUN_INDEX
+        gc_free_run_freed(area, block + new_blocks, block + n_blocks);
+        #endif
+
         GC_EXIT();
 
         #if EXTENSIVE_HEAP_PROFILING
@@ -1237,6 +2659,12 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
 
+        #if MICROPY_GC_INCREMENTAL
+        if (MP_STATE_MEM(gc_sweep_phase) == GC_SWEEP_PHASE_FREE && area == MP_STATE_MEM(gc_sweep_area)) {
+            MP_STATE_MEM(gc_sweep).last_used_block = MAX(MP_STATE_MEM(gc_sweep).last_used_block, end_block - 1);
+        }
+        #endif
+
         GC_EXIT();
 
         #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -58,6 +58,51 @@ void gc_collect_end(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+#if MICROPY_GC_INCREMENTAL
+// Run the mark phase of a collection now (via gc_collect) and leave the sweep
+// phase pending, to be done by gc_sweep_step.  Until the sweep is complete,
+// unreachable memory is not available for allocation.
+void gc_collect_incremental(void);
+// Do up to n_blocks worth of pending sweep work.  Returns true if no sweep
+// is pending any more.
+bool gc_sweep_step(size_t n_blocks);
+void gc_sweep_finish(void);
+bool gc_sweep_pending(void);
+#endif
+
+#if MICROPY_GC_THREAD_ALLOC_BUFFER
+// Free the objects left in this thread's allocation buffers, eg when the thread
+// finishes, rather than leaving them until the next collection.
+void gc_alloc_buffer_release(void);
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK
+// Set the number of threads used to mark the heap, from 1 up to
+// MICROPY_GC_PARALLEL_MARK_MAX_THREADS.  Returns false, leaving one mark
+// thread, if their deques can't be allocated.
+bool gc_mark_threads(size_t n_threads);
+#endif
+
+#if MICROPY_GC_COMPACT
+// Collect garbage, then move the payloads of some objects down the heap to
+// reduce fragmentation.  Returns the number of bytes moved.
+size_t gc_compact(void);
+#endif
+
+#if MICROPY_GC_ADAPTIVE_THRESHOLD
+// Set the targets for the pause of each collection and for the percentage of
+// time spent collecting, which the allocation threshold is then tuned to meet
+// after each collection.  A target of 0 is ignored; both 0 stops the tuning.
+void gc_target(mp_uint_t pause_us, mp_uint_t overhead_pct);
+#endif
+
+#if MICROPY_GC_ALLOC_PROFILE
+// Clear the allocation profile and sample every period'th allocation from now
+// on, or stop sampling if period is 0.
+void gc_alloc_profile(size_t period);
+void gc_alloc_profile_print(const mp_print_t *print);
+#endif
+
 // These functions are used to manage weakrefs.
 void gc_weakref_mark(void *ptr);
 void gc_weakref_about_to_be_freed(void *ptr);
@@ -70,6 +115,7 @@ enum {
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags);
 void gc_free(void *ptr); // does not call finaliser
 size_t gc_nbytes(const void *ptr);
+bool gc_is_heap_ptr(const void *ptr); // ptr may point anywhere in a block
 void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move);
 
 typedef struct _gc_info_t {
@@ -181,6 +181,12 @@ fetch_next_byte:
         } else if (chr2 == MP_LEXER_EOF) {
             chr2 = MP_LEXER_INVALID_BYTE;
         }
+
+        #if MICROPY_EMIT_NATIVE_TIERING
+        if (chr2 != MP_LEXER_EOF) {
+            lex->source_hash = (lex->source_hash * 33) ^ chr2;
+        }
+        #endif
     }
 
     if (lex->chr1 == '\r') {
@@ -1061,6 +1067,9 @@ mp_lexer_t *mp_lexer_new(qstr src_name, mp_reader_t reader) {
     lex->reader = reader;
     lex->line = 1;
     lex->column = (size_t)-2; // account for 3 dummy bytes
+    #if MICROPY_EMIT_NATIVE_TIERING
+    lex->source_hash = 5381;
+    #endif
     lex->emit_dent = 0;
     lex->nested_bracket_level = 0;
     lex->alloc_indent_level = MICROPY_ALLOC_LEXER_INDENT_INIT;
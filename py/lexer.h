@@ -168,6 +168,10 @@ typedef struct _mp_lexer_t {
     size_t line;                // current source line
     size_t column;              // current source column
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    uint32_t source_hash;       // hash of the bytes read from the source so far
+    #endif
+
     mp_int_t emit_dent;             // non-zero when there are INDENT/DEDENT tokens to emit
     mp_int_t nested_bracket_level;  // >0 when there are nested brackets over multiple lines
 
@@ -86,6 +86,17 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 /******************************************************************************/
 /* map                                                                        */
 
+#if MICROPY_OPT_MAP_VERSION
+// Give the map a new version, after a key has been added or removed.
+void mp_map_changed(mp_map_t *map) {
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    map->version = __atomic_add_fetch(&MP_STATE_VM(map_version), 1, __ATOMIC_RELAXED);
+    #else
+    map->version = ++MP_STATE_VM(map_version);
+    #endif
+}
+#endif
+
 void mp_map_init(mp_map_t *map, size_t n) {
     if (n == 0) {
         map->alloc = 0;
@@ -98,6 +109,9 @@ void mp_map_init(mp_map_t *map, size_t n) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    #if MICROPY_OPT_MAP_VERSION
+    map->version = 0;
+    #endif
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -107,6 +121,9 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->is_fixed = 1;
     map->is_ordered = 1;
     map->table = (mp_map_elem_t *)table;
+    #if MICROPY_OPT_MAP_VERSION
+    map->version = 0;
+    #endif
 }
 
 // Differentiate from mp_map_clear() - semantics is different
@@ -126,6 +143,7 @@ void mp_map_clear(mp_map_t *map) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->table = NULL;
+    mp_map_changed(map);
 }
 
 static void mp_map_rehash(mp_map_t *map) {
@@ -203,6 +221,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                     elem = &map->table[map->used];
                     elem->key = MP_OBJ_NULL;
                     elem->value = value;
+                    mp_map_changed(map);
                 }
                 #endif
                 MAP_CACHE_SET(index, elem - map->table);
@@ -225,6 +244,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         if (!mp_obj_is_qstr(index)) {
             map->all_keys_are_qstrs = 0;
         }
+        mp_map_changed(map);
         return elem;
         #else
         return NULL;
@@ -266,6 +286,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                 if (!mp_obj_is_qstr(index)) {
                     map->all_keys_are_qstrs = 0;
                 }
+                mp_map_changed(map);
                 return avail_slot;
             } else {
                 return NULL;
@@ -288,6 +309,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                     slot->key = MP_OBJ_SENTINEL;
                 }
                 // keep slot->value so that caller can access it if needed
+                mp_map_changed(map);
             }
             MAP_CACHE_SET(index, pos);
             return slot;
@@ -307,6 +329,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                     if (!mp_obj_is_qstr(index)) {
                         map->all_keys_are_qstrs = 0;
                     }
+                    mp_map_changed(map);
                     return avail_slot;
                 } else {
                     // not enough room in table, rehash it
@@ -28,6 +28,14 @@
 #include "py/obj.h"
 #include "py/gc.h"
 
+#if MICROPY_GC_INCREMENTAL
+#include "py/mphal.h"
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK || MICROPY_GC_ALLOC_PROFILE || MICROPY_GC_DEFERRED_FINALISERS || MICROPY_GC_ADAPTIVE_THRESHOLD
+#include "py/runtime.h"
+#endif
+
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
 // collect(): run a garbage collection
@@ -41,6 +49,34 @@ static mp_obj_t py_gc_collect(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(gc_collect_obj, py_gc_collect);
 
+#if MICROPY_GC_INCREMENTAL
+// collect_step(us): do part of a garbage collection, taking about us microseconds
+static mp_obj_t gc_collect_step(mp_obj_t budget_in) {
+    mp_uint_t budget = mp_obj_get_int(budget_in);
+    mp_uint_t start = mp_hal_ticks_us();
+    if (!gc_sweep_pending()) {
+        // Start a new collection.  The mark phase can't be split up.
+        gc_collect_incremental();
+    }
+    // Always make some progress, even if the budget is already used up.
+    do {
+        if (gc_sweep_step(MICROPY_GC_INCREMENTAL_STEP_BLOCKS)) {
+            return mp_const_true;
+        }
+    } while (mp_hal_ticks_us() - start < budget);
+    return mp_const_false;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(gc_collect_step_obj, gc_collect_step);
+#endif
+
+#if MICROPY_GC_COMPACT
+// compact(): run a garbage collection, then move objects' data down the heap
+static mp_obj_t py_gc_compact(void) {
+    return mp_obj_new_int_from_uint(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, py_gc_compact);
+#endif
+
 // disable(): disable the garbage collector
 static mp_obj_t gc_disable(void) {
     MP_STATE_MEM(gc_auto_collect_enabled) = 0;
@@ -90,6 +126,10 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
         return mp_obj_new_int(MP_STATE_MEM(gc_alloc_threshold) * MICROPY_BYTES_PER_GC_BLOCK);
     }
     mp_int_t val = mp_obj_get_int(args[0]);
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    // an explicit threshold replaces any adaptive one
+    gc_target(0, 0);
+    #endif
     if (val < 0) {
         MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
     } else {
@@ -100,14 +140,195 @@ static mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+#if MICROPY_GC_ADAPTIVE_THRESHOLD
+// target([pause_ms, overhead_pct]): get or set the targets that the allocation
+// threshold is tuned to meet
+static mp_obj_t gc_target_fun(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_pause_ms, ARG_overhead_pct };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_pause_ms, MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_overhead_pct, MP_ARG_INT, {.u_int = 0} },
+    };
+    if (n_args == 0 && kw_args->used == 0) {
+        mp_obj_t items[2] = {
+            #if MICROPY_PY_BUILTINS_FLOAT
+            mp_obj_new_float((mp_float_t)MP_STATE_MEM(gc_target_pause_us) / 1000),
+            #else
+            mp_obj_new_int_from_uint(MP_STATE_MEM(gc_target_pause_us) / 1000),
+            #endif
+            mp_obj_new_int_from_uint(MP_STATE_MEM(gc_target_overhead_pct)),
+        };
+        return mp_obj_new_tuple(2, items);
+    }
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    mp_int_t pause_us = 0;
+    if (args[ARG_pause_ms].u_obj != MP_OBJ_NULL) {
+        #if MICROPY_PY_BUILTINS_FLOAT
+        pause_us = (mp_int_t)(mp_obj_get_float(args[ARG_pause_ms].u_obj) * 1000);
+        #else
+        pause_us = mp_obj_get_int(args[ARG_pause_ms].u_obj) * 1000;
+        #endif
+    }
+    mp_int_t overhead_pct = args[ARG_overhead_pct].u_int;
+    if (pause_us < 0 || overhead_pct < 0 || overhead_pct >= 100) {
+        mp_raise_ValueError(NULL);
+    }
+    gc_target(pause_us, overhead_pct);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(gc_target_obj, 0, gc_target_fun);
+
+// stats(): return statistics of recent collections as a dict
+static mp_obj_t gc_stats(void) {
+    mp_obj_t dict = mp_obj_new_dict(7);
+    size_t threshold = MP_STATE_MEM(gc_alloc_threshold);
+    mp_obj_t items[] = {
+        MP_OBJ_NEW_QSTR(MP_QSTR_collections), mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_collections)),
+        MP_OBJ_NEW_QSTR(MP_QSTR_pause_us), mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_pause_us)),
+        MP_OBJ_NEW_QSTR(MP_QSTR_max_pause_us), mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_max_pause_us)),
+        MP_OBJ_NEW_QSTR(MP_QSTR_total_pause_us), mp_obj_new_int_from_ull(MP_STATE_MEM(gc_stats_total_pause_us)),
+        MP_OBJ_NEW_QSTR(MP_QSTR_survival_pct), mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_survival_pct)),
+        MP_OBJ_NEW_QSTR(MP_QSTR_alloc_rate), mp_obj_new_int_from_uint(MP_STATE_MEM(gc_stats_alloc_rate) * MICROPY_BYTES_PER_GC_BLOCK),
+        MP_OBJ_NEW_QSTR(MP_QSTR_threshold), threshold == (size_t)-1 ? MP_OBJ_NEW_SMALL_INT(-1) : mp_obj_new_int_from_uint(threshold * MICROPY_BYTES_PER_GC_BLOCK),
+    };
+    for (size_t i = 0; i < MP_ARRAY_SIZE(items); i += 2) {
+        mp_obj_dict_store(dict, items[i], items[i + 1]);
+    }
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_stats_obj, gc_stats);
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK
+// mark_threads([n]): get or set the number of threads used to mark the heap
+static mp_obj_t py_gc_mark_threads(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return MP_OBJ_NEW_SMALL_INT(MP_STATE_MEM(gc_mark_threads));
+    }
+    mp_int_t val = mp_obj_get_int(args[0]);
+    if (val < 1 || val > MICROPY_GC_PARALLEL_MARK_MAX_THREADS) {
+        mp_raise_ValueError(NULL);
+    }
+    if (!gc_mark_threads(val)) {
+        m_malloc_fail(val * sizeof(mp_state_mem_mark_deque_t));
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_mark_threads_obj, 0, 1, py_gc_mark_threads);
+#endif
+
+#if MICROPY_GC_DEFERRED_FINALISERS
+// finaliser_batch([n]): get or set the number of finalisers run per scheduled
+// batch; 0 means finalisers run during the sweep
+static mp_obj_t gc_finaliser_batch(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(MP_STATE_MEM(gc_finaliser_batch));
+    }
+    mp_int_t val = mp_obj_get_int(args[0]);
+    if (val < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    MP_STATE_MEM(gc_finaliser_batch) = val;
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_finaliser_batch_obj, 0, 1, gc_finaliser_batch);
+
+// finaliser_stats(): return the number of finalisers waiting to run and the
+// total number that have run
+static mp_obj_t gc_finaliser_stats(void) {
+    mp_obj_t items[2] = {
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_finaliser_queue_len)),
+        mp_obj_new_int_from_uint(MP_STATE_MEM(gc_finalisers_run)),
+    };
+    return mp_obj_new_tuple(2, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_finaliser_stats_obj, gc_finaliser_stats);
+#endif
+
+#if MICROPY_GC_ALLOC_PROFILE
+// alloc_profile([period]): start sampling every period'th allocation, or
+// return the sampled stacks as a list of (stack, count, bytes)
+static mp_obj_t gc_alloc_profile_fun(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 1) {
+        mp_int_t period = mp_obj_get_int(args[0]);
+        if (period < 0) {
+            mp_raise_ValueError(NULL);
+        }
+        gc_alloc_profile(period);
+        return mp_const_none;
+    }
+
+    // Don't sample the allocations made while building the result.
+    size_t period = MP_STATE_MEM(gc_alloc_profile_period);
+    MP_STATE_MEM(gc_alloc_profile_period) = 0;
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    for (size_t i = 0; i < MICROPY_GC_ALLOC_PROFILE_SITES; ++i) {
+        const mp_state_mem_alloc_site_t *site = &MP_STATE_MEM(gc_alloc_profile_sites)[i];
+        if (site->count == 0) {
+            continue;
+        }
+        // Frames are given outermost first, like a traceback.
+        mp_obj_tuple_t *stack = MP_OBJ_TO_PTR(mp_obj_new_tuple(site->depth, NULL));
+        for (size_t j = 0; j < site->depth; ++j) {
+            const mp_state_mem_alloc_frame_t *frame = &site->frames[site->depth - 1 - j];
+            mp_obj_t items[3] = {
+                MP_OBJ_NEW_QSTR(frame->source_file),
+                MP_OBJ_NEW_QSTR(frame->block_name),
+                MP_OBJ_NEW_SMALL_INT(frame->line),
+            };
+            stack->items[j] = mp_obj_new_tuple(3, items);
+        }
+        mp_obj_t items[3] = {
+            MP_OBJ_FROM_PTR(stack),
+            mp_obj_new_int_from_uint(site->count),
+            mp_obj_new_int_from_uint(site->bytes),
+        };
+        mp_obj_list_append(list, mp_obj_new_tuple(3, items));
+    }
+    if (MP_STATE_MEM(gc_alloc_profile_other_count) != 0) {
+        mp_obj_t items[3] = {
+            mp_const_empty_tuple,
+            mp_obj_new_int_from_uint(MP_STATE_MEM(gc_alloc_profile_other_count)),
+            mp_obj_new_int_from_uint(MP_STATE_MEM(gc_alloc_profile_other_bytes)),
+        };
+        mp_obj_list_append(list, mp_obj_new_tuple(3, items));
+    }
+    MP_STATE_MEM(gc_alloc_profile_period) = period;
+    return list;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_alloc_profile_obj, 0, 1, gc_alloc_profile_fun);
+#endif
+
 static const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
+    #if MICROPY_GC_ALLOC_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_alloc_profile), MP_ROM_PTR(&gc_alloc_profile_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
+    #if MICROPY_GC_INCREMENTAL
+    { MP_ROM_QSTR(MP_QSTR_collect_step), MP_ROM_PTR(&gc_collect_step_obj) },
+    #endif
+    #if MICROPY_GC_COMPACT
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_disable), MP_ROM_PTR(&gc_disable_obj) },
     { MP_ROM_QSTR(MP_QSTR_enable), MP_ROM_PTR(&gc_enable_obj) },
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    { MP_ROM_QSTR(MP_QSTR_finaliser_batch), MP_ROM_PTR(&gc_finaliser_batch_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finaliser_stats), MP_ROM_PTR(&gc_finaliser_stats_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_isenabled), MP_ROM_PTR(&gc_isenabled_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_free), MP_ROM_PTR(&gc_mem_free_obj) },
     { MP_ROM_QSTR(MP_QSTR_mem_alloc), MP_ROM_PTR(&gc_mem_alloc_obj) },
+    #if MICROPY_GC_PARALLEL_MARK
+    { MP_ROM_QSTR(MP_QSTR_mark_threads), MP_ROM_PTR(&gc_mark_threads_obj) },
+    #endif
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_target), MP_ROM_PTR(&gc_target_obj) },
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
@@ -25,12 +25,14 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/builtin.h"
 #include "py/cstack.h"
 #include "py/runtime.h"
 #include "py/gc.h"
 #include "py/mphal.h"
+#include "py/objlist.h"
 
 #if MICROPY_PY_MICROPYTHON
 
@@ -158,12 +160,87 @@ static MP_DEFINE_CONST_FUN_OBJ_1(mp_micropython_kbd_intr_obj, mp_micropython_kbd
 
 #if MICROPY_ENABLE_SCHEDULER
 static mp_obj_t mp_micropython_schedule(mp_obj_t function, mp_obj_t arg) {
-    if (!mp_sched_schedule(function, arg)) {
+    if (!mp_sched_schedule_soft(function, arg)) {
         mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("schedule queue full"));
     }
     return mp_const_none;
 }
 static MP_DEFINE_CONST_FUN_OBJ_2(mp_micropython_schedule_obj, mp_micropython_schedule);
+
+#if MICROPY_SCHEDULER_OVERFLOW
+static mp_obj_t mp_micropython_schedule_overflow(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_int_from_uint(MP_STATE_VM(sched_overflow_max));
+    }
+    mp_int_t max = mp_obj_get_int(args[0]);
+    if (max < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    MP_STATE_VM(sched_overflow_max) = max;
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_schedule_overflow_obj, 0, 1, mp_micropython_schedule_overflow);
+#endif
+
+#if MICROPY_SCHEDULER_STATS
+static mp_obj_t mp_micropython_schedule_counts(size_t source) {
+    mp_obj_t items[3] = {
+        mp_obj_new_int_from_uint(MP_STATE_VM(sched_scheduled)[source]),
+        mp_obj_new_int_from_uint(MP_STATE_VM(sched_deferred)[source]),
+        mp_obj_new_int_from_uint(MP_STATE_VM(sched_dropped)[source]),
+    };
+    return mp_obj_new_tuple(3, items);
+}
+
+static mp_obj_t mp_micropython_schedule_stats(size_t n_args, const mp_obj_t *args) {
+    mp_obj_t latency[MICROPY_SCHEDULER_STATS_BUCKETS];
+    for (size_t i = 0; i < MICROPY_SCHEDULER_STATS_BUCKETS; ++i) {
+        latency[i] = mp_obj_new_int_from_uint(MP_STATE_VM(sched_latency)[i]);
+    }
+    mp_obj_t items[3] = {
+        mp_micropython_schedule_counts(MP_SCHED_SOURCE_HARD),
+        mp_micropython_schedule_counts(MP_SCHED_SOURCE_SOFT),
+        mp_obj_new_tuple(MICROPY_SCHEDULER_STATS_BUCKETS, latency),
+    };
+    if (n_args == 1 && mp_obj_is_true(args[0])) {
+        memset(MP_STATE_VM(sched_scheduled), 0, sizeof(MP_STATE_VM(sched_scheduled)));
+        memset(MP_STATE_VM(sched_deferred), 0, sizeof(MP_STATE_VM(sched_deferred)));
+        memset(MP_STATE_VM(sched_dropped), 0, sizeof(MP_STATE_VM(sched_dropped)));
+        memset(MP_STATE_VM(sched_latency), 0, sizeof(MP_STATE_VM(sched_latency)));
+    }
+    return mp_obj_new_tuple(3, items);
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_schedule_stats_obj, 0, 1, mp_micropython_schedule_stats);
+#endif
+#endif
+
+#if MICROPY_EMIT_NATIVE_TIERING
+static mp_obj_t mp_micropython_native_tier(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        // Return a list of the functions promoted to native code so far.
+        if (MP_STATE_VM(native_tier_list) == MP_OBJ_NULL) {
+            return mp_obj_new_list(0, NULL);
+        }
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_list_get(MP_STATE_VM(native_tier_list), &len, &items);
+        return mp_obj_new_list(len, items);
+    }
+    mp_int_t threshold = mp_obj_get_int(args[0]);
+    if (threshold < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    MP_STATE_VM(native_tier_threshold) = threshold;
+    if (n_args == 2) {
+        mp_int_t budget = mp_obj_get_int(args[1]);
+        if (budget < 0) {
+            mp_raise_ValueError(NULL);
+        }
+        MP_STATE_VM(native_tier_budget) = budget;
+    }
+    return mp_const_none;
+}
+static MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_native_tier_obj, 0, 2, mp_micropython_native_tier);
 #endif
 
 static const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
@@ -197,6 +274,9 @@ static const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_heap_locked), MP_ROM_PTR(&mp_micropython_heap_locked_obj) },
     #endif
     #endif
+    #if MICROPY_EMIT_NATIVE_TIERING
+    { MP_ROM_QSTR(MP_QSTR_native_tier), MP_ROM_PTR(&mp_micropython_native_tier_obj) },
+    #endif
     #if MICROPY_KBD_EXCEPTION
     { MP_ROM_QSTR(MP_QSTR_kbd_intr), MP_ROM_PTR(&mp_micropython_kbd_intr_obj) },
     #endif
@@ -205,6 +285,12 @@ static const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #endif
     #if MICROPY_ENABLE_SCHEDULER
     { MP_ROM_QSTR(MP_QSTR_schedule), MP_ROM_PTR(&mp_micropython_schedule_obj) },
+    #if MICROPY_SCHEDULER_OVERFLOW
+    { MP_ROM_QSTR(MP_QSTR_schedule_overflow), MP_ROM_PTR(&mp_micropython_schedule_overflow_obj) },
+    #endif
+    #if MICROPY_SCHEDULER_STATS
+    { MP_ROM_QSTR(MP_QSTR_schedule_stats), MP_ROM_PTR(&mp_micropython_schedule_stats_obj) },
+    #endif
     #endif
 };
 
@@ -31,6 +31,7 @@
 
 #if MICROPY_PY_THREAD
 
+#include "py/gc.h"
 #include "py/mpthread.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -198,6 +199,10 @@ static void *thread_entry(void *args_in) {
 
     DEBUG_printf("[thread] finish ts=%p\n", &ts);
 
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    gc_alloc_buffer_release();
+    #endif
+
     // signal that we are finished
     mp_thread_finish();
 
@@ -281,6 +281,128 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_GC_ALLOC_THRESHOLD (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// Support gc.target(), which retunes the allocation threshold after each
+// collection to meet a target pause time and GC overhead, and gc.stats().
+// Requires MICROPY_GC_ALLOC_THRESHOLD and mp_hal_ticks_us().
+#ifndef MICROPY_GC_ADAPTIVE_THRESHOLD
+#define MICROPY_GC_ADAPTIVE_THRESHOLD (0)
+#endif
+
+// Keep an index of free runs of blocks, grouped in power-of-two size classes,
+// so that multi-block allocations don't need to rescan the start of a
+// fragmented heap.  The index is rebuilt on each sweep and costs one word
+// per size class per heap area.
+#ifndef MICROPY_GC_FREE_RUN_INDEX
+#define MICROPY_GC_FREE_RUN_INDEX (0)
+#endif
+
+// Number of size classes in the free-run index.  Class c holds runs of at
+// least (2 << c) blocks; allocations larger than the biggest class use it.
+#ifndef MICROPY_GC_FREE_RUN_NUM_CLASSES
+#define MICROPY_GC_FREE_RUN_NUM_CLASSES (8)
+#endif
+
+// Support collections whose sweep phase (running finalisers and freeing
+// blocks) is spread over many short steps, driven by gc.collect_step().
+// The mark phase still runs in one go.
+#ifndef MICROPY_GC_INCREMENTAL
+#define MICROPY_GC_INCREMENTAL (0)
+#endif
+
+// Number of blocks to sweep between checks of the time budget given to
+// gc.collect_step().
+#ifndef MICROPY_GC_INCREMENTAL_STEP_BLOCKS
+#define MICROPY_GC_INCREMENTAL_STEP_BLOCKS (256)
+#endif
+
+// Allow the mark phase of a collection to be shared between several threads,
+// set with gc.mark_threads().  The port must provide mp_thread_gc_run_workers().
+#ifndef MICROPY_GC_PARALLEL_MARK
+#define MICROPY_GC_PARALLEL_MARK (0)
+#endif
+
+// Maximum number of threads that can share the mark phase.
+#ifndef MICROPY_GC_PARALLEL_MARK_MAX_THREADS
+#define MICROPY_GC_PARALLEL_MARK_MAX_THREADS (8)
+#endif
+
+// Hook called while a mark thread has no work and waits for other threads.
+#ifndef MICROPY_GC_PARALLEL_MARK_WAIT
+#define MICROPY_GC_PARALLEL_MARK_WAIT()
+#endif
+
+// Number of entries in the work-stealing deque of each mark thread.  If a
+// deque fills up then the heap is rescanned, as for gc_block_stack.  The
+// deques are allocated on the heap when more than one mark thread is set.
+#ifndef MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE
+#define MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE (4096)
+#endif
+
+// Support a sampling allocation profiler, set with gc.alloc_profile(), which
+// records the Python call stack of every Nth call to gc_alloc().
+#ifndef MICROPY_GC_ALLOC_PROFILE
+#define MICROPY_GC_ALLOC_PROFILE (0)
+#endif
+
+// Maximum number of frames recorded for each sampled stack.  Deeper stacks
+// keep their innermost frames.
+#ifndef MICROPY_GC_ALLOC_PROFILE_DEPTH
+#define MICROPY_GC_ALLOC_PROFILE_DEPTH (8)
+#endif
+
+// Number of distinct stacks that the allocation profiler can record.  Samples
+// from further stacks are only counted in total.
+#ifndef MICROPY_GC_ALLOC_PROFILE_SITES
+#define MICROPY_GC_ALLOC_PROFILE_SITES (64)
+#endif
+
+// Support gc.compact(), which moves the payloads of some objects (list items,
+// bytearray/array buffers, str/bytes data, dict and instance member tables)
+// down into free space lower in the heap, to reduce fragmentation.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// Maximum number of payloads that gc.compact() considers moving at a time.
+// Each group of payloads costs two collections.
+#ifndef MICROPY_GC_COMPACT_MAX_CANDIDATES
+#define MICROPY_GC_COMPACT_MAX_CANDIDATES (32)
+#endif
+
+// Whether the finalisers of unreachable objects can be queued during the sweep
+// and run afterwards in batches from the scheduler, so they don't lengthen the
+// collection.  This is turned on at runtime with gc.finaliser_batch().
+// Requires MICROPY_ENABLE_FINALISER and MICROPY_SCHEDULER_STATIC_NODES.
+#ifndef MICROPY_GC_DEFERRED_FINALISERS
+#define MICROPY_GC_DEFERRED_FINALISERS (0)
+#endif
+
+// Maximum number of objects waiting for their finaliser to be run.  When the
+// queue is full, finalisers are run during the sweep as usual.
+#ifndef MICROPY_GC_DEFERRED_FINALISERS_MAX
+#define MICROPY_GC_DEFERRED_FINALISERS_MAX (64)
+#endif
+
+// Whether each thread serves small allocations from its own buffer of
+// preallocated objects, without taking the GC mutex.  This is only useful with
+// threads and no GIL.  It relies on every thread's registers and stack being
+// scanned during every collection, as the unix port does by signalling threads.
+#ifndef MICROPY_GC_THREAD_ALLOC_BUFFER
+#define MICROPY_GC_THREAD_ALLOC_BUFFER (0)
+#endif
+
+// Largest allocation, in blocks, that is served from a thread's buffer.  Each
+// thread has a separate buffer for each size up to this.
+#ifndef MICROPY_GC_THREAD_ALLOC_BUFFER_MAX_BLOCKS
+#define MICROPY_GC_THREAD_ALLOC_BUFFER_MAX_BLOCKS (2)
+#endif
+
+// Number of objects that are preallocated each time a thread's buffer is
+// refilled.  Objects still in a buffer at a collection are freed by it.
+#ifndef MICROPY_GC_THREAD_ALLOC_BUFFER_OBJS
+#define MICROPY_GC_THREAD_ALLOC_BUFFER_OBJS (16)
+#endif
+
 // Number of bytes to allocate initially when creating new chunks to store
 // interned string data.  Smaller numbers lead to more chunks being needed
 // and more wastage at the end of the chunk.  Larger numbers lead to wasted
@@ -380,6 +502,21 @@ typedef uint64_t mp_uint_t;
 #endif
 #endif
 
+// Whether to hash qstrs (and str/bytes objects) 4 bytes at a time, instead of
+// with the byte-at-a-time djb2 algorithm.  This changes the hash values, so
+// must match the setting used to build any frozen code (makeqstrdata.py and
+// mpy-tool.py pick it up from the qstr header).
+#ifndef MICROPY_QSTR_HASH_WORDWISE
+#define MICROPY_QSTR_HASH_WORDWISE (0)
+#endif
+
+// Whether to keep a hash index of the qstrs that are created at runtime, so
+// qstr_find_strn() doesn't need to search all of them.  The index uses 2 to 4
+// words of heap for each such qstr.
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX (0)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -423,6 +560,14 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
 #endif
 
+// Whether to load the functions of a memory-mapped .mpy file (eg in ROMFS) only
+// when a function object is first made from them, instead of at import.  Only
+// applies to .mpy files without native code.  Can't be used together with
+// MICROPY_PERSISTENT_CODE_SAVE.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_LAZY
+#define MICROPY_PERSISTENT_CODE_LOAD_LAZY (0)
+#endif
+
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
 #ifndef MICROPY_PERSISTENT_CODE_SAVE_FILE
 #define MICROPY_PERSISTENT_CODE_SAVE_FILE (0)
@@ -553,6 +698,18 @@ typedef uint64_t mp_uint_t;
 // generated or loaded from a file).  This does not cover inline asm code.
 #define MICROPY_ENABLE_NATIVE_CODE (MICROPY_EMIT_NATIVE || MICROPY_PERSISTENT_CODE_LOAD_NATIVE)
 
+// Whether to support promoting hot bytecode functions to native code at
+// runtime, see micropython.native_tier().  A promoted function is recompiled
+// from its source file, so this only applies to code loaded from .py files.
+#ifndef MICROPY_EMIT_NATIVE_TIERING
+#define MICROPY_EMIT_NATIVE_TIERING (0)
+#endif
+
+// Default number of bytes of machine code that promoted functions may use
+#ifndef MICROPY_EMIT_NATIVE_TIERING_BUDGET
+#define MICROPY_EMIT_NATIVE_TIERING_BUDGET (16384)
+#endif
+
 /*****************************************************************************/
 /* Compiler configuration                                                    */
 
@@ -605,6 +762,19 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_COMP_CONST_FLOAT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// Whether to enable constant folding of str and bytes concatenation and repetition,
+// eg "a" + "b" rewritten as "ab" (when MICROPY_COMP_CONST_FOLDING is also enabled)
+#ifndef MICROPY_COMP_CONST_STR
+#define MICROPY_COMP_CONST_STR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Whether to allow calls to some pure builtins (abs, chr, len, max, min, ord) with
+// constant arguments within const(), eg X = const(len("abc")) (when MICROPY_COMP_CONST
+// and MICROPY_COMP_CONST_FOLDING are also enabled)
+#ifndef MICROPY_COMP_CONST_BUILTINS
+#define MICROPY_COMP_CONST_BUILTINS (MICROPY_COMP_CONST && MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Whether to enable optimisation of: a, b = c, d
 // Costs 124 bytes (Thumb2)
 #ifndef MICROPY_COMP_DOUBLE_TUPLE_ASSIGN
@@ -680,6 +850,42 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_OPT_COMPUTED_GOTO (0)
 #endif
 
+// Whether the bytecode compiler fuses some common sequences of opcodes into
+// single opcodes, and the VM supports these fused opcodes.  This reduces the
+// number of opcode dispatches.  .mpy files that use them are marked, and can't
+// be loaded if this option is disabled.  mpy-cross only emits them when given
+// "-X fused-opcodes".
+#ifndef MICROPY_OPT_FUSED_OPCODES
+#define MICROPY_OPT_FUSED_OPCODES (0)
+#endif
+
+// Whether the VM rewrites some generic opcodes in bytecode that is on the heap
+// into variants specialised for the types of operands that it sees, namely
+// small ints for arithmetic and compare ops, and lists indexed by a small int
+// or dicts indexed by a str for subscripts.  A specialised opcode that sees
+// other types is rewritten back.  Bytecode elsewhere, eg frozen, is left as is.
+#ifndef MICROPY_OPT_QUICKEN
+#define MICROPY_OPT_QUICKEN (0)
+#endif
+
+// Whether the VM keeps the top of the stack in a local variable, and so
+// likely in a register, across the dispatch of common opcodes such as loads
+// of locals and small ints, stores to locals, and small int arithmetic and
+// compares.  This saves a store and a load for each of these.  Requires
+// MICROPY_OPT_COMPUTED_GOTO, and adds a second 256-entry dispatch table.
+// This option is experimental.
+#ifndef MICROPY_OPT_VM_STACK_CACHE
+#define MICROPY_OPT_VM_STACK_CACHE (0)
+#endif
+
+// Whether the GC sweep frees all four blocks of an allocation-table byte at
+// once when none of them are marked, instead of looking at each block.  This
+// speeds up collections of heaps full of short-lived objects.  Increases
+// Thumb2 code size by about 60 bytes.
+#ifndef MICROPY_OPT_GC_FAST_SWEEP
+#define MICROPY_OPT_GC_FAST_SWEEP (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Optimise the fast path for loading attributes from instance types. Increases
 // Thumb2 code size by about 48 bytes.
 #ifndef MICROPY_OPT_LOAD_ATTR_FAST_PATH
@@ -700,6 +906,44 @@ typedef uint64_t mp_uint_t;
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// Whether each function keeps a cache of where its LOAD_ATTR and LOAD_METHOD
+// instructions last found their name, in the map of a class or module, or in
+// the members of instances of a class.  Avoids hashing and searching when the
+// name is looked up there again.  Uses RAM in the heap for each function that
+// runs, about 3 words for each such instruction.  Requires
+// MICROPY_OPT_MAP_VERSION, which also caches the lookups of LOAD_GLOBAL.
+#ifndef MICROPY_OPT_INLINE_CACHE
+#define MICROPY_OPT_INLINE_CACHE (0)
+#endif
+
+// Whether each map has a version that changes whenever a key is added or
+// removed, so that lookups in it can be memoised.  mp_load_global() uses this
+// to remember where each name was found (in the globals or in the builtins).
+// Uses an extra word in each map, including those of dicts and instances.
+// Requires MICROPY_PY_THREAD_GIL or __atomic builtins if threads are enabled.
+#ifndef MICROPY_OPT_MAP_VERSION
+#define MICROPY_OPT_MAP_VERSION (0)
+#endif
+
+// Number of entries in the memo of mp_load_global() for each thread (a power
+// of 2).
+#ifndef MICROPY_OPT_MAP_VERSION_MEMO_SIZE
+#define MICROPY_OPT_MAP_VERSION_MEMO_SIZE (32)
+#endif
+
+// Whether instances of a class share one array of the names of their members,
+// and each only holds an array of the values (see py/objtype.h).  This saves
+// RAM when there are many instances with the same members.
+#ifndef MICROPY_OPT_INSTANCE_SHARED_KEYS
+#define MICROPY_OPT_INSTANCE_SHARED_KEYS (0)
+#endif
+
+// Maximum number of member names shared by the instances of a class.  An
+// instance that gets a member with another name has its members in a map.
+#ifndef MICROPY_OPT_INSTANCE_SHARED_KEYS_MAX
+#define MICROPY_OPT_INSTANCE_SHARED_KEYS_MAX (30)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -1233,6 +1477,33 @@ typedef time_t mp_timestamp_t;
 #define MICROPY_SCHEDULER_DEPTH (4)
 #endif
 
+// Whether callbacks can be added to the scheduler queue without entering an
+// atomic section, so any number of interrupt handlers and threads can add them
+// concurrently.  Requires the __atomic builtins of gcc or clang.
+#ifndef MICROPY_SCHEDULER_LOCK_FREE
+#define MICROPY_SCHEDULER_LOCK_FREE (0)
+#endif
+
+// Whether callbacks scheduled outside of interrupt handlers (see
+// mp_sched_schedule_soft) that don't fit in the scheduler queue can be kept
+// on a list on the heap, enabled at runtime via micropython.schedule_overflow()
+#ifndef MICROPY_SCHEDULER_OVERFLOW
+#define MICROPY_SCHEDULER_OVERFLOW (0)
+#endif
+
+// Whether to count scheduled, deferred and dropped callbacks, and keep a
+// histogram of the time from scheduling a callback to running it.
+// Requires mp_hal_ticks_us().
+#ifndef MICROPY_SCHEDULER_STATS
+#define MICROPY_SCHEDULER_STATS (0)
+#endif
+
+// Number of buckets in the latency histogram; bucket i counts callbacks that
+// ran less than 2**i microseconds after being scheduled.
+#ifndef MICROPY_SCHEDULER_STATS_BUCKETS
+#define MICROPY_SCHEDULER_STATS_BUCKETS (16)
+#endif
+
 // Support for generic VFS sub-system
 #ifndef MICROPY_VFS
 #define MICROPY_VFS (0)
@@ -1846,6 +2117,10 @@ typedef time_t mp_timestamp_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// Whether the VM keeps the chain of running bytecode functions in
+// MP_STATE_THREAD(current_code_state), for settrace and the allocation profiler
+#define MICROPY_VM_CODE_STATE_CHAIN (MICROPY_PY_SYS_SETTRACE || MICROPY_GC_ALLOC_PROFILE)
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -72,10 +72,20 @@ typedef struct mp_dynamic_compiler_t {
     #if MICROPY_ENABLE_SOURCE_LINE
     bool include_source_lines;
     #endif
+    #if MICROPY_OPT_FUSED_OPCODES
+    bool fused_opcodes;
+    #endif
 } mp_dynamic_compiler_t;
 extern mp_dynamic_compiler_t mp_dynamic_compiler;
 #endif
 
+// Whether the bytecode emitter uses fused opcodes.
+#if MICROPY_OPT_FUSED_OPCODES && MICROPY_DYNAMIC_COMPILER
+#define MP_EMIT_FUSED_OPCODES (mp_dynamic_compiler.fused_opcodes)
+#else
+#define MP_EMIT_FUSED_OPCODES (MICROPY_OPT_FUSED_OPCODES)
+#endif
+
 // These are the values for sched_state
 #define MP_SCHED_IDLE (1)
 #define MP_SCHED_LOCKED (-1)
@@ -84,8 +94,21 @@ extern mp_dynamic_compiler_t mp_dynamic_compiler;
 typedef struct _mp_sched_item_t {
     mp_obj_t func;
     mp_obj_t arg;
+    #if MICROPY_SCHEDULER_LOCK_FREE
+    // Position in the queue that this slot may next be written at, or that
+    // position plus one once the item has been written.
+    size_t seq;
+    #endif
+    #if MICROPY_SCHEDULER_STATS
+    mp_uint_t ticks_us;
+    #endif
 } mp_sched_item_t;
 
+// Sources of scheduled callbacks, for the scheduler statistics
+#define MP_SCHED_SOURCE_HARD (0) // mp_sched_schedule(), eg from an interrupt handler
+#define MP_SCHED_SOURCE_SOFT (1) // mp_sched_schedule_soft(), eg micropython.schedule()
+#define MP_SCHED_NUM_SOURCES (2)
+
 // gc_lock_depth field is a combination of the GC_COLLECT_FLAG
 // bit and a lock depth shifted GC_LOCK_DEPTH_SHIFT bits left.
 #if MICROPY_ENABLE_FINALISER
@@ -117,9 +140,64 @@ typedef struct _mp_state_mem_area_t {
     byte *gc_pool_end;
 
     size_t gc_last_free_atb_index;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    // For each size class c, no run of (2 << c) or more free blocks starts
+    // before ATB index gc_free_run_atb_index[c].
+    size_t gc_free_run_atb_index[MICROPY_GC_FREE_RUN_NUM_CLASSES];
+    #endif
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
 } mp_state_mem_area_t;
 
+// This structure holds the progress of a sweep through one memory area.
+typedef struct _mp_state_mem_sweep_t {
+    size_t block; // the next block to sweep
+    size_t last_used_block;
+    #if MICROPY_GC_FREE_RUN_INDEX
+    size_t free_run_start;
+    #endif
+    bool free_tail;
+} mp_state_mem_sweep_t;
+
+#if MICROPY_GC_ALLOC_PROFILE
+// One frame of a stack sampled by the allocation profiler.
+typedef struct _mp_state_mem_alloc_frame_t {
+    qstr source_file;
+    qstr block_name;
+    size_t line;
+} mp_state_mem_alloc_frame_t;
+
+// The allocations sampled with one particular stack, innermost frame first.
+// An unused entry has a count of zero.
+typedef struct _mp_state_mem_alloc_site_t {
+    size_t count;
+    size_t bytes;
+    size_t depth;
+    mp_state_mem_alloc_frame_t frames[MICROPY_GC_ALLOC_PROFILE_DEPTH];
+} mp_state_mem_alloc_site_t;
+#endif
+
+#if MICROPY_GC_COMPACT
+// A payload that gc_compact() may move, and the number of references to it
+// found by the last census.
+typedef struct _mp_state_mem_compact_t {
+    void **owner_field;
+    byte *start;
+    size_t n_bytes;
+    size_t refs;
+} mp_state_mem_compact_t;
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK
+// A work-stealing deque of blocks whose children are still to be marked.  The
+// owning mark thread pushes and pops at the bottom, other threads steal from
+// the top.
+typedef struct _mp_state_mem_mark_deque_t {
+    mp_int_t top;
+    mp_int_t bottom;
+    void *ptrs[MICROPY_GC_PARALLEL_MARK_DEQUE_SIZE];
+} mp_state_mem_mark_deque_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -147,6 +225,24 @@ typedef struct _mp_state_mem_t {
     size_t gc_alloc_threshold;
     #endif
 
+    #if MICROPY_GC_ADAPTIVE_THRESHOLD
+    // Targets for the adaptive allocation threshold (0 means no target).
+    mp_uint_t gc_target_pause_us;
+    mp_uint_t gc_target_overhead_pct;
+    // Statistics of recent collections, used to tune the threshold.  Block
+    // counts and the allocation rate (in blocks per second) are in GC blocks.
+    mp_uint_t gc_stats_start_us;
+    mp_uint_t gc_stats_end_us;
+    size_t gc_stats_collections;
+    size_t gc_stats_alloc_blocks;
+    size_t gc_stats_used_blocks;
+    size_t gc_stats_alloc_rate;
+    size_t gc_stats_survival_pct;
+    mp_uint_t gc_stats_pause_us;
+    mp_uint_t gc_stats_max_pause_us;
+    uint64_t gc_stats_total_pause_us;
+    #endif
+
     #if MICROPY_GC_SPLIT_HEAP
     mp_state_mem_area_t *gc_last_free_area;
     #endif
@@ -155,6 +251,58 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    #if MICROPY_GC_INCREMENTAL
+    // The sweep phase of an incremental collection, see gc_sweep_step().
+    uint8_t gc_sweep_phase;
+    mp_state_mem_area_t *gc_sweep_area;
+    #if MICROPY_GC_SPLIT_HEAP_AUTO
+    mp_state_mem_area_t *gc_sweep_prev_area;
+    #endif
+    mp_state_mem_sweep_t gc_sweep;
+    #endif
+
+    #if MICROPY_GC_PARALLEL_MARK
+    // State of the parallel mark phase, see gc_mark_parallel().
+    size_t gc_mark_threads;
+    size_t gc_mark_idle;
+    bool gc_mark_rescan;
+    // One deque per mark thread, allocated on the heap by gc_mark_threads().
+    mp_state_mem_mark_deque_t *gc_mark_deque;
+    #endif
+
+    #if MICROPY_GC_ALLOC_PROFILE
+    // Sampling allocation profiler, see gc_alloc_profile_sample().  Samples
+    // without a Python stack, or that don't fit in the table, go in "other".
+    size_t gc_alloc_profile_period; // 0 if disabled
+    size_t gc_alloc_profile_countdown;
+    size_t gc_alloc_profile_other_count;
+    size_t gc_alloc_profile_other_bytes;
+    mp_state_mem_alloc_site_t gc_alloc_profile_sites[MICROPY_GC_ALLOC_PROFILE_SITES];
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    // Payloads being considered by gc_compact(), sorted by address.
+    bool gc_compact_census;
+    byte *gc_compact_ceiling;
+    size_t gc_compact_n;
+    mp_state_mem_compact_t gc_compact[MICROPY_GC_COMPACT_MAX_CANDIDATES];
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // Unreachable objects whose finalisers are to be run from the scheduler,
+    // at most gc_finaliser_batch at a time (0 means run them during the sweep).
+    size_t gc_finaliser_batch;
+    bool gc_finaliser_inline;
+    size_t gc_finaliser_queue_len;
+    void *gc_finaliser_queue[MICROPY_GC_DEFERRED_FINALISERS_MAX];
+    size_t gc_finalisers_run;
+    #endif
+
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // Incremented by each collection, to retire all threads' allocation buffers.
+    volatile size_t gc_alloc_buffer_epoch;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_recursive_mutex_t gc_mutex;
@@ -224,6 +372,11 @@ typedef struct _mp_state_vm_t {
     size_t qstr_last_alloc;
     size_t qstr_last_used;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    // If qstr_index couldn't be allocated, it isn't retried until this qstr.
+    qstr qstr_index_retry;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make qstr interning thread-safe.
     mp_thread_mutex_t qstr_mutex;
@@ -255,11 +408,33 @@ typedef struct _mp_state_vm_t {
     struct _mp_sched_node_t *sched_tail;
     #endif
 
+    #if MICROPY_SCHEDULER_LOCK_FREE
+    // These index sched_queue, modulo its depth.  Producers claim a slot by
+    // advancing sched_put; only the scheduler advances sched_get.
+    size_t sched_put;
+    size_t sched_get;
+    #else
     // These index sched_queue.
     uint8_t sched_len;
     uint8_t sched_idx;
     #endif
 
+    #if MICROPY_SCHEDULER_OVERFLOW
+    // Callbacks that didn't fit in sched_queue, linked from the root pointer
+    // sched_overflow_head.
+    struct _mp_sched_overflow_t *sched_overflow_tail;
+    size_t sched_overflow_len;
+    size_t sched_overflow_max;
+    #endif
+
+    #if MICROPY_SCHEDULER_STATS
+    size_t sched_scheduled[MP_SCHED_NUM_SOURCES];
+    size_t sched_deferred[MP_SCHED_NUM_SOURCES];
+    size_t sched_dropped[MP_SCHED_NUM_SOURCES];
+    size_t sched_latency[MICROPY_SCHEDULER_STATS_BUCKETS];
+    #endif
+    #endif
+
     #if MICROPY_ENABLE_VM_ABORT
     bool vm_abort;
     nlr_buf_t *nlr_abort;
@@ -274,12 +449,45 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    #if MICROPY_OPT_MAP_VERSION
+    // The most recent version given to a map, see mp_map_changed.
+    size_t map_version;
+    #endif
+
+    #if MICROPY_EMIT_NATIVE_TIERING
+    // See py/nativetier.c; a threshold of 0 disables promotion.
+    size_t native_tier_threshold;
+    size_t native_tier_budget;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
 // in this structure is scanned for root pointers.  Anything added to this
 // structure must have corresponding initialisation added to thread_entry (in
 // py/modthread.c).
+#if MICROPY_GC_THREAD_ALLOC_BUFFER
+// A run of preallocated objects of one size that a thread hands out without
+// taking the GC mutex.  It is only valid while epoch matches the GC's epoch.
+typedef struct _mp_state_thread_alloc_buffer_t {
+    byte *next;
+    byte *end;
+    size_t epoch;
+} mp_state_thread_alloc_buffer_t;
+#endif
+
+#if MICROPY_OPT_MAP_VERSION
+// Where mp_load_global last found a name, valid while the globals dict has
+// the given version.  pos is the position in the globals map, or in the
+// builtins map if MP_LOAD_GLOBAL_MEMO_BUILTIN is set.
+#define MP_LOAD_GLOBAL_MEMO_BUILTIN ((uint32_t)1 << 31)
+typedef struct _mp_load_global_memo_t {
+    size_t version;
+    uint32_t qst;
+    uint32_t pos;
+} mp_load_global_memo_t;
+#endif
+
 typedef struct _mp_state_thread_t {
     // Stack top at the start of program
     char *stack_top;
@@ -298,6 +506,11 @@ typedef struct _mp_state_thread_t {
     // See GC_LOCK_DEPTH_SHIFT for an explanation of this field.
     uint16_t gc_lock_depth;
 
+    #if MICROPY_OPT_MAP_VERSION
+    // See mp_load_global.
+    mp_load_global_memo_t load_global_memo[MICROPY_OPT_MAP_VERSION_MEMO_SIZE];
+    #endif
+
     ////////////////////////////////////////////////////////////
     // START ROOT POINTER SECTION
     // Everything that needs GC scanning must start here, and
@@ -319,9 +532,18 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+
+    #if MICROPY_VM_CODE_STATE_CHAIN
     struct _mp_code_state_t *current_code_state;
     #endif
 
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    // These are scanned so that the next object to be handed out by each
+    // buffer stays allocated if a collection races with this thread taking it.
+    mp_state_thread_alloc_buffer_t gc_alloc_buffer[MICROPY_GC_THREAD_ALLOC_BUFFER_MAX_BLOCKS];
+    #endif
+
     #if MICROPY_PY_SSL_MBEDTLS_NEED_ACTIVE_CONTEXT
     struct _mp_obj_ssl_context_t *tls_ssl_context;
     #endif
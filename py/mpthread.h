@@ -54,6 +54,18 @@ int mp_thread_recursive_mutex_lock(mp_thread_recursive_mutex_t *mutex, int wait)
 void mp_thread_recursive_mutex_unlock(mp_thread_recursive_mutex_t *mutex);
 #endif
 
+#if MICROPY_GC_PARALLEL_MARK
+// Call worker(0) on this thread and worker(1) .. worker(n_workers - 1) on helper
+// threads, returning true once they have all finished.  Returns false, without
+// calling any of them, if the helper threads can't be started.
+bool mp_thread_gc_run_workers(void (*worker)(size_t id), size_t n_workers);
+#endif
+
+#if MICROPY_GC_COMPACT && !MICROPY_PY_THREAD_GIL
+// Return true if the calling thread is the only thread that can run Python code.
+bool mp_thread_is_only_thread(void);
+#endif
+
 #endif // MICROPY_PY_THREAD
 
 #if MICROPY_PY_THREAD && MICROPY_PY_THREAD_GIL
@@ -25,6 +25,7 @@
  */
 
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
@@ -41,6 +42,40 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+#if (MICROPY_EMIT_INLINE_ASM || MICROPY_ENABLE_NATIVE_CODE) && MICROPY_PY_BUILTINS_FLOAT
+
+// A viper float is held in a machine word.  If mp_float_t fits then the word
+// holds its bits, so that arithmetic doesn't need to allocate, otherwise the
+// word is a pointer to a float object.
+static inline mp_float_t mp_native_word_to_float(mp_uint_t val) {
+    if (sizeof(mp_float_t) <= sizeof(mp_uint_t)) {
+        union {
+            mp_float_t f;
+            mp_uint_t u;
+        } v;
+        v.u = val;
+        return v.f;
+    } else {
+        return mp_obj_float_get((mp_obj_t)val);
+    }
+}
+
+static inline mp_uint_t mp_native_float_to_word(mp_float_t f) {
+    if (sizeof(mp_float_t) <= sizeof(mp_uint_t)) {
+        union {
+            mp_float_t f;
+            mp_uint_t u;
+        } v;
+        v.u = 0;
+        v.f = f;
+        return v.u;
+    } else {
+        return (mp_uint_t)mp_obj_new_float(f);
+    }
+}
+
+#endif
+
 #if MICROPY_ENABLE_NATIVE_CODE
 
 int mp_native_type_from_qstr(qstr qst) {
@@ -61,6 +96,10 @@ int mp_native_type_from_qstr(qstr qst) {
             return MP_NATIVE_TYPE_PTR16;
         case MP_QSTR_ptr32:
             return MP_NATIVE_TYPE_PTR32;
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case MP_QSTR_float:
+            return MP_NATIVE_TYPE_FLOAT;
+        #endif
         default:
             return -1;
     }
@@ -77,6 +116,10 @@ mp_uint_t mp_native_from_obj(mp_obj_t obj, mp_uint_t type) {
         case MP_NATIVE_TYPE_INT:
         case MP_NATIVE_TYPE_UINT:
             return mp_obj_get_int_truncated(obj);
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case MP_NATIVE_TYPE_FLOAT:
+            return mp_native_float_to_word(mp_obj_get_float(obj));
+        #endif
         default: { // cast obj to a pointer
             mp_buffer_info_t bufinfo;
             if (mp_get_buffer(obj, &bufinfo, MP_BUFFER_READ)) {
@@ -107,6 +150,14 @@ mp_obj_t mp_native_to_obj(mp_uint_t val, mp_uint_t type) {
             return mp_obj_new_int_from_uint(val);
         case MP_NATIVE_TYPE_QSTR:
             return MP_OBJ_NEW_QSTR(val);
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case MP_NATIVE_TYPE_FLOAT:
+            if (sizeof(mp_float_t) <= sizeof(mp_uint_t)) {
+                return mp_obj_new_float(mp_native_word_to_float(val));
+            } else {
+                return (mp_obj_t)val;
+            }
+        #endif
         default: // a pointer
             // we return just the value of the pointer as an integer
             return mp_obj_new_int_from_uint(val);
@@ -230,7 +281,61 @@ static bool mp_native_yield_from(mp_obj_t gen, mp_obj_t send_value, mp_obj_t *re
     return false;
 }
 
-#if !MICROPY_PY_BUILTINS_FLOAT
+#if MICROPY_PY_BUILTINS_FLOAT
+
+// Arithmetic on viper floats, with int arguments converted to float first.
+// Comparisons return a bool, and other ops return a float.
+static mp_uint_t mp_native_float_op(mp_uint_t op, mp_uint_t lhs, mp_uint_t rhs) {
+    mp_float_t lhs_val = (op & MP_NATIVE_FLOAT_OP_LHS_INT) ? (mp_float_t)(mp_int_t)lhs : mp_native_word_to_float(lhs);
+    if (op & MP_NATIVE_FLOAT_OP_TO_INT) {
+        return mp_obj_get_int_truncated(mp_obj_new_int_from_float(lhs_val));
+    }
+    mp_float_t rhs_val = (op & MP_NATIVE_FLOAT_OP_RHS_INT) ? (mp_float_t)(mp_int_t)rhs : mp_native_word_to_float(rhs);
+    switch (op & 0xff) {
+        case MP_BINARY_OP_ADD:
+            lhs_val += rhs_val;
+            break;
+        case MP_BINARY_OP_SUBTRACT:
+            lhs_val -= rhs_val;
+            break;
+        case MP_BINARY_OP_MULTIPLY:
+            lhs_val *= rhs_val;
+            break;
+        case MP_BINARY_OP_LESS:
+            return lhs_val < rhs_val;
+        case MP_BINARY_OP_MORE:
+            return lhs_val > rhs_val;
+        case MP_BINARY_OP_EQUAL:
+            return lhs_val == rhs_val;
+        case MP_BINARY_OP_LESS_EQUAL:
+            return lhs_val <= rhs_val;
+        case MP_BINARY_OP_MORE_EQUAL:
+            return lhs_val >= rhs_val;
+        case MP_BINARY_OP_NOT_EQUAL:
+            return lhs_val != rhs_val;
+        case MP_BINARY_OP_TRUE_DIVIDE:
+            if (rhs_val != 0) {
+                lhs_val /= rhs_val;
+                break;
+            }
+            MP_FALLTHROUGH
+        default:
+            // Less common ops, and division which may raise, go via the
+            // float object implementation.
+            lhs_val = mp_obj_get_float(mp_binary_op(op & 0xff, mp_obj_new_float(lhs_val), mp_obj_new_float(rhs_val)));
+            break;
+    }
+    return mp_native_float_to_word(lhs_val);
+}
+
+#else
+
+static mp_uint_t mp_native_float_op(mp_uint_t op, mp_uint_t lhs, mp_uint_t rhs) {
+    (void)op;
+    (void)lhs;
+    (void)rhs;
+    mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("float unsupported"));
+}
 
 static mp_obj_t mp_obj_new_float_from_f(float f) {
     (void)f;
@@ -356,6 +461,7 @@ const mp_fun_table_t mp_fun_table = {
     &mp_stream_readinto_obj,
     &mp_stream_unbuffered_readline_obj,
     &mp_stream_write_obj,
+    mp_native_float_op,
 };
 
 #elif MICROPY_ENABLE_NATIVE_CODE && MICROPY_DYNAMIC_COMPILER
@@ -82,9 +82,56 @@ typedef enum {
     MP_F_SMALL_INT_MODULO,
     MP_F_NATIVE_YIELD_FROM,
     MP_F_SETJMP,
+    // Entries for the dynamic runtime, see py/dynruntime.h.  The native
+    // emitter doesn't call these.
+    MP_F_MEMSET,
+    MP_F_MEMMOVE,
+    MP_F_REALLOC,
+    MP_F_PRINTF,
+    MP_F_VPRINTF,
+    MP_F_RAISE_MSG,
+    MP_F_OBJ_GET_TYPE,
+    MP_F_OBJ_NEW_STR,
+    MP_F_OBJ_NEW_BYTES,
+    MP_F_OBJ_NEW_BYTEARRAY_BY_REF,
+    MP_F_OBJ_NEW_FLOAT_FROM_F,
+    MP_F_OBJ_NEW_FLOAT_FROM_D,
+    MP_F_OBJ_GET_FLOAT_TO_F,
+    MP_F_OBJ_GET_FLOAT_TO_D,
+    MP_F_LOAD_METHOD_MAYBE,
+    MP_F_GET_BUFFER,
+    MP_F_GET_STREAM_RAISE,
+    MP_F_ARG_PARSE_ALL,
+    MP_F_ARG_PARSE_ALL_KW_ARRAY,
+    MP_F_BINARY_GET_SIZE,
+    MP_F_BINARY_GET_VAL_ARRAY,
+    MP_F_BINARY_SET_VAL_ARRAY,
+    MP_F_PLAT_PRINT,
+    MP_F_TYPE_TYPE,
+    MP_F_TYPE_STR,
+    MP_F_TYPE_LIST,
+    MP_F_TYPE_DICT,
+    MP_F_TYPE_FUN_BUILTIN_0,
+    MP_F_TYPE_FUN_BUILTIN_1,
+    MP_F_TYPE_FUN_BUILTIN_2,
+    MP_F_TYPE_FUN_BUILTIN_3,
+    MP_F_TYPE_FUN_BUILTIN_VAR,
+    MP_F_TYPE_EXCEPTION,
+    MP_F_STREAM_READ_OBJ,
+    MP_F_STREAM_READINTO_OBJ,
+    MP_F_STREAM_UNBUFFERED_READLINE_OBJ,
+    MP_F_STREAM_WRITE_OBJ,
+    MP_F_NATIVE_FLOAT_OP,
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
+// Flags for the op argument of mp_native_float_op(), which is otherwise a
+// binary op; these say which arguments are native ints rather than floats.
+#define MP_NATIVE_FLOAT_OP_LHS_INT (0x100)
+#define MP_NATIVE_FLOAT_OP_RHS_INT (0x200)
+// Op to convert a float to a native int, truncating it like int() does.
+#define MP_NATIVE_FLOAT_OP_TO_INT (0x400)
+
 typedef struct _mp_fun_table_t {
     mp_const_obj_t const_none;
     mp_const_obj_t const_false;
@@ -179,6 +226,8 @@ typedef struct _mp_fun_table_t {
     const mp_obj_fun_builtin_var_t *stream_readinto_obj;
     const mp_obj_fun_builtin_var_t *stream_unbuffered_readline_obj;
     const mp_obj_fun_builtin_var_t *stream_write_obj;
+    // The following entries are used by the native emitter.
+    mp_uint_t (*native_float_op)(mp_uint_t op, mp_uint_t lhs, mp_uint_t rhs);
 } mp_fun_table_t;
 
 #if (MICROPY_ENABLE_NATIVE_CODE && !MICROPY_DYNAMIC_COMPILER) || MICROPY_ENABLE_DYNRUNTIME
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 The MicroPython project contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/compile.h"
+#include "py/nativetier.h"
+#include "py/objlist.h"
+#include "py/runtime.h"
+
+#if MICROPY_EMIT_NATIVE_TIERING
+
+// Hot bytecode functions are promoted to native code as follows:
+// - A raw code compiled from source records the line of its def, and counts
+//   calls to its functions and branches taken in them by the VM.
+// - Once the count reaches the threshold set by micropython.native_tier(), the
+//   module is read from its source file and compiled again, this time with
+//   just that function using the native emitter.  This is only done if the
+//   source has the same hash as when it was first compiled.
+// - The function object keeps its identity, and forwards calls to a native
+//   version of itself, which shares its default arguments and globals.  Other
+//   function objects made from the same raw code get their native version the
+//   next time they're called.
+// The machine code made this way counts against a budget, and functions that
+// can't be promoted (eg the source isn't available or has changed) aren't
+// tried again.
+
+#if !MICROPY_EMIT_NATIVE
+#error "MICROPY_EMIT_NATIVE_TIERING requires a native emitter"
+#endif
+
+#if MICROPY_STACKLESS
+#error "MICROPY_EMIT_NATIVE_TIERING is not supported with MICROPY_STACKLESS"
+#endif
+
+// List of (name, source file, line, size) for the functions promoted so far.
+MP_REGISTER_ROOT_POINTER(mp_obj_t native_tier_list);
+
+// Compile the native version of fun, with no default arguments.  Returns NULL
+// if that's not possible or it doesn't fit in the budget.
+static mp_obj_fun_bc_t *native_tier_compile(mp_obj_fun_bc_t *fun) {
+    mp_raw_code_t *rc = fun->tier_rc;
+    const mp_module_context_t *context = fun->context;
+    #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+    qstr source_file = context->constants.qstr_table[0];
+    #else
+    qstr source_file = context->constants.source_file;
+    #endif
+    qstr name = mp_obj_fun_bc_get_name(fun);
+
+    mp_obj_fun_bc_t *native = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(source_file);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        // Only use the source if it's the same as when the function was first
+        // compiled, so the native code does the same as the bytecode.
+        if (parse_tree.source_hash == rc->tier_hash) {
+            mp_compiled_module_t cm;
+            cm.context = m_new_obj(mp_module_context_t);
+            cm.context->module.globals = context->module.globals;
+            mp_raw_code_t *native_rc = mp_compile_native_tier(&parse_tree, source_file, name, rc->tier_line, &cm);
+            if (native_rc != NULL && native_rc->kind == MP_CODE_NATIVE_PY
+                && native_rc->tier_size <= MP_STATE_VM(native_tier_budget)) {
+                native = MP_OBJ_TO_PTR(mp_obj_new_fun_native(NULL, native_rc->fun_data, cm.context, native_rc->children));
+                size_t size = native_rc->tier_size;
+                MP_STATE_VM(native_tier_budget) -= size;
+                if (MP_STATE_VM(native_tier_list) == MP_OBJ_NULL) {
+                    MP_STATE_VM(native_tier_list) = mp_obj_new_list(0, NULL);
+                }
+                mp_obj_t items[4] = {
+                    MP_OBJ_NEW_QSTR(name),
+                    MP_OBJ_NEW_QSTR(source_file),
+                    MP_OBJ_NEW_SMALL_INT(rc->tier_line),
+                    MP_OBJ_NEW_SMALL_INT(size),
+                };
+                mp_obj_list_append(MP_STATE_VM(native_tier_list), mp_obj_new_tuple(4, items));
+            }
+        } else {
+            mp_parse_tree_clear(&parse_tree);
+        }
+        nlr_pop();
+    } else {
+        // The source couldn't be read or compiled, so leave the function as it
+        // is, but don't hide a KeyboardInterrupt or similar.
+        if (!mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(((mp_obj_base_t *)nlr.ret_val)->type), MP_OBJ_FROM_PTR(&mp_type_Exception))) {
+            nlr_jump(nlr.ret_val);
+        }
+        native = NULL;
+    }
+    return native;
+}
+
+// Make fun run as native code from now on.  Returns false if it can't be
+// promoted, in which case it won't be counted any more.
+bool mp_native_tier_promote(mp_obj_fun_bc_t *fun) {
+    mp_raw_code_t *rc = fun->tier_rc;
+    if (rc->tier_native == NULL) {
+        if (rc->tier_line != 0 && MP_STATE_VM(native_tier_budget) != 0) {
+            rc->tier_native = native_tier_compile(fun);
+        }
+        if (rc->tier_native == NULL) {
+            rc->tier_line = 0;
+            fun->tier_rc = NULL;
+            return false;
+        }
+    }
+
+    // Make the native version of this function object, with the same default
+    // arguments.  Its context has the same globals but the constants of the
+    // module as compiled for the native code.
+    const byte *bc = fun->bytecode;
+    MP_BC_PRELUDE_SIG_DECODE(bc);
+    size_t n_extra_args = n_def_pos_args + ((scope_flags & MP_SCOPE_FLAG_DEFKWARGS) != 0);
+    mp_obj_fun_bc_t *native = mp_obj_malloc_var(mp_obj_fun_bc_t, extra_args, mp_obj_t, n_extra_args, &mp_type_fun_native);
+    memcpy(native, rc->tier_native, sizeof(mp_obj_fun_bc_t));
+    memcpy(native->extra_args, fun->extra_args, n_extra_args * sizeof(mp_obj_t));
+    fun->tier_fun = native;
+    return true;
+}
+
+#endif // MICROPY_EMIT_NATIVE_TIERING
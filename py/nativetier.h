@@ -0,0 +1,67 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 The MicroPython project contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_PY_NATIVETIER_H
+#define MICROPY_INCLUDED_PY_NATIVETIER_H
+
+#include "py/emitglue.h"
+#include "py/mpstate.h"
+#include "py/objfun.h"
+
+#if MICROPY_EMIT_NATIVE_TIERING
+
+bool mp_native_tier_promote(mp_obj_fun_bc_t *fun);
+
+// Count a call to a bytecode function, and return true if the call should go
+// to its native version, fun->tier_fun, instead.
+static inline bool mp_native_tier_call(mp_obj_fun_bc_t *fun) {
+    if (fun->tier_fun != NULL) {
+        return true;
+    }
+    mp_raw_code_t *rc = fun->tier_rc;
+    if (rc == NULL) {
+        return false;
+    }
+    ++rc->tier_count;
+    if (rc->tier_native == NULL) {
+        size_t threshold = MP_STATE_VM(native_tier_threshold);
+        if (threshold == 0 || rc->tier_count < threshold) {
+            return false;
+        }
+    }
+    return mp_native_tier_promote(fun);
+}
+
+// Count a branch taken by the VM, so that functions with long-running loops
+// are promoted on their next call.
+static inline void mp_native_tier_branch(mp_obj_fun_bc_t *fun) {
+    if (fun->tier_rc != NULL) {
+        ++fun->tier_rc->tier_count;
+    }
+}
+
+#endif // MICROPY_EMIT_NATIVE_TIERING
+
+#endif // MICROPY_INCLUDED_PY_NATIVETIER_H
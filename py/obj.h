@@ -412,6 +412,12 @@ typedef struct _mp_rom_obj_t { mp_const_obj_t o; } mp_rom_obj_t;
 // These macros are used to define constant map/dict objects
 // You can put "static" in front of the definition to make it local
 
+#if MICROPY_OPT_MAP_VERSION
+#define MP_MAP_VERSION_INIT .version = 0,
+#else
+#define MP_MAP_VERSION_INIT
+#endif
+
 #define MP_DEFINE_CONST_MAP(map_name, table_name) \
     const mp_map_t map_name = { \
         .all_keys_are_qstrs = 1, \
@@ -420,6 +426,7 @@ typedef struct _mp_rom_obj_t { mp_const_obj_t o; } mp_rom_obj_t;
         .used = MP_ARRAY_SIZE(table_name), \
         .alloc = MP_ARRAY_SIZE(table_name), \
         .table = (mp_map_elem_t *)(mp_rom_map_elem_t *)table_name, \
+        MP_MAP_VERSION_INIT \
     }
 
 #define MP_DEFINE_CONST_DICT_WITH_SIZE(dict_name, table_name, n) \
@@ -432,6 +439,7 @@ typedef struct _mp_rom_obj_t { mp_const_obj_t o; } mp_rom_obj_t;
             .used = n, \
             .alloc = n, \
             .table = (mp_map_elem_t *)(mp_rom_map_elem_t *)table_name, \
+            MP_MAP_VERSION_INIT \
         }, \
     }
 
@@ -485,6 +493,11 @@ typedef struct _mp_map_t {
     size_t used : (8 * sizeof(size_t) - 3);
     size_t alloc;
     mp_map_elem_t *table;
+    #if MICROPY_OPT_MAP_VERSION
+    // Changes whenever a key is added or removed, and is unique across all
+    // maps, except that it is 0 for maps that have never had a key added.
+    size_t version;
+    #endif
 } mp_map_t;
 
 // mp_set_lookup requires these constants to have the values they do
@@ -506,6 +519,11 @@ void mp_map_deinit(mp_map_t *map);
 mp_map_elem_t *mp_map_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind);
 void mp_map_clear(mp_map_t *map);
 void mp_map_dump(mp_map_t *map);
+#if MICROPY_OPT_MAP_VERSION
+void mp_map_changed(mp_map_t *map);
+#else
+#define mp_map_changed(map) (void)0
+#endif
 
 // Underlying set implementation (not set object)
 
@@ -270,6 +270,7 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     other->map.is_fixed = 0;
     other->map.is_ordered = self->map.is_ordered;
     memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    mp_map_changed(&other->map);
     return other_out;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -370,6 +371,7 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
     mp_obj_t items[] = {next->key, next->value};
     next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
     next->value = MP_OBJ_NULL;
+    mp_map_changed(&self->map);
     mp_obj_t tuple = mp_obj_new_tuple(2, items);
 
     return tuple;
@@ -35,6 +35,8 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/cstack.h"
+#include "py/gc.h"
+#include "py/nativetier.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -262,6 +264,12 @@ static mp_obj_t fun_bc_call(mp_obj_t self_in, size_t n_args, size_t n_kw, const
 
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    if (mp_native_tier_call(self)) {
+        return mp_call_function_n_kw(MP_OBJ_FROM_PTR(self->tier_fun), n_args, n_kw, args);
+    }
+    #endif
+
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
 
@@ -442,6 +450,18 @@ mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_
     o->bytecode = code;
     o->context = context;
     o->child_table = child_table;
+    #if MICROPY_OPT_QUICKEN
+    // only bytecode in the heap can be rewritten, not frozen bytecode or ROM
+    o->quicken = gc_is_heap_ptr(code);
+    #endif
+    #if MICROPY_OPT_INLINE_CACHE
+    o->inline_cache = NULL;
+    o->inline_cache_rc = NULL;
+    #endif
+    #if MICROPY_EMIT_NATIVE_TIERING
+    o->tier_rc = NULL;
+    o->tier_fun = NULL;
+    #endif
     if (def_pos_args != NULL) {
         memcpy(o->extra_args, def_pos_args->items, n_def_args * sizeof(mp_obj_t));
     }
@@ -29,14 +29,46 @@
 #include "py/bc.h"
 #include "py/obj.h"
 
+#if MICROPY_OPT_INLINE_CACHE
+// Where a LOAD_ATTR or LOAD_METHOD instruction last found its name, see vm.c.
+typedef struct _mp_inline_cache_entry_t {
+    const void *owner;  // map, or class of instances with shared keys, it was found in
+    size_t version;     // version of the map at the time, see mp_map_changed
+    uint16_t offset;    // of the end of the instruction from the start of the bytecode
+    uint16_t pos;       // position in the map, or in the shared keys
+    uint16_t succ;      // entry that was wanted after this one last time
+} mp_inline_cache_entry_t;
+
+// The entries for the instructions of a function that have run, in the order
+// that they first ran.
+typedef struct _mp_inline_cache_t {
+    uint16_t alloc;
+    uint16_t used;
+    uint16_t last;      // entry that was wanted last
+    uint16_t next;      // its succ, ie the entry likely to be wanted next
+    mp_inline_cache_entry_t entry[];
+} mp_inline_cache_t;
+#endif
+
 typedef struct _mp_obj_fun_bc_t {
     mp_obj_base_t base;
     const mp_module_context_t *context;         // context within which this function was defined
     struct _mp_raw_code_t *const *child_table;  // table of children
     const byte *bytecode;                       // bytecode for the function
+    #if MICROPY_OPT_QUICKEN
+    bool quicken;                               // whether the VM may rewrite the bytecode in place
+    #endif
+    #if MICROPY_OPT_INLINE_CACHE
+    mp_inline_cache_t *inline_cache;            // caches of name lookups, made as they run
+    struct _mp_raw_code_t *inline_cache_rc;     // raw code sharing inline_cache, if any
+    #endif
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    #if MICROPY_EMIT_NATIVE_TIERING
+    struct _mp_raw_code_t *tier_rc;             // raw code counting towards promotion, if any
+    struct _mp_obj_fun_bc_t *tier_fun;          // native version of this function, once promoted
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
@@ -112,6 +112,138 @@ mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *class, const mp_obj_
     return o;
 }
 
+#if MICROPY_OPT_INSTANCE_SHARED_KEYS
+
+// Split members are keyed by qstrs, so find the qstr of a key that is a str
+// (which may not be interned), or return MP_OBJ_NULL if there isn't one.
+static mp_obj_t instance_key_as_qstr(mp_obj_t key) {
+    if (mp_obj_is_qstr(key)) {
+        return key;
+    }
+    size_t len;
+    const char *str = mp_obj_str_get_data(key, &len);
+    qstr q = qstr_find_strn(str, len);
+    return q == MP_QSTRnull ? MP_OBJ_NULL : MP_OBJ_NEW_QSTR(q);
+}
+
+static bool instance_keys_replace(mp_obj_type_t *type, const mp_obj_tuple_t *old_keys, const mp_obj_tuple_t *new_keys) {
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    // Other threads may be adding members to other instances of this class.
+    const void *expected = old_keys;
+    return __atomic_compare_exchange_n(&type->slots[MP_OBJ_INSTANCE_TYPE_SLOT_KEYS], &expected, new_keys, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    #else
+    (void)old_keys;
+    type->slots[MP_OBJ_INSTANCE_TYPE_SLOT_KEYS] = new_keys;
+    return true;
+    #endif
+}
+
+// Return the slot for the value of the given qstr key in the split members of
+// self, making one if needed.  This only fails (returning NULL) when the key
+// is new to the class and it already has the maximum number of keys.
+static mp_obj_t *instance_split_member_add(mp_obj_instance_t *self, mp_obj_t key) {
+    mp_obj_type_t *type = (mp_obj_type_t *)self->base.type;
+    const mp_obj_tuple_t *keys = MP_OBJ_INSTANCE_TYPE_KEYS(type);
+    size_t pos = 0;
+    for (;;) {
+        while (pos < keys->len && keys->items[pos] != key) {
+            ++pos;
+        }
+        if (pos < keys->len) {
+            break;
+        }
+        if (keys->len >= MICROPY_OPT_INSTANCE_SHARED_KEYS_MAX) {
+            return NULL;
+        }
+        // Add the key to the class.  The keys are never changed in place, so
+        // that a lookup can't see them half-updated.
+        mp_obj_tuple_t *new_keys = MP_OBJ_TO_PTR(mp_obj_new_tuple(keys->len + 1, NULL));
+        memcpy(new_keys->items, keys->items, keys->len * sizeof(mp_obj_t));
+        new_keys->items[keys->len] = key;
+        if (instance_keys_replace(type, keys, new_keys)) {
+            keys = new_keys;
+        } else {
+            // Another thread added a key first, so search the new ones.
+            keys = MP_OBJ_INSTANCE_TYPE_KEYS(type);
+        }
+    }
+
+    mp_obj_t *values = mp_obj_instance_split_values(self);
+    size_t n = self->members.used;
+    if (pos < n) {
+        return &values[pos];
+    }
+    // Make room for all the members that instances of this class have had,
+    // because this instance is likely to get the same ones.
+    values = m_renew(mp_obj_t, values, n, keys->len);
+    memset(values + n, 0, (keys->len - n) * sizeof(mp_obj_t));
+    self->members.table = (mp_map_elem_t *)values;
+    self->members.used = keys->len;
+    return &values[pos];
+}
+
+// Put the split members of self into a map, for when they no longer fit the
+// shared keys of its class.
+static void instance_unshare_members(mp_obj_instance_t *self) {
+    mp_obj_t *values = mp_obj_instance_split_values(self);
+    size_t n = self->members.used;
+    const mp_obj_tuple_t *keys = MP_OBJ_INSTANCE_TYPE_KEYS(self->base.type);
+    mp_map_init(&self->members, n);
+    for (size_t i = 0; i < n; ++i) {
+        if (values[i] != MP_OBJ_NULL) {
+            mp_map_lookup(&self->members, keys->items[i], MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = values[i];
+        }
+    }
+    m_del(mp_obj_t, values, n);
+}
+
+mp_obj_t *mp_obj_instance_lookup_member(mp_obj_instance_t *self, mp_obj_t key) {
+    if (mp_obj_instance_members_are_split(self)) {
+        if (MP_UNLIKELY(!mp_obj_is_qstr(key))) {
+            key = instance_key_as_qstr(key);
+        }
+        // Only the keys that have a value in this instance need searching.
+        const mp_obj_tuple_t *keys = MP_OBJ_INSTANCE_TYPE_KEYS(self->base.type);
+        mp_obj_t *values = mp_obj_instance_split_values(self);
+        for (size_t i = 0, n = self->members.used; i < n; ++i) {
+            if (keys->items[i] == key) {
+                return values[i] == MP_OBJ_NULL ? NULL : &values[i];
+            }
+        }
+        return NULL;
+    }
+    mp_map_elem_t *elem = mp_map_lookup(&self->members, key, MP_MAP_LOOKUP);
+    return elem == NULL ? NULL : &elem->value;
+}
+
+void mp_obj_instance_store_member(mp_obj_instance_t *self, mp_obj_t key, mp_obj_t value) {
+    if (self->members.alloc == 0) {
+        // Members are split, or there are none yet.
+        mp_obj_t qst = instance_key_as_qstr(key);
+        mp_obj_t *slot = qst == MP_OBJ_NULL ? NULL : instance_split_member_add(self, qst);
+        if (slot != NULL) {
+            *slot = value;
+            return;
+        }
+        instance_unshare_members(self);
+    }
+    mp_map_lookup(&self->members, key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value;
+}
+
+bool mp_obj_instance_delete_member(mp_obj_instance_t *self, mp_obj_t key) {
+    if (mp_obj_instance_members_are_split(self)) {
+        mp_obj_t *slot = mp_obj_instance_lookup_member(self, key);
+        if (slot == NULL) {
+            return false;
+        }
+        *slot = MP_OBJ_NULL;
+        return true;
+    }
+    return mp_map_lookup(&self->members, key, MP_MAP_LOOKUP_REMOVE_IF_FOUND) != NULL;
+}
+
+#endif
+
 // TODO
 // This implements depth-first left-to-right MRO, which is not compliant with Python3 MRO
 // http://python-history.blogspot.com/2010/06/method-resolution-order.html
@@ -413,6 +545,11 @@ static mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
 
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
             + sizeof(*self->members.table) * self->members.alloc;
+        #if MICROPY_OPT_INSTANCE_SHARED_KEYS
+        if (mp_obj_instance_members_are_split(self)) {
+            sz += sizeof(mp_obj_t) * self->members.used;
+        }
+        #endif
         return MP_OBJ_NEW_SMALL_INT(sz);
     }
     #endif
@@ -590,20 +727,34 @@ static void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
     mp_obj_instance_t *self = MP_OBJ_TO_PTR(self_in);
 
     // Note: This is fast-path'ed in the VM for the MP_BC_LOAD_ATTR operation.
-    mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
-    if (elem != NULL) {
+    mp_obj_t *value = mp_obj_instance_lookup_member(self, MP_OBJ_NEW_QSTR(attr));
+    if (value != NULL) {
         // object member, always treated as a value
-        dest[0] = elem->value;
+        dest[0] = *value;
         return;
     }
     #if MICROPY_CPYTHON_COMPAT
     if (attr == MP_QSTR___dict__) {
         // Create a new dict with a copy of the instance's map items.
         // This creates, unlike CPython, a read-only __dict__ that can't be modified.
-        mp_obj_dict_t dict;
-        dict.base.type = &mp_type_dict;
-        dict.map = self->members;
-        dest[0] = mp_obj_dict_copy(MP_OBJ_FROM_PTR(&dict));
+        #if MICROPY_OPT_INSTANCE_SHARED_KEYS
+        if (mp_obj_instance_members_are_split(self)) {
+            const mp_obj_tuple_t *keys = MP_OBJ_INSTANCE_TYPE_KEYS(self->base.type);
+            mp_obj_t *values = mp_obj_instance_split_values(self);
+            dest[0] = mp_obj_new_dict(self->members.used);
+            for (size_t i = 0; i < self->members.used; ++i) {
+                if (values[i] != MP_OBJ_NULL) {
+                    mp_obj_dict_store(dest[0], keys->items[i], values[i]);
+                }
+            }
+        } else
+        #endif
+        {
+            mp_obj_dict_t dict;
+            dict.base.type = &mp_type_dict;
+            dict.map = self->members;
+            dest[0] = mp_obj_dict_copy(MP_OBJ_FROM_PTR(&dict));
+        }
         mp_obj_dict_t *dest_dict = MP_OBJ_TO_PTR(dest[0]);
         dest_dict->map.is_fixed = 1;
         return;
@@ -802,11 +953,10 @@ skip_special_accessors:
 
     if (value == MP_OBJ_NULL) {
         // delete attribute
-        mp_map_elem_t *elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
-        return elem != NULL;
+        return mp_obj_instance_delete_member(self, MP_OBJ_NEW_QSTR(attr));
     } else {
         // store attribute
-        mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value;
+        mp_obj_instance_store_member(self, MP_OBJ_NEW_QSTR(attr), value);
         return true;
     }
 }
@@ -1165,6 +1315,9 @@ MP_DEFINE_CONST_OBJ_TYPE(
     attr, type_attr
     );
 
+// Position of the parent slot of a new type, after the fixed ones.
+#define INSTANCE_TYPE_SLOT_PARENT (10 + MICROPY_OPT_INSTANCE_SHARED_KEYS)
+
 static mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict) {
     // Verify input objects have expected type
     if (!mp_obj_is_type(bases_tuple, &mp_type_tuple)) {
@@ -1213,10 +1366,11 @@ static mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals
     }
 
     // Allocate a variable-sized mp_obj_type_t with as many slots as we need
-    // (currently 10, plus 1 for base, plus 1 for base-protocol).
+    // (currently 10, plus 1 for the shared keys of instances if enabled, plus 1
+    // for base, plus 1 for base-protocol).
     // Note: mp_obj_type_t is (2 + 3 + #slots) words, so going from 11 to 12 slots
     // moves from 4 to 5 gc blocks.
-    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, 10 + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
+    mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, slots, void *, INSTANCE_TYPE_SLOT_PARENT + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
     o->base.type = &mp_type_type;
     o->flags = base_flags;
     o->name = name;
@@ -1233,15 +1387,20 @@ static mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals
     mp_obj_dict_t *locals_ptr = MP_OBJ_TO_PTR(locals_dict);
     MP_OBJ_TYPE_SET_SLOT(o, locals_dict, locals_ptr, 9);
 
+    #if MICROPY_OPT_INSTANCE_SHARED_KEYS
+    // This slot has no index field, it is only used by instance types.
+    o->slots[MP_OBJ_INSTANCE_TYPE_SLOT_KEYS] = &mp_const_empty_tuple_obj;
+    #endif
+
     if (bases_len > 0) {
         if (bases_len >= 2) {
             #if MICROPY_MULTIPLE_INHERITANCE
-            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_tuple), 10);
+            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_tuple), INSTANCE_TYPE_SLOT_PARENT);
             #else
             mp_raise_NotImplementedError(MP_ERROR_TEXT("multiple inheritance not supported"));
             #endif
         } else {
-            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_items[0]), 10);
+            MP_OBJ_TYPE_SET_SLOT(o, parent, MP_OBJ_TO_PTR(bases_items[0]), INSTANCE_TYPE_SLOT_PARENT);
         }
 
         // Inherit protocol from a base class. This allows to define an
@@ -1249,7 +1408,7 @@ static mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals
         // Python method calls, and any subclass inheriting from it will
         // support this feature.
         if (base_protocol) {
-            MP_OBJ_TYPE_SET_SLOT(o, protocol, base_protocol, 11);
+            MP_OBJ_TYPE_SET_SLOT(o, protocol, base_protocol, INSTANCE_TYPE_SLOT_PARENT + 1);
         }
     }
 
@@ -27,6 +27,7 @@
 #define MICROPY_INCLUDED_PY_OBJTYPE_H
 
 #include "py/obj.h"
+#include "py/objtuple.h"
 
 // instance object
 // creating an instance of a class makes one of these objects
@@ -37,6 +38,37 @@ typedef struct _mp_obj_instance_t {
     // TODO maybe cache __getattr__ and __setattr__ for efficient lookup of them
 } mp_obj_instance_t;
 
+#if MICROPY_OPT_INSTANCE_SHARED_KEYS
+// With shared keys, the names of the members of all instances of a class are
+// kept once, in a tuple of qstrs held by the class (which is only ever replaced
+// by a longer one).  Each instance starts out with its members "split": just
+// an array of their values in the same order, with MP_OBJ_NULL for those it
+// doesn't have.  For such an instance members.alloc is 0, members.table
+// points to the array of values and members.used is the length of the array.
+// An instance whose members don't fit this scheme, for example because the
+// class has too many different member names, gets a map as usual.
+#define MP_OBJ_INSTANCE_TYPE_SLOT_KEYS (10)
+#define MP_OBJ_INSTANCE_TYPE_KEYS(type) ((const mp_obj_tuple_t *)(type)->slots[MP_OBJ_INSTANCE_TYPE_SLOT_KEYS])
+#define mp_obj_instance_members_are_split(self) ((self)->members.alloc == 0 && (self)->members.table != NULL)
+#define mp_obj_instance_split_values(self) ((mp_obj_t *)(self)->members.table)
+
+// Access to the members of an instance, like mp_map_lookup on self->members.
+mp_obj_t *mp_obj_instance_lookup_member(mp_obj_instance_t *self, mp_obj_t key);
+void mp_obj_instance_store_member(mp_obj_instance_t *self, mp_obj_t key, mp_obj_t value);
+bool mp_obj_instance_delete_member(mp_obj_instance_t *self, mp_obj_t key);
+#else
+static inline mp_obj_t *mp_obj_instance_lookup_member(mp_obj_instance_t *self, mp_obj_t key) {
+    mp_map_elem_t *elem = mp_map_lookup(&self->members, key, MP_MAP_LOOKUP);
+    return elem == NULL ? NULL : &elem->value;
+}
+static inline void mp_obj_instance_store_member(mp_obj_instance_t *self, mp_obj_t key, mp_obj_t value) {
+    mp_map_lookup(&self->members, key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = value;
+}
+static inline bool mp_obj_instance_delete_member(mp_obj_instance_t *self, mp_obj_t key) {
+    return mp_map_lookup(&self->members, key, MP_MAP_LOOKUP_REMOVE_IF_FOUND) != NULL;
+}
+#endif
+
 #if MICROPY_CPYTHON_COMPAT
 // this is needed for object.__new__
 mp_obj_instance_t *mp_obj_new_instance(const mp_obj_type_t *cls, const mp_obj_type_t **native_base);
@@ -240,6 +240,11 @@ typedef struct _parser_t {
     #if MICROPY_COMP_CONST
     mp_map_t consts;
     #endif
+
+    #if MICROPY_COMP_CONST_FOLDING && MICROPY_COMP_CONST_BUILTINS
+    // rule stack depth of the trailer_paren of an enclosing const() call, or 0 if none
+    size_t const_call_depth;
+    #endif
 } parser_t;
 
 static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t num_args);
@@ -595,6 +600,28 @@ static mp_parse_node_t make_node_const_object_optimised(parser_t *parser, size_t
     }
 }
 
+// Create a parse node representing a str, interning it if it's short or already interned.
+static mp_parse_node_t make_node_str(parser_t *parser, size_t src_line, const char *str, size_t len) {
+    // Don't automatically intern all strings.  Doc strings (which are usually large)
+    // will be discarded by the compiler, and so we shouldn't intern them.
+    qstr qst = MP_QSTRnull;
+    if (len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
+        // intern short strings
+        qst = qstr_from_strn(str, len);
+    } else {
+        // check if this string is already interned
+        qst = qstr_find_strn(str, len);
+    }
+    if (qst != MP_QSTRnull) {
+        // qstr exists, make a leaf node
+        return mp_parse_node_new_leaf(MP_PARSE_NODE_STRING, qst);
+    } else {
+        // not interned, make a node holding a pointer to the string object
+        mp_obj_t o = mp_obj_new_str_copy(&mp_type_str, (const byte *)str, len);
+        return make_node_const_object(parser, src_line, o);
+    }
+}
+
 static void push_result_token(parser_t *parser, uint8_t rule_id) {
     mp_parse_node_t pn;
     mp_lexer_t *lex = parser->lexer;
@@ -620,24 +647,7 @@ static void push_result_token(parser_t *parser, uint8_t rule_id) {
         mp_obj_t o = mp_parse_num_float(lex->vstr.buf, lex->vstr.len, true, lex);
         pn = make_node_const_object(parser, lex->tok_line, o);
     } else if (lex->tok_kind == MP_TOKEN_STRING) {
-        // Don't automatically intern all strings.  Doc strings (which are usually large)
-        // will be discarded by the compiler, and so we shouldn't intern them.
-        qstr qst = MP_QSTRnull;
-        if (lex->vstr.len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
-            // intern short strings
-            qst = qstr_from_strn(lex->vstr.buf, lex->vstr.len);
-        } else {
-            // check if this string is already interned
-            qst = qstr_find_strn(lex->vstr.buf, lex->vstr.len);
-        }
-        if (qst != MP_QSTRnull) {
-            // qstr exists, make a leaf node
-            pn = mp_parse_node_new_leaf(MP_PARSE_NODE_STRING, qst);
-        } else {
-            // not interned, make a node holding a pointer to the string object
-            mp_obj_t o = mp_obj_new_str_copy(&mp_type_str, (const byte *)lex->vstr.buf, lex->vstr.len);
-            pn = make_node_const_object(parser, lex->tok_line, o);
-        }
+        pn = make_node_str(parser, lex->tok_line, lex->vstr.buf, lex->vstr.len);
     } else if (lex->tok_kind == MP_TOKEN_BYTES) {
         // make a node holding a pointer to the bytes object
         mp_obj_t o = mp_obj_new_bytes((const byte *)lex->vstr.buf, lex->vstr.len);
@@ -684,6 +694,79 @@ static bool binary_op_maybe(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs, mp_ob
     }
 }
 
+#if MICROPY_COMP_CONST_STR
+// Maximum length of a str or bytes object that constant folding can create.
+#define FOLD_STR_MAX_LEN (256)
+#endif
+
+// Get the value of an operand that can be folded: a number, or a str/bytes if enabled.
+static bool fold_get_operand(mp_parse_node_t pn, mp_obj_t *o) {
+    #if MICROPY_COMP_CONST_STR
+    if (MP_PARSE_NODE_IS_LEAF(pn) && MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_STRING) {
+        *o = MP_OBJ_NEW_QSTR(MP_PARSE_NODE_LEAF_ARG(pn));
+        return true;
+    } else if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        *o = mp_parse_node_extract_const_object((mp_parse_node_struct_t *)pn);
+        if (mp_obj_is_str_or_bytes(*o)) {
+            return true;
+        }
+    }
+    #endif
+    return mp_parse_node_get_number_maybe(pn, o);
+}
+
+static bool fold_binary_op(mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs, mp_obj_t *res) {
+    #if MICROPY_COMP_CONST_STR
+    if (mp_obj_is_str_or_bytes(lhs) || mp_obj_is_str_or_bytes(rhs)) {
+        // Only fold concatenation and repetition, and only if the result is small.
+        size_t len;
+        if (op == MP_BINARY_OP_ADD && mp_obj_is_str_or_bytes(lhs) && mp_obj_is_str_or_bytes(rhs)) {
+            size_t lhs_len, rhs_len;
+            mp_obj_str_get_data(lhs, &lhs_len);
+            mp_obj_str_get_data(rhs, &rhs_len);
+            len = lhs_len + rhs_len;
+        } else if (op == MP_BINARY_OP_MULTIPLY) {
+            mp_obj_t str = lhs;
+            mp_obj_t n = rhs;
+            if (!mp_obj_is_str_or_bytes(str)) {
+                str = rhs;
+                n = lhs;
+            }
+            if (!mp_obj_is_small_int(n)) {
+                return false;
+            }
+            mp_int_t count = MP_OBJ_SMALL_INT_VALUE(n);
+            if (count > FOLD_STR_MAX_LEN) {
+                return false;
+            }
+            mp_obj_str_get_data(str, &len);
+            len *= MAX(count, 0);
+        } else {
+            return false;
+        }
+        if (len > FOLD_STR_MAX_LEN) {
+            return false;
+        }
+    }
+    #endif
+    return binary_op_maybe(op, lhs, rhs, res);
+}
+
+// Push a parse node for an object that is the result of folding.
+static void push_result_folded(parser_t *parser, mp_obj_t obj) {
+    mp_parse_node_t pn;
+    if (obj == mp_const_false || obj == mp_const_true) {
+        pn = mp_parse_node_new_leaf(MP_PARSE_NODE_TOKEN, obj == mp_const_true ? MP_TOKEN_KW_TRUE : MP_TOKEN_KW_FALSE);
+    } else if (mp_obj_is_str(obj)) {
+        size_t len;
+        const char *str = mp_obj_str_get_data(obj, &len);
+        pn = make_node_str(parser, 0, str, len);
+    } else {
+        pn = make_node_const_object_optimised(parser, 0, obj);
+    }
+    push_result_node(parser, pn);
+}
+
 static bool fold_logical_constants(parser_t *parser, uint8_t rule_id, size_t *num_args) {
     if (rule_id == RULE_or_test
         || rule_id == RULE_and_test) {
@@ -780,21 +863,56 @@ static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
                || rule_id == RULE_term) {
         // folding for binary ops: << >> + - * @ / % //
         mp_parse_node_t pn = peek_result(parser, num_args - 1);
-        if (!mp_parse_node_get_number_maybe(pn, &arg0)) {
+        if (!fold_get_operand(pn, &arg0)) {
             return false;
         }
         for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
             pn = peek_result(parser, i - 1);
             mp_obj_t arg1;
-            if (!mp_parse_node_get_number_maybe(pn, &arg1)) {
+            if (!fold_get_operand(pn, &arg1)) {
                 return false;
             }
             mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(peek_result(parser, i));
             mp_binary_op_t op = MP_BINARY_OP_LSHIFT + (tok - MP_TOKEN_OP_DBL_LESS);
-            if (!binary_op_maybe(op, arg0, arg1, &arg0)) {
+            if (!fold_binary_op(op, arg0, arg1, &arg0)) {
                 return false;
             }
         }
+    } else if (rule_id == RULE_comparison) {
+        // folding for comparison ops: < > == >= <= != in
+        mp_obj_t lhs;
+        if (!fold_get_operand(peek_result(parser, num_args - 1), &lhs)) {
+            return false;
+        }
+        arg0 = mp_const_true;
+        for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
+            mp_parse_node_t pn_op = peek_result(parser, i);
+            mp_obj_t rhs;
+            if (!MP_PARSE_NODE_IS_TOKEN(pn_op) || !fold_get_operand(peek_result(parser, i - 1), &rhs)) {
+                return false;
+            }
+            #if MICROPY_DYNAMIC_COMPILER
+            // the target may use a different float precision to the compiler
+            if (mp_obj_is_float(lhs) || mp_obj_is_float(rhs)) {
+                return false;
+            }
+            #endif
+            mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(pn_op);
+            mp_binary_op_t op;
+            if (tok == MP_TOKEN_KW_IN) {
+                op = MP_BINARY_OP_IN;
+            } else {
+                op = MP_BINARY_OP_LESS + (tok - MP_TOKEN_OP_LESS);
+            }
+            mp_obj_t res;
+            if (!binary_op_maybe(op, lhs, rhs, &res)) {
+                return false;
+            }
+            if (res == mp_const_false) {
+                arg0 = mp_const_false;
+            }
+            lhs = rhs;
+        }
     } else if (rule_id == RULE_factor_2) {
         // folding for unary ops: + - ~
         mp_parse_node_t pn = peek_result(parser, 0);
@@ -908,11 +1026,122 @@ static bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     for (size_t i = num_args; i > 0; i--) {
         pop_result(parser);
     }
-    push_result_node(parser, make_node_const_object_optimised(parser, 0, arg0));
+    push_result_folded(parser, arg0);
 
     return true;
 }
 
+#if MICROPY_COMP_CONST_BUILTINS
+static const mp_rom_map_elem_t mp_const_builtins_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_abs), MP_ROM_PTR(&mp_builtin_abs_obj) },
+    { MP_ROM_QSTR(MP_QSTR_chr), MP_ROM_PTR(&mp_builtin_chr_obj) },
+    { MP_ROM_QSTR(MP_QSTR_len), MP_ROM_PTR(&mp_builtin_len_obj) },
+    #if MICROPY_PY_BUILTINS_MIN_MAX
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&mp_builtin_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&mp_builtin_min_obj) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_ord), MP_ROM_PTR(&mp_builtin_ord_obj) },
+};
+static MP_DEFINE_CONST_MAP(mp_const_builtins_map, mp_const_builtins_table);
+
+// Whether the object is a str that is the same with and without unicode support.
+static bool fold_is_ascii_str(mp_obj_t o) {
+    size_t len;
+    const byte *str = (const byte *)mp_obj_str_get_data(o, &len);
+    while (len--) {
+        if (*str++ >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Called when the parser starts on the arguments of a trailer_paren rule, which has
+// just been pushed on the rule stack.  If the trailer directly follows a "const" atom
+// then record that the arguments are within a const() call.
+static void fold_enter_call(parser_t *parser) {
+    if (parser->const_call_depth == 0
+        && parser->rule_stack_top >= 2
+        && parser->rule_stack[parser->rule_stack_top - 2].rule_id == RULE_trailer) {
+        mp_parse_node_t pn = peek_result(parser, 0);
+        if (MP_PARSE_NODE_IS_ID(pn) && MP_PARSE_NODE_LEAF_ARG(pn) == MP_QSTR_const) {
+            parser->const_call_depth = parser->rule_stack_top;
+        }
+    }
+}
+
+// Called when a trailer_paren rule is reduced, to leave any enclosing const() call.
+static void fold_leave_call(parser_t *parser) {
+    if (parser->rule_stack_top + 1 == parser->const_call_depth) {
+        parser->const_call_depth = 0;
+    }
+}
+
+static bool fold_builtin_call(parser_t *parser, uint8_t rule_id) {
+    // this code folds calls to pure builtins with constant arguments within const(),
+    // eg const(len("abc")) -> const(3)
+
+    if (rule_id != RULE_atom_expr_normal) {
+        return false;
+    }
+    mp_parse_node_t pn0 = peek_result(parser, 1);
+    mp_parse_node_t pn1 = peek_result(parser, 0);
+    if (!(MP_PARSE_NODE_IS_ID(pn0)
+          && MP_PARSE_NODE_IS_STRUCT_KIND(pn1, RULE_trailer_paren))) {
+        return false;
+    }
+    mp_map_elem_t *elem = mp_map_lookup((mp_map_t *)&mp_const_builtins_map, MP_OBJ_NEW_QSTR(MP_PARSE_NODE_LEAF_ARG(pn0)), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return false;
+    }
+
+    // all arguments must be positional constants
+    mp_parse_node_t *pn_args;
+    size_t n_args = mp_parse_node_extract_list(&((mp_parse_node_struct_t *)pn1)->nodes[0], RULE_arglist, &pn_args);
+    mp_obj_t args[2];
+    if (n_args == 0 || n_args > MP_ARRAY_SIZE(args)) {
+        return false;
+    }
+    for (size_t i = 0; i < n_args; ++i) {
+        if (!mp_parse_node_is_const(pn_args[i])) {
+            return false;
+        }
+        args[i] = mp_parse_node_convert_to_obj(pn_args[i]);
+        if (mp_obj_is_str(args[i]) && !fold_is_ascii_str(args[i])) {
+            return false;
+        }
+    }
+
+    // builtins may be overridden at runtime, so only fold them where a constant is required
+    if (parser->const_call_depth == 0) {
+        return false;
+    }
+
+    // call the builtin, and only fold if it succeeds and gives a simple result
+    mp_obj_t res;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        res = mp_call_function_n_kw(elem->value, n_args, 0, args);
+        nlr_pop();
+    } else {
+        return false;
+    }
+    if (!(mp_obj_is_int(res)
+          #if MICROPY_COMP_CONST_FLOAT
+          || mp_obj_is_float(res)
+          #endif
+          || (mp_obj_is_str(res) && fold_is_ascii_str(res)))) {
+        return false;
+    }
+
+    pop_result(parser);
+    pop_result(parser);
+    push_result_folded(parser, res);
+
+    return true;
+}
+#endif
+
 #endif // MICROPY_COMP_CONST_FOLDING
 
 #if MICROPY_COMP_CONST_TUPLE
@@ -1014,6 +1243,11 @@ static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     }
 
     #if MICROPY_COMP_CONST_FOLDING
+    #if MICROPY_COMP_CONST_BUILTINS
+    if (rule_id == RULE_trailer_paren) {
+        fold_leave_call(parser);
+    }
+    #endif
     if (fold_logical_constants(parser, rule_id, &num_args)) {
         // we folded this rule so return straight away
         return;
@@ -1022,6 +1256,12 @@ static void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
         // we folded this rule so return straight away
         return;
     }
+    #if MICROPY_COMP_CONST_BUILTINS
+    if (fold_builtin_call(parser, rule_id)) {
+        // we folded this rule so return straight away
+        return;
+    }
+    #endif
     #endif
 
     #if MICROPY_COMP_CONST_TUPLE
@@ -1070,6 +1310,10 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_init(&parser.consts, 0);
     #endif
 
+    #if MICROPY_COMP_CONST_FOLDING && MICROPY_COMP_CONST_BUILTINS
+    parser.const_call_depth = 0;
+    #endif
+
     // work out the top-level rule to use, and push it on the stack
     size_t top_level_rule;
     switch (input_kind) {
@@ -1182,6 +1426,11 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                         }
                     } else {
                         push_rule(&parser, rule_src_line, rule_id, i + 1); // save this and-rule
+                        #if MICROPY_COMP_CONST_FOLDING && MICROPY_COMP_CONST_BUILTINS
+                        if (rule_id == RULE_trailer_paren) {
+                            fold_enter_call(&parser);
+                        }
+                        #endif
                         push_rule_from_arg(&parser, rule_arg[i]); // push child of and-rule
                         goto next_rule;
                     }
@@ -1387,6 +1636,9 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     // get the root parse node that we created
     assert(parser.result_stack_top == 1);
     parser.tree.root = parser.result_stack[0];
+    #if MICROPY_EMIT_NATIVE_TIERING
+    parser.tree.source_hash = lex->source_hash;
+    #endif
 
     // free the memory that we don't need anymore
     m_del(rule_stack_t, parser.rule_stack, parser.rule_stack_alloc);
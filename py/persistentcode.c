@@ -288,7 +288,73 @@ static mp_obj_t load_obj(mp_reader_t *reader) {
     }
 }
 
-static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *context) {
+#if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+
+#if MICROPY_PERSISTENT_CODE_SAVE
+#error "MICROPY_PERSISTENT_CODE_LOAD_LAZY requires MICROPY_PERSISTENT_CODE_SAVE to be disabled"
+#endif
+
+// Skip over a bytecode raw code and all of its children in a memory-mapped .mpy file.
+static const byte *skip_raw_code(const byte *ptr) {
+    size_t kind_len = mp_decode_uint(&ptr);
+    ptr += kind_len >> 3;
+    if (kind_len & 4) {
+        for (size_t n_children = mp_decode_uint(&ptr); n_children > 0; --n_children) {
+            ptr = skip_raw_code(ptr);
+        }
+    }
+    return ptr;
+}
+
+// Load a bytecode raw code from a memory-mapped .mpy file, without loading its
+// children.  If it has children then a raw code of kind MP_CODE_BYTECODE_LAZY is
+// returned, with fun_data pointing to its data in the .mpy file, and it is loaded
+// by mp_raw_code_load_lazy() when a function object is first made from it.
+static mp_raw_code_t *load_raw_code_lazy(const byte **ptr) {
+    const byte *start = *ptr;
+    const byte *p = start;
+    size_t kind_len = mp_decode_uint(&p);
+    if ((kind_len & 3) + MP_CODE_BYTECODE != MP_CODE_BYTECODE) {
+        // Not bytecode, which can't be in a .mpy file without an arch.
+        mp_raise_ValueError(MP_ERROR_TEXT("incompatible .mpy file"));
+    }
+    const byte *fun_data = p;
+    p += kind_len >> 3;
+    if (!(kind_len & 4)) {
+        // Bytecode without children is used directly, see load_raw_code.
+        *ptr = p;
+        return (mp_raw_code_t *)fun_data;
+    }
+    *ptr = skip_raw_code(start);
+    mp_raw_code_t *rc = mp_emit_glue_new_raw_code();
+    rc->kind = MP_CODE_BYTECODE_LAZY;
+    rc->fun_data = start;
+    return rc;
+}
+
+void mp_raw_code_load_lazy(mp_raw_code_t *rc) {
+    assert(rc->kind == MP_CODE_BYTECODE_LAZY);
+    const byte *ptr = rc->fun_data;
+    size_t kind_len = mp_decode_uint(&ptr);
+    const byte *fun_data = ptr;
+    ptr += kind_len >> 3;
+
+    // Create lazy raw codes for the children.
+    size_t n_children = mp_decode_uint(&ptr);
+    mp_raw_code_t **children = m_new(mp_raw_code_t *, n_children);
+    for (size_t i = 0; i < n_children; ++i) {
+        children[i] = load_raw_code_lazy(&ptr);
+    }
+
+    // Turn the lazy raw code into a normal bytecode raw code.
+    const byte *ip = fun_data;
+    MP_BC_PRELUDE_SIG_DECODE(ip);
+    mp_emit_glue_assign_bytecode(rc, fun_data, children, scope_flags);
+}
+
+#endif
+
+static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *context, bool lazy) {
     // Load function kind and data length
     size_t kind_len = read_uint(reader);
     int kind = (kind_len & 3) + MP_CODE_BYTECODE;
@@ -385,11 +451,32 @@ static mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     if (has_children) {
         n_children = read_uint(reader);
         children = m_new(mp_raw_code_t *, n_children + (kind == MP_CODE_NATIVE_PY));
-        for (size_t i = 0; i < n_children; ++i) {
-            children[i] = load_raw_code(reader, context);
+        #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+        if (lazy) {
+            const byte *start = mp_reader_try_read_rom(reader, 0);
+            const byte *ptr = start;
+            for (size_t i = 0; i < n_children; ++i) {
+                children[i] = load_raw_code_lazy(&ptr);
+            }
+            mp_reader_try_read_rom(reader, ptr - start);
+        } else
+        #endif
+        {
+            for (size_t i = 0; i < n_children; ++i) {
+                children[i] = load_raw_code(reader, context, false);
+            }
         }
     }
 
+    #if !MICROPY_PERSISTENT_CODE_SAVE
+    if (kind == MP_CODE_BYTECODE && n_children == 0) {
+        // Bytecode without children doesn't need a raw_code, the bytecode itself is
+        // used as the proto-function (as is done for frozen code).  When the .mpy is
+        // memory-mapped this means nothing is allocated for such a function.
+        return (mp_raw_code_t *)fun_data;
+    }
+    #endif
+
     // Create raw_code and return it
     mp_raw_code_t *rc = mp_emit_glue_new_raw_code();
     if (kind == MP_CODE_BYTECODE) {
@@ -468,6 +555,9 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
 
     byte header[4];
     read_bytes(reader, header, sizeof(header));
+    #if MICROPY_OPT_FUSED_OPCODES
+    header[3] &= ~MPY_FEATURE_FUSED_OPCODES;
+    #endif
     byte arch = MPY_FEATURE_DECODE_ARCH(header[2]);
     if (header[0] != 'M'
         || header[1] != MPY_VERSION
@@ -518,8 +608,13 @@ void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *cm) {
         cm->context->constants.obj_table[i] = load_obj(reader);
     }
 
-    // Load top-level module.
-    cm->rc = load_raw_code(reader, cm->context);
+    // Load top-level module.  If the .mpy file is memory-mapped and contains only
+    // bytecode then its functions are loaded lazily, when they are first needed.
+    bool lazy = false;
+    #if MICROPY_PERSISTENT_CODE_LOAD_LAZY
+    lazy = arch == MP_NATIVE_ARCH_NONE && mp_reader_try_read_rom(reader, 0) != NULL;
+    #endif
+    cm->rc = load_raw_code(reader, cm->context, lazy);
 
     #if MICROPY_PERSISTENT_CODE_SAVE
     cm->has_native = MPY_FEATURE_DECODE_ARCH(header[2]) != MP_NATIVE_ARCH_NONE;
@@ -695,10 +790,11 @@ void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print) {
         MPY_VERSION,
         (cm->arch_flags != 0 ? MPY_FEATURE_ARCH_FLAGS : 0) | (cm->has_native ? MPY_FEATURE_ENCODE_SUB_VERSION(MPY_SUB_VERSION) | MPY_FEATURE_ENCODE_ARCH(MPY_FEATURE_ARCH_DYNAMIC) : 0),
         #if MICROPY_DYNAMIC_COMPILER
-        mp_dynamic_compiler.small_int_bits,
+        mp_dynamic_compiler.small_int_bits
         #else
-        MP_SMALL_INT_BITS,
+        MP_SMALL_INT_BITS
         #endif
+        | (MP_EMIT_FUSED_OPCODES ? MPY_FEATURE_FUSED_OPCODES : 0),
     };
     mp_print_bytes(print, header, sizeof(header));
 
@@ -847,6 +943,9 @@ typedef struct _mp_raw_code_simplified_t {
     const uint8_t *fun_data;
     struct _mp_raw_code_simplified_t *children;
     size_t fun_data_len;
+    #if MICROPY_OPT_QUICKEN
+    size_t opcodes_offset;
+    #endif
     size_t n_children;
 } mp_raw_code_simplified_t;
 
@@ -883,6 +982,9 @@ static void proto_fun_to_raw_code_simplified(const void *proto_fun, bit_vector_t
     // Skip pass source code info and cell info.
     // Then ip points to the start of the opcodes.
     ip += n_info + n_cell;
+    #if MICROPY_OPT_QUICKEN
+    rcs->opcodes_offset = ip - fun_data;
+    #endif
 
     // Decode bytecode.
     size_t n_children = 0;
@@ -924,7 +1026,25 @@ static void save_raw_code_simplified(mp_print_t *print, const mp_raw_code_simpli
     mp_print_uint(print, rcs->fun_data_len << 3 | (rcs->n_children != 0) << 2);
 
     // Save function code.
+    #if MICROPY_OPT_QUICKEN
+    // The function may have run and had some of its opcodes quickened, so save
+    // the generic opcodes in their place.
+    const byte *ip = rcs->fun_data + rcs->opcodes_offset;
+    const byte *ip_top = rcs->fun_data + rcs->fun_data_len;
+    const byte *run = rcs->fun_data;
+    while (ip < ip_top) {
+        byte generic = mp_bc_unquicken(*ip);
+        if (generic != *ip) {
+            mp_print_bytes(print, run, ip - run);
+            mp_print_bytes(print, &generic, 1);
+            run = ip + 1;
+        }
+        ip += mp_opcode_decode(ip).size;
+    }
+    mp_print_bytes(print, run, ip_top - run);
+    #else
     mp_print_bytes(print, rcs->fun_data, rcs->fun_data_len);
+    #endif
 
     // Save (and free) children.
     if (rcs->n_children) {
@@ -959,7 +1079,7 @@ mp_obj_t mp_raw_code_save_fun_to_bytes(const mp_module_constants_t *consts, mp_p
     vstr_init_print(&vstr, 64, &print);
 
     // Start with .mpy header.
-    const uint8_t header[4] = { 'M', MPY_VERSION, 0, MP_SMALL_INT_BITS };
+    const uint8_t header[4] = { 'M', MPY_VERSION, 0, MP_SMALL_INT_BITS | (MP_EMIT_FUSED_OPCODES ? MPY_FEATURE_FUSED_OPCODES : 0) };
     mp_print_bytes(&print, header, sizeof(header));
 
     // Number of entries in constant table.
@@ -102,6 +102,11 @@
 #define MPY_FEATURE_ARCH_FLAGS (0x40)
 #define MPY_FEATURE_ARCH_FLAGS_TEST(x) (((x) & MPY_FEATURE_ARCH_FLAGS) == MPY_FEATURE_ARCH_FLAGS)
 
+// Bytecode may contain fused opcodes, see MICROPY_OPT_FUSED_OPCODES.  This is
+// stored in the top bit of the small-int-bits byte of the header, so that VMs
+// without support for fused opcodes reject such a .mpy file.
+#define MPY_FEATURE_FUSED_OPCODES (0x80)
+
 enum {
     MP_NATIVE_ARCH_NONE = 0,
     MP_NATIVE_ARCH_X86,
@@ -136,6 +141,7 @@ enum {
 void mp_raw_code_load(mp_reader_t *reader, mp_compiled_module_t *ctx);
 void mp_raw_code_load_mem(const byte *buf, size_t len, mp_compiled_module_t *ctx);
 void mp_raw_code_load_file(qstr filename, mp_compiled_module_t *ctx);
+void mp_raw_code_load_lazy(mp_raw_code_t *rc);
 
 void mp_raw_code_save(mp_compiled_module_t *cm, mp_print_t *print);
 void mp_raw_code_save_file(mp_compiled_module_t *cm, qstr filename);
@@ -353,7 +353,13 @@ static const byte *mp_prof_opcode_decode(const byte *ip, const mp_uint_t *const_
     instruction->argobj = mp_const_none;
     instruction->argobjex_cache = mp_const_none;
 
-    switch (*ip++) {
+    byte opcode = *ip++;
+    #if MICROPY_OPT_QUICKEN
+    // Show quickened opcodes as the generic ones that they specialise.
+    opcode = mp_bc_unquicken(opcode);
+    #endif
+
+    switch (opcode) {
         case MP_BC_LOAD_CONST_FALSE:
             instruction->qstr_opname = MP_QSTR_LOAD_CONST_FALSE;
             break;
@@ -774,25 +780,58 @@ static const byte *mp_prof_opcode_decode(const byte *ip, const mp_uint_t *const_
             instruction->qstr_opname = MP_QSTR_IMPORT_STAR;
             break;
 
+        #if MICROPY_OPT_FUSED_OPCODES
+        case MP_BC_LOAD_FAST_2:
+            instruction->qstr_opname = MP_QSTR_LOAD_FAST_2;
+            instruction->arg = *ip++;
+            break;
+
+        case MP_BC_LOAD_FAST0_ATTR:
+            DECODE_QSTR;
+            instruction->qstr_opname = MP_QSTR_LOAD_FAST0_ATTR;
+            instruction->arg = qst;
+            instruction->argobj = MP_OBJ_NEW_QSTR(qst);
+            break;
+
+        case MP_BC_STORE_FAST0_ATTR:
+            DECODE_QSTR;
+            instruction->qstr_opname = MP_QSTR_STORE_FAST0_ATTR;
+            instruction->arg = qst;
+            instruction->argobj = MP_OBJ_NEW_QSTR(qst);
+            break;
+
+        case MP_BC_BINARY_OP_SMALL_INT:
+            instruction->qstr_opname = MP_QSTR_BINARY_OP_SMALL_INT;
+            instruction->arg = *ip++;
+            break;
+
+        case MP_BC_POP_JUMP_IF_COMPARE:
+            DECODE_SLABEL;
+            instruction->qstr_opname = MP_QSTR_POP_JUMP_IF_COMPARE;
+            instruction->arg = unum;
+            ip += 1;
+            break;
+        #endif
+
         default:
-            if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
+            if (opcode < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
                 instruction->qstr_opname = MP_QSTR_LOAD_CONST_SMALL_INT;
-                instruction->arg = (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16;
-            } else if (ip[-1] < MP_BC_LOAD_FAST_MULTI + 16) {
+                instruction->arg = (mp_int_t)opcode - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16;
+            } else if (opcode < MP_BC_LOAD_FAST_MULTI + 16) {
                 instruction->qstr_opname = MP_QSTR_LOAD_FAST;
-                instruction->arg = (mp_uint_t)ip[-1] - MP_BC_LOAD_FAST_MULTI;
-            } else if (ip[-1] < MP_BC_STORE_FAST_MULTI + 16) {
+                instruction->arg = (mp_uint_t)opcode - MP_BC_LOAD_FAST_MULTI;
+            } else if (opcode < MP_BC_STORE_FAST_MULTI + 16) {
                 instruction->qstr_opname = MP_QSTR_STORE_FAST;
-                instruction->arg = (mp_uint_t)ip[-1] - MP_BC_STORE_FAST_MULTI;
-            } else if (ip[-1] < MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE) {
+                instruction->arg = (mp_uint_t)opcode - MP_BC_STORE_FAST_MULTI;
+            } else if (opcode < MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE) {
                 instruction->qstr_opname = MP_QSTR_UNARY_OP;
-                instruction->arg = (mp_uint_t)ip[-1] - MP_BC_UNARY_OP_MULTI;
-            } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
-                mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
+                instruction->arg = (mp_uint_t)opcode - MP_BC_UNARY_OP_MULTI;
+            } else if (opcode < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
+                mp_uint_t op = opcode - MP_BC_BINARY_OP_MULTI;
                 instruction->qstr_opname = MP_QSTR_BINARY_OP;
                 instruction->arg = op;
             } else {
-                mp_printf(&mp_plat_print, "code %p, opcode 0x%02x not implemented\n", ip - 1, ip[-1]);
+                mp_printf(&mp_plat_print, "code %p, opcode 0x%02x not implemented\n", ip - 1, opcode);
                 assert(0);
                 return ip;
             }
@@ -59,6 +59,7 @@ set(MICROPY_SOURCE_PY
     ${MICROPY_PY_DIR}/mpstate.c
     ${MICROPY_PY_DIR}/mpz.c
     ${MICROPY_PY_DIR}/nativeglue.c
+    ${MICROPY_PY_DIR}/nativetier.c
     ${MICROPY_PY_DIR}/nlr.c
     ${MICROPY_PY_DIR}/nlraarch64.c
     ${MICROPY_PY_DIR}/nlrloong64.c
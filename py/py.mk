@@ -130,6 +130,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	runtime_utils.o \
 	scheduler.o \
 	nativeglue.o \
+	nativetier.o \
 	pairheap.o \
 	ringbuf.o \
 	cstack.o \
@@ -60,14 +60,37 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// Hash of the data before it is reduced to Q_HASH_MASK.
+// This must match the equivalent function in makeqstrdata.py.
+static size_t qstr_compute_hash_full(const byte *data, size_t len) {
+    #if MICROPY_QSTR_HASH_WORDWISE
+    // Mix in each 4 bytes as a little-endian word (the compiler can turn this
+    // into a single load), then the remaining bytes as for djb2.  The final
+    // mixing makes the low bits, which are the ones kept, depend on all bits.
+    uint32_t hash = 5381;
+    for (const byte *top = data + (len & ~3); data < top; data += 4) {
+        uint32_t w = data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+        hash = ((hash << 5 | hash >> 27) ^ w) * 0x9e3779b1;
+    }
+    for (const byte *top = data + (len & 3); data < top; data++) {
+        hash = hash * 33 ^ *data;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    return hash;
+    #else
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
-    hash &= Q_HASH_MASK;
+    return hash;
+    #endif
+}
+
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    size_t hash = qstr_compute_hash_full(data, len) & Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
         hash++;
@@ -181,6 +204,10 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 void qstr_init(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    #if MICROPY_QSTR_HASH_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    MP_STATE_VM(qstr_index_retry) = 0;
+    #endif
 
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     mp_thread_mutex_init(&MP_STATE_VM(qstr_mutex));
@@ -199,6 +226,77 @@ static const qstr_pool_t *find_qstr(qstr *q) {
     return pool;
 }
 
+#if MICROPY_QSTR_HASH_INDEX
+
+// The index holds all qstrs from this one onwards, ie those in pools that are
+// allocated at runtime.
+#define QSTR_INDEX_FIRST (CONST_POOL.total_prev_len + CONST_POOL.len)
+
+// Minimum number of slots in the index.
+#define QSTR_INDEX_ALLOC_MIN (32)
+
+// Number of qstrs to add before trying again to make the index, if it failed.
+#define QSTR_INDEX_RETRY_DELAY (64)
+
+static void qstr_index_insert(qstr_index_t *index, qstr q) {
+    size_t len;
+    const byte *data = qstr_data(q, &len);
+    size_t mask = index->alloc - 1;
+    size_t pos = qstr_compute_hash_full(data, len) & mask;
+    while (index->table[pos] != MP_QSTRnull) {
+        pos = (pos + 1) & mask;
+    }
+    index->table[pos] = q;
+}
+
+// Add the newly created qstr q to the index.  The index is either NULL, if it
+// couldn't be allocated, or has all qstrs from QSTR_INDEX_FIRST up to q.  If
+// it can't be allocated then it is tried again after QSTR_INDEX_RETRY_DELAY
+// more qstrs, so that interning doesn't get slower under memory pressure.
+// qstr_mutex must be taken while in this function
+static void qstr_index_add(qstr q) {
+    size_t n = q - QSTR_INDEX_FIRST + 1;
+    qstr_index_t *index = MP_STATE_VM(qstr_index);
+    if (index != NULL && n * 2 <= index->alloc) {
+        qstr_index_insert(index, q);
+        return;
+    }
+    if (q < MP_STATE_VM(qstr_index_retry)) {
+        // The last attempt to make the index failed, so until this many more
+        // qstrs are added they are found by searching all pools.
+        return;
+    }
+
+    // Make a new index that is at most a quarter full, so that it can take as
+    // many qstrs again before it must be remade.
+    size_t alloc = QSTR_INDEX_ALLOC_MIN;
+    while (alloc < n * 4) {
+        alloc *= 2;
+    }
+    qstr_index_t *new_index = m_new_obj_var_maybe(qstr_index_t, table, qstr, alloc);
+    if (new_index != NULL) {
+        new_index->alloc = alloc;
+        memset(new_index->table, 0, alloc * sizeof(qstr));
+        for (qstr i = QSTR_INDEX_FIRST; i <= q; ++i) {
+            qstr_index_insert(new_index, i);
+        }
+    } else {
+        MP_STATE_VM(qstr_index_retry) = q + QSTR_INDEX_RETRY_DELAY;
+    }
+    // Without the GIL, other threads may be searching the old index (without
+    // taking qstr_mutex) so leave it to be freed by the GC.
+    #if !(MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL)
+    if (index != NULL) {
+        m_del_var(qstr_index_t, table, qstr, index->alloc, index);
+    }
+    #endif
+    MP_STATE_VM(qstr_index) = new_index;
+}
+
+MP_REGISTER_ROOT_POINTER(struct _qstr_index_t *qstr_index);
+
+#endif
+
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     #if MICROPY_QSTR_BYTES_IN_HASH
@@ -255,6 +353,10 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    qstr_index_add(MP_STATE_VM(last_pool)->total_prev_len + at);
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
@@ -270,8 +372,28 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
 
+    const qstr_pool_t *pool = MP_STATE_VM(last_pool);
+
+    #if MICROPY_QSTR_HASH_INDEX
+    // Look up the qstrs created at runtime in the index, if there is one.
+    const qstr_index_t *index = MP_STATE_VM(qstr_index);
+    if (index != NULL) {
+        size_t mask = index->alloc - 1;
+        size_t pos = qstr_compute_hash_full((const byte *)str, str_len) & mask;
+        for (; index->table[pos] != MP_QSTRnull; pos = (pos + 1) & mask) {
+            qstr q = index->table[pos];
+            size_t len;
+            const byte *data = qstr_data(q, &len);
+            if (len == str_len && memcmp(data, str, str_len) == 0) {
+                return q;
+            }
+        }
+        pool = &CONST_POOL;
+    }
+    #endif
+
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (; pool != NULL; pool = pool->prev) {
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -93,6 +93,15 @@ typedef struct _qstr_pool_t {
 
 #define QSTR_TOTAL() (MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len)
 
+#if MICROPY_QSTR_HASH_INDEX
+// Open-addressed hash table of the qstrs in the pools allocated at runtime,
+// with MP_QSTRnull in free slots.
+typedef struct _qstr_index_t {
+    size_t alloc;
+    qstr table[];
+} qstr_index_t;
+#endif
+
 void qstr_init(void);
 
 size_t qstr_compute_hash(const byte *data, size_t len);
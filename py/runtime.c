@@ -73,6 +73,11 @@ void mp_init(void) {
 
     // no pending exceptions to start with
     MP_STATE_THREAD(mp_pending_exception) = MP_OBJ_NULL;
+
+    #if MICROPY_OPT_MAP_VERSION
+    // forget where global names were found, eg before a soft reset
+    memset(MP_STATE_THREAD(load_global_memo), 0, sizeof(MP_STATE_THREAD(load_global_memo)));
+    #endif
     #if MICROPY_ENABLE_SCHEDULER
     // no pending callbacks to start with
     MP_STATE_VM(sched_state) = MP_SCHED_IDLE;
@@ -82,9 +87,29 @@ void mp_init(void) {
         MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
     }
     #endif
+    #if MICROPY_SCHEDULER_LOCK_FREE
+    MP_STATE_VM(sched_put) = 0;
+    MP_STATE_VM(sched_get) = 0;
+    for (size_t i = 0; i < MICROPY_SCHEDULER_DEPTH; ++i) {
+        MP_STATE_VM(sched_queue)[i].seq = i;
+    }
+    #else
     MP_STATE_VM(sched_idx) = 0;
     MP_STATE_VM(sched_len) = 0;
     #endif
+    #if MICROPY_SCHEDULER_OVERFLOW
+    MP_STATE_VM(sched_overflow_head) = NULL;
+    MP_STATE_VM(sched_overflow_tail) = NULL;
+    MP_STATE_VM(sched_overflow_len) = 0;
+    MP_STATE_VM(sched_overflow_max) = 0;
+    #endif
+    #if MICROPY_SCHEDULER_STATS
+    memset(MP_STATE_VM(sched_scheduled), 0, sizeof(MP_STATE_VM(sched_scheduled)));
+    memset(MP_STATE_VM(sched_deferred), 0, sizeof(MP_STATE_VM(sched_deferred)));
+    memset(MP_STATE_VM(sched_dropped), 0, sizeof(MP_STATE_VM(sched_dropped)));
+    memset(MP_STATE_VM(sched_latency), 0, sizeof(MP_STATE_VM(sched_latency)));
+    #endif
+    #endif
 
     #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF
     mp_init_emergency_exception_buf();
@@ -167,9 +192,17 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    #if MICROPY_VM_CODE_STATE_CHAIN
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
+    #if MICROPY_EMIT_NATIVE_TIERING
+    MP_STATE_VM(native_tier_threshold) = 0;
+    MP_STATE_VM(native_tier_budget) = MICROPY_EMIT_NATIVE_TIERING_BUDGET;
+    MP_STATE_VM(native_tier_list) = MP_OBJ_NULL;
+    #endif
+
     #if MICROPY_PY_SYS_TRACEBACKLIMIT
     MP_STATE_VM(sys_mutable[MP_SYS_MUTABLE_TRACEBACKLIMIT]) = MP_OBJ_NEW_SMALL_INT(1000);
     #endif
@@ -236,29 +269,66 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_NAME(mp_load_name)(qstr qst) {
     return mp_load_global(qst);
 }
 
+#if MICROPY_OPT_MAP_VERSION
+static inline void load_global_memo_set(mp_load_global_memo_t *memo, qstr qst, const mp_map_t *globals, uint32_t pos) {
+    // A map with version 0 may have had keys put in it directly, so can't be memoised.
+    if (globals->version != 0) {
+        memo->version = globals->version;
+        memo->qst = qst;
+        memo->pos = pos;
+    }
+}
+#endif
+
 mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
     // logic: search globals, builtins
     DEBUG_OP_printf("load global %s\n", qstr_str(qst));
-    mp_map_elem_t *elem = mp_map_lookup(&mp_globals_get()->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-    if (elem == NULL) {
+    mp_map_t *globals = &mp_globals_get()->map;
+    #if MICROPY_OPT_MAP_VERSION
+    // Try where this name was found last time.  That is still correct if the
+    // globals have the same version, ie no name was added to or removed from
+    // them since, because the builtins never change.  If builtins can be
+    // overridden then they are only taken from the memo while they aren't.
+    mp_load_global_memo_t *memo = &MP_STATE_THREAD(load_global_memo)[qst & (MICROPY_OPT_MAP_VERSION_MEMO_SIZE - 1)];
+    if (memo->qst == qst && memo->version == globals->version) {
+        if (!(memo->pos & MP_LOAD_GLOBAL_MEMO_BUILTIN)) {
+            return globals->table[memo->pos].value;
+        }
         #if MICROPY_CAN_OVERRIDE_BUILTINS
-        if (MP_STATE_VM(mp_module_builtins_override_dict) != NULL) {
-            // lookup in additional dynamic table of builtins first
-            elem = mp_map_lookup(&MP_STATE_VM(mp_module_builtins_override_dict)->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-            if (elem != NULL) {
-                return elem->value;
-            }
+        if (MP_STATE_VM(mp_module_builtins_override_dict) == NULL)
+        #endif
+        {
+            return mp_module_builtins_globals.map.table[memo->pos & ~MP_LOAD_GLOBAL_MEMO_BUILTIN].value;
         }
+    }
+    #endif
+    mp_map_elem_t *elem = mp_map_lookup(globals, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    if (elem != NULL) {
+        #if MICROPY_OPT_MAP_VERSION
+        load_global_memo_set(memo, qst, globals, elem - globals->table);
         #endif
-        elem = mp_map_lookup((mp_map_t *)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-        if (elem == NULL) {
-            #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
-            mp_raise_msg(&mp_type_NameError, MP_ERROR_TEXT("name not defined"));
-            #else
-            mp_raise_msg_varg(&mp_type_NameError, MP_ERROR_TEXT("name '%q' isn't defined"), qst);
-            #endif
+        return elem->value;
+    }
+    #if MICROPY_CAN_OVERRIDE_BUILTINS
+    if (MP_STATE_VM(mp_module_builtins_override_dict) != NULL) {
+        // lookup in additional dynamic table of builtins first
+        elem = mp_map_lookup(&MP_STATE_VM(mp_module_builtins_override_dict)->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        if (elem != NULL) {
+            return elem->value;
         }
     }
+    #endif
+    elem = mp_map_lookup((mp_map_t *)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
+        mp_raise_msg(&mp_type_NameError, MP_ERROR_TEXT("name not defined"));
+        #else
+        mp_raise_msg_varg(&mp_type_NameError, MP_ERROR_TEXT("name '%q' isn't defined"), qst);
+        #endif
+    }
+    #if MICROPY_OPT_MAP_VERSION
+    load_global_memo_set(memo, qst, globals, (elem - mp_module_builtins_globals.map.table) | MP_LOAD_GLOBAL_MEMO_BUILTIN);
+    #endif
     return elem->value;
 }
 
@@ -113,8 +113,18 @@ void mp_handle_pending(mp_handle_pending_behaviour_t behavior);
 #if MICROPY_ENABLE_SCHEDULER
 void mp_sched_lock(void);
 void mp_sched_unlock(void);
+#if MICROPY_SCHEDULER_LOCK_FREE || MICROPY_SCHEDULER_OVERFLOW
+size_t mp_sched_num_pending(void);
+#else
 #define mp_sched_num_pending() (MP_STATE_VM(sched_len))
+#endif
 bool mp_sched_schedule(mp_obj_t function, mp_obj_t arg);
+#if MICROPY_SCHEDULER_OVERFLOW || MICROPY_SCHEDULER_STATS
+// For use outside of interrupt handlers, where the heap can be used.
+bool mp_sched_schedule_soft(mp_obj_t function, mp_obj_t arg);
+#else
+#define mp_sched_schedule_soft(function, arg) mp_sched_schedule((function), (arg))
+#endif
 bool mp_sched_schedule_node(mp_sched_node_t *node, mp_sched_callback_t callback);
 #endif
 
@@ -180,8 +190,16 @@ static inline void mp_thread_init_state(mp_state_thread_t *ts, size_t stack_size
     #if MICROPY_PY_SYS_SETTRACE
     ts->prof_trace_callback = MP_OBJ_NULL;
     ts->prof_callback_is_executing = false;
+    #endif
+    #if MICROPY_VM_CODE_STATE_CHAIN
     ts->current_code_state = NULL;
     #endif
+    #if MICROPY_GC_THREAD_ALLOC_BUFFER
+    memset(ts->gc_alloc_buffer, 0, sizeof(ts->gc_alloc_buffer));
+    #endif
+    #if MICROPY_OPT_MAP_VERSION
+    memset(ts->load_global_memo, 0, sizeof(ts->load_global_memo));
+    #endif
 
     // If locals/globals are not given, inherit from main thread
     if (locals == NULL) {
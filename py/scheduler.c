@@ -28,6 +28,7 @@
 
 #include "py/mphal.h"
 #include "py/runtime.h"
+#include "py/gc.h"
 
 // Schedules an exception on the main thread (for exceptions "thrown" by async
 // sources such as interrupts and UNIX signal handlers).
@@ -62,17 +63,193 @@ void MICROPY_WRAP_MP_SCHED_VM_ABORT(mp_sched_vm_abort)(void) {
 
 #define IDX_MASK(i) ((i) & (MICROPY_SCHEDULER_DEPTH - 1))
 
+#if MICROPY_SCHEDULER_LOCK_FREE
+
+// The queue of Python callbacks is a bounded multi-producer, single-consumer
+// ring in the style of D. Vyukov's: each slot has a sequence number that says
+// whether it is free to be written at a given position or holds an item to be
+// read at that position.  Producers claim a position with a compare-and-swap
+// on sched_put, write the item, then publish it by advancing the slot's
+// sequence number.  Only the scheduler (with sched_state locked) reads items.
+
+#define SCHED_ATOMIC_INC(x) __atomic_add_fetch(&(x), 1, __ATOMIC_RELAXED)
+
+static inline size_t mp_sched_queue_len(void) {
+    size_t get = __atomic_load_n(&MP_STATE_VM(sched_get), __ATOMIC_ACQUIRE);
+    return __atomic_load_n(&MP_STATE_VM(sched_put), __ATOMIC_ACQUIRE) - get;
+}
+
+// Set the scheduler pending if it is idle.  If it is locked then it is made
+// pending by mp_sched_unlock().
+static inline void mp_sched_set_pending(void) {
+    int16_t idle = MP_SCHED_IDLE;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    __atomic_compare_exchange_n(&MP_STATE_VM(sched_state), &idle, MP_SCHED_PENDING, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+static inline bool mp_sched_queue_put(mp_obj_t function, mp_obj_t arg) {
+    mp_sched_item_t *queue = MP_STATE_VM(sched_queue);
+    size_t pos = __atomic_load_n(&MP_STATE_VM(sched_put), __ATOMIC_RELAXED);
+    for (;;) {
+        mp_sched_item_t *item = &queue[IDX_MASK(pos)];
+        mp_int_t diff = (mp_int_t)(__atomic_load_n(&item->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0) {
+            // Slot is free at this position, try to claim it (on failure pos
+            // is updated to the current value).
+            if (__atomic_compare_exchange_n(&MP_STATE_VM(sched_put), &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                item->func = function;
+                item->arg = arg;
+                #if MICROPY_SCHEDULER_STATS
+                item->ticks_us = mp_hal_ticks_us();
+                #endif
+                __atomic_store_n(&item->seq, pos + 1, __ATOMIC_RELEASE);
+                return true;
+            }
+        } else if (diff < 0) {
+            // Slot still holds the item from one lap ago, queue is full.
+            return false;
+        } else {
+            // Another producer claimed this position, try again.
+            pos = __atomic_load_n(&MP_STATE_VM(sched_put), __ATOMIC_RELAXED);
+        }
+    }
+}
+
+// Must only be called by the scheduler.  May find nothing even when
+// mp_sched_queue_len() is non-zero, if a producer has claimed a slot but not
+// finished writing it.
+static inline bool mp_sched_queue_get(mp_sched_item_t *item_out) {
+    size_t pos = MP_STATE_VM(sched_get);
+    mp_sched_item_t *item = &MP_STATE_VM(sched_queue)[IDX_MASK(pos)];
+    if (__atomic_load_n(&item->seq, __ATOMIC_ACQUIRE) != pos + 1) {
+        return false;
+    }
+    *item_out = *item;
+    __atomic_store_n(&MP_STATE_VM(sched_get), pos + 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&item->seq, pos + MICROPY_SCHEDULER_DEPTH, __ATOMIC_RELEASE);
+    return true;
+}
+
+#else
+
+#define SCHED_ATOMIC_INC(x) do { \
+        mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION(); \
+        ++(x); \
+        MICROPY_END_ATOMIC_SECTION(atomic_state); \
+} while (0)
+
+#define mp_sched_queue_len() (MP_STATE_VM(sched_len))
+
+// Must be called within an atomic section.
+static inline void mp_sched_set_pending(void) {
+    if (MP_STATE_VM(sched_state) == MP_SCHED_IDLE) {
+        MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
+    }
+}
+
+#endif
+
 // This is a macro so it is guaranteed to be inlined in functions like
 // mp_sched_schedule that may be located in a special memory region.
-#define mp_sched_full() (mp_sched_num_pending() == MICROPY_SCHEDULER_DEPTH)
+#define mp_sched_full() (mp_sched_queue_len() == MICROPY_SCHEDULER_DEPTH)
 
-static inline bool mp_sched_empty(void) {
+// Add a Python callback to the queue, if there is room.
+static inline bool mp_sched_queue_add(mp_obj_t function, mp_obj_t arg) {
     MP_STATIC_ASSERT(MICROPY_SCHEDULER_DEPTH <= 255); // MICROPY_SCHEDULER_DEPTH must fit in 8 bits
     MP_STATIC_ASSERT((IDX_MASK(MICROPY_SCHEDULER_DEPTH) == 0)); // MICROPY_SCHEDULER_DEPTH must be a power of 2
 
-    return mp_sched_num_pending() == 0;
+    #if MICROPY_SCHEDULER_LOCK_FREE
+    if (!mp_sched_queue_put(function, arg)) {
+        return false;
+    }
+    mp_sched_set_pending();
+    MICROPY_SCHED_HOOK_SCHEDULED;
+    return true;
+    #else
+    mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
+    bool ret;
+    if (!mp_sched_full()) {
+        mp_sched_set_pending();
+        uint8_t iput = IDX_MASK(MP_STATE_VM(sched_idx) + MP_STATE_VM(sched_len)++);
+        MP_STATE_VM(sched_queue)[iput].func = function;
+        MP_STATE_VM(sched_queue)[iput].arg = arg;
+        #if MICROPY_SCHEDULER_STATS
+        MP_STATE_VM(sched_queue)[iput].ticks_us = mp_hal_ticks_us();
+        #endif
+        MICROPY_SCHED_HOOK_SCHEDULED;
+        ret = true;
+    } else {
+        // schedule queue is full
+        ret = false;
+    }
+    MICROPY_END_ATOMIC_SECTION(atomic_state);
+    return ret;
+    #endif
+}
+
+#if MICROPY_SCHEDULER_OVERFLOW
+
+typedef struct _mp_sched_overflow_t {
+    struct _mp_sched_overflow_t *next;
+    mp_sched_item_t item;
+} mp_sched_overflow_t;
+
+size_t mp_sched_num_pending(void) {
+    return mp_sched_queue_len() + MP_STATE_VM(sched_overflow_len);
 }
 
+#elif MICROPY_SCHEDULER_LOCK_FREE
+
+size_t mp_sched_num_pending(void) {
+    return mp_sched_queue_len();
+}
+
+#endif
+
+// Take the next Python callback to run, if any.  Must be called by the
+// scheduler within an atomic section.
+static inline bool mp_sched_take(mp_sched_item_t *item) {
+    #if MICROPY_SCHEDULER_LOCK_FREE
+    if (mp_sched_queue_get(item)) {
+        return true;
+    }
+    #else
+    if (MP_STATE_VM(sched_len) != 0) {
+        *item = MP_STATE_VM(sched_queue)[MP_STATE_VM(sched_idx)];
+        MP_STATE_VM(sched_idx) = IDX_MASK(MP_STATE_VM(sched_idx) + 1);
+        --MP_STATE_VM(sched_len);
+        return true;
+    }
+    #endif
+    #if MICROPY_SCHEDULER_OVERFLOW
+    // Callbacks that overflowed run once the queue is empty.
+    mp_sched_overflow_t *node = MP_STATE_VM(sched_overflow_head);
+    if (node != NULL) {
+        MP_STATE_VM(sched_overflow_head) = node->next;
+        if (node->next == NULL) {
+            MP_STATE_VM(sched_overflow_tail) = NULL;
+        }
+        --MP_STATE_VM(sched_overflow_len);
+        // The node is left for the GC to free: freeing it here would take the
+        // GC mutex within the atomic section.
+        *item = node->item;
+        return true;
+    }
+    #endif
+    return false;
+}
+
+#if MICROPY_SCHEDULER_STATS
+static void mp_sched_record_latency(mp_uint_t ticks_us) {
+    mp_uint_t dt = mp_hal_ticks_us() - ticks_us;
+    size_t i = 0;
+    while (i < MICROPY_SCHEDULER_STATS_BUCKETS - 1 && dt >= ((mp_uint_t)1 << i)) {
+        ++i;
+    }
+    ++MP_STATE_VM(sched_latency)[i];
+}
+#endif
+
 static inline void mp_sched_run_pending(void) {
     mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
     if (MP_STATE_VM(sched_state) != MP_SCHED_PENDING) {
@@ -107,11 +284,12 @@ static inline void mp_sched_run_pending(void) {
     #endif
 
     // Run at most one pending Python callback.
-    if (!mp_sched_empty()) {
-        mp_sched_item_t item = MP_STATE_VM(sched_queue)[MP_STATE_VM(sched_idx)];
-        MP_STATE_VM(sched_idx) = IDX_MASK(MP_STATE_VM(sched_idx) + 1);
-        --MP_STATE_VM(sched_len);
+    mp_sched_item_t item;
+    if (mp_sched_take(&item)) {
         MICROPY_END_ATOMIC_SECTION(atomic_state);
+        #if MICROPY_SCHEDULER_STATS
+        mp_sched_record_latency(item.ticks_us);
+        #endif
         mp_call_function_1_protected(item.func, item.arg);
     } else {
         MICROPY_END_ATOMIC_SECTION(atomic_state);
@@ -155,39 +333,98 @@ void mp_sched_unlock(void) {
             MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
         } else {
             MP_STATE_VM(sched_state) = MP_SCHED_IDLE;
+            #if MICROPY_SCHEDULER_LOCK_FREE
+            // A callback may have been added without the atomic section
+            // since the check above, and seen the scheduler still locked.
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (mp_sched_queue_len()) {
+                MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
+            }
+            #endif
         }
     }
     MICROPY_END_ATOMIC_SECTION(atomic_state);
 }
 
 bool MICROPY_WRAP_MP_SCHED_SCHEDULE(mp_sched_schedule)(mp_obj_t function, mp_obj_t arg) {
-    mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
-    bool ret;
-    if (!mp_sched_full()) {
-        if (MP_STATE_VM(sched_state) == MP_SCHED_IDLE) {
-            MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
-        }
-        uint8_t iput = IDX_MASK(MP_STATE_VM(sched_idx) + MP_STATE_VM(sched_len)++);
-        MP_STATE_VM(sched_queue)[iput].func = function;
-        MP_STATE_VM(sched_queue)[iput].arg = arg;
-        MICROPY_SCHED_HOOK_SCHEDULED;
-        ret = true;
+    bool ret = mp_sched_queue_add(function, arg);
+    #if MICROPY_SCHEDULER_STATS
+    if (ret) {
+        SCHED_ATOMIC_INC(MP_STATE_VM(sched_scheduled)[MP_SCHED_SOURCE_HARD]);
     } else {
-        // schedule queue is full
-        ret = false;
+        SCHED_ATOMIC_INC(MP_STATE_VM(sched_dropped)[MP_SCHED_SOURCE_HARD]);
     }
-    MICROPY_END_ATOMIC_SECTION(atomic_state);
+    #endif
     return ret;
 }
 
+#if MICROPY_SCHEDULER_OVERFLOW || MICROPY_SCHEDULER_STATS
+// Like mp_sched_schedule, but if the heap can be used then a callback that
+// doesn't fit in the queue is kept on the overflow list (if enabled).
+bool mp_sched_schedule_soft(mp_obj_t function, mp_obj_t arg) {
+    #if MICROPY_ENABLE_GC
+    if (gc_is_locked()) {
+        // Eg in a hard interrupt handler.
+        return mp_sched_schedule(function, arg);
+    }
+    #endif
+
+    if (
+        #if MICROPY_SCHEDULER_OVERFLOW
+        // Once there is an overflow list, add to it so that callbacks from
+        // this source keep their order.
+        MP_STATE_VM(sched_overflow_head) == NULL &&
+        #endif
+        mp_sched_queue_add(function, arg)) {
+        #if MICROPY_SCHEDULER_STATS
+        SCHED_ATOMIC_INC(MP_STATE_VM(sched_scheduled)[MP_SCHED_SOURCE_SOFT]);
+        #endif
+        return true;
+    }
+
+    #if MICROPY_SCHEDULER_OVERFLOW
+    if (MP_STATE_VM(sched_overflow_len) < MP_STATE_VM(sched_overflow_max)) {
+        mp_sched_overflow_t *node = m_new_obj_maybe(mp_sched_overflow_t);
+        if (node != NULL) {
+            node->next = NULL;
+            node->item.func = function;
+            node->item.arg = arg;
+            #if MICROPY_SCHEDULER_STATS
+            node->item.ticks_us = mp_hal_ticks_us();
+            #endif
+            mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
+            if (MP_STATE_VM(sched_overflow_tail) == NULL) {
+                MP_STATE_VM(sched_overflow_head) = node;
+            } else {
+                MP_STATE_VM(sched_overflow_tail)->next = node;
+            }
+            MP_STATE_VM(sched_overflow_tail) = node;
+            ++MP_STATE_VM(sched_overflow_len);
+            mp_sched_set_pending();
+            MICROPY_END_ATOMIC_SECTION(atomic_state);
+            MICROPY_SCHED_HOOK_SCHEDULED;
+            #if MICROPY_SCHEDULER_STATS
+            SCHED_ATOMIC_INC(MP_STATE_VM(sched_scheduled)[MP_SCHED_SOURCE_SOFT]);
+            SCHED_ATOMIC_INC(MP_STATE_VM(sched_deferred)[MP_SCHED_SOURCE_SOFT]);
+            #endif
+            return true;
+        }
+    }
+    #endif
+
+    #if MICROPY_SCHEDULER_STATS
+    SCHED_ATOMIC_INC(MP_STATE_VM(sched_dropped)[MP_SCHED_SOURCE_SOFT]);
+    #endif
+    return false;
+}
+#endif
+
 #if MICROPY_SCHEDULER_STATIC_NODES
 bool mp_sched_schedule_node(mp_sched_node_t *node, mp_sched_callback_t callback) {
     mp_uint_t atomic_state = MICROPY_BEGIN_ATOMIC_SECTION();
     bool ret;
     if (node->callback == NULL) {
-        if (MP_STATE_VM(sched_state) == MP_SCHED_IDLE) {
-            MP_STATE_VM(sched_state) = MP_SCHED_PENDING;
-        }
+        mp_sched_set_pending();
         node->callback = callback;
         node->next = NULL;
         if (MP_STATE_VM(sched_tail) == NULL) {
@@ -208,6 +445,9 @@ bool mp_sched_schedule_node(mp_sched_node_t *node, mp_sched_callback_t callback)
 #endif
 
 MP_REGISTER_ROOT_POINTER(mp_sched_item_t sched_queue[MICROPY_SCHEDULER_DEPTH]);
+#if MICROPY_SCHEDULER_OVERFLOW
+MP_REGISTER_ROOT_POINTER(struct _mp_sched_overflow_t *sched_overflow_head);
+#endif
 
 #endif // MICROPY_ENABLE_SCHEDULER
 
@@ -161,7 +161,13 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
     mp_uint_t unum;
     qstr qst;
 
-    switch (*ip++) {
+    byte opcode = *ip++;
+    #if MICROPY_OPT_QUICKEN
+    // Show quickened opcodes as the generic ones that they specialise.
+    opcode = mp_bc_unquicken(opcode);
+    #endif
+
+    switch (opcode) {
         case MP_BC_LOAD_CONST_FALSE:
             mp_printf(print, "LOAD_CONST_FALSE");
             break;
@@ -518,21 +524,55 @@ const byte *mp_bytecode_print_str(const mp_print_t *print, const byte *ip_start,
             mp_printf(print, "IMPORT_STAR");
             break;
 
+        #if MICROPY_OPT_FUSED_OPCODES
+        case MP_BC_LOAD_FAST_2:
+            mp_printf(print, "LOAD_FAST_2 %u %u", *ip >> 4, *ip & 0x0f);
+            ip += 1;
+            break;
+
+        case MP_BC_LOAD_FAST0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "LOAD_FAST0_ATTR %q", qst);
+            break;
+
+        case MP_BC_STORE_FAST0_ATTR:
+            DECODE_QSTR;
+            mp_printf(print, "STORE_FAST0_ATTR %q", qst);
+            break;
+
+        case MP_BC_BINARY_OP_SMALL_INT: {
+            mp_uint_t op = (*ip & 0x80 ? MP_BINARY_OP_INPLACE_ADD : MP_BINARY_OP_ADD) + (*ip >> 6 & 1);
+            mp_printf(print, "BINARY_OP_SMALL_INT " UINT_FMT " %q " INT_FMT, op, (qstr)mp_binary_op_method_name[op],
+                (mp_int_t)(*ip & 0x3f) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
+            ip += 1;
+            break;
+        }
+
+        case MP_BC_POP_JUMP_IF_COMPARE: {
+            DECODE_SLABEL;
+            mp_uint_t op = *ip & 0x7f;
+            mp_printf(print, "POP_JUMP_IF_COMPARE " UINT_FMT " " UINT_FMT " %q %s", (mp_uint_t)(ip + unum - ip_start),
+                op, (qstr)mp_binary_op_method_name[op], *ip >> 7 ? "true" : "false");
+            ip += 1;
+            break;
+        }
+        #endif
+
         default:
-            if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
-                mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
-            } else if (ip[-1] < MP_BC_LOAD_FAST_MULTI + 16) {
-                mp_printf(print, "LOAD_FAST " UINT_FMT, (mp_uint_t)ip[-1] - MP_BC_LOAD_FAST_MULTI);
-            } else if (ip[-1] < MP_BC_STORE_FAST_MULTI + 16) {
-                mp_printf(print, "STORE_FAST " UINT_FMT, (mp_uint_t)ip[-1] - MP_BC_STORE_FAST_MULTI);
-            } else if (ip[-1] < MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE) {
-                mp_uint_t op = ip[-1] - MP_BC_UNARY_OP_MULTI;
+            if (opcode < MP_BC_LOAD_CONST_SMALL_INT_MULTI + 64) {
+                mp_printf(print, "LOAD_CONST_SMALL_INT " INT_FMT, (mp_int_t)opcode - MP_BC_LOAD_CONST_SMALL_INT_MULTI - 16);
+            } else if (opcode < MP_BC_LOAD_FAST_MULTI + 16) {
+                mp_printf(print, "LOAD_FAST " UINT_FMT, (mp_uint_t)opcode - MP_BC_LOAD_FAST_MULTI);
+            } else if (opcode < MP_BC_STORE_FAST_MULTI + 16) {
+                mp_printf(print, "STORE_FAST " UINT_FMT, (mp_uint_t)opcode - MP_BC_STORE_FAST_MULTI);
+            } else if (opcode < MP_BC_UNARY_OP_MULTI + MP_UNARY_OP_NUM_BYTECODE) {
+                mp_uint_t op = opcode - MP_BC_UNARY_OP_MULTI;
                 mp_printf(print, "UNARY_OP " UINT_FMT " %q", op, (qstr)mp_unary_op_method_name[op]);
-            } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
-                mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
+            } else if (opcode < MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NUM_BYTECODE) {
+                mp_uint_t op = opcode - MP_BC_BINARY_OP_MULTI;
                 mp_printf(print, "BINARY_OP " UINT_FMT " %q", op, (qstr)mp_binary_op_method_name[op]);
             } else {
-                mp_printf(print, "code %p, byte code 0x%02x not implemented\n", ip - 1, ip[-1]);
+                mp_printf(print, "code %p, byte code 0x%02x not implemented\n", ip - 1, opcode);
                 assert(0);
                 return ip;
             }
@@ -32,9 +32,14 @@
 #include "py/emitglue.h"
 #include "py/objtype.h"
 #include "py/objfun.h"
+#include "py/objmodule.h"
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/bc0.h"
 #include "py/profile.h"
+#include "py/smallint.h"
+#include "py/objlist.h"
+#include "py/nativetier.h"
 
 // *FORMAT-OFF*
 
@@ -187,6 +192,24 @@
     } \
 } while(0)
 
+#elif MICROPY_VM_CODE_STATE_CHAIN
+
+// Only keep the chain of code states, for the allocation profiler.
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while(0)
+
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while(0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while(0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -211,6 +234,294 @@ MP_NOINLINE static mp_obj_t *build_slice_stack_allocated(byte op, mp_obj_t *sp,
 }
 #endif
 
+#if MICROPY_OPT_INLINE_CACHE
+#if !MICROPY_OPT_MAP_VERSION || !MICROPY_ENABLE_GC
+#error MICROPY_OPT_INLINE_CACHE requires MICROPY_OPT_MAP_VERSION and MICROPY_ENABLE_GC
+#endif
+
+// Each LOAD_ATTR and LOAD_METHOD instruction of a function gets an entry in
+// the function's inline cache the first time it runs, after the entries of
+// the instructions that ran before it.  Functions made from the same raw code
+// share the cache through it (see mp_make_function_from_proto_fun).  The
+// entry remembers the map that the name was found in, the version of that map
+// and the position of the name in it.  A repeat lookup in the same map with the same
+// version can then go straight to that position.  For instances with shared
+// keys the entry remembers their class instead, because a name has the same
+// position in all of them and keeps it (see py/objtype.h).  Only the maps of
+// classes and modules are remembered, so that an entry doesn't keep an
+// instance alive.
+//
+// Without the GIL, another thread may update an entry while it is being read,
+// so then a hit is also checked against the key at that position.
+#define VM_INLINE_CACHE_CHECK_KEY (MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL)
+
+// Find the entry for the instruction at the given offset, or make one if
+// there is room.
+MP_NOINLINE static mp_inline_cache_entry_t *vm_inline_cache_find(mp_obj_fun_bc_t *fun, size_t offset) {
+    mp_inline_cache_t *cache = fun->inline_cache;
+    if (fun->inline_cache_rc != NULL && fun->inline_cache_rc->inline_cache != cache) {
+        // Another function made from the same raw code has added entries.
+        cache = fun->inline_cache = fun->inline_cache_rc->inline_cache;
+    }
+    size_t used = 0;
+    if (cache != NULL) {
+        used = cache->used;
+        for (size_t i = 0; i < used; ++i) {
+            if (cache->entry[i].offset == offset) {
+                cache->entry[cache->last].succ = i;
+                cache->last = i;
+                cache->next = cache->entry[i].succ;
+                return &cache->entry[i];
+            }
+        }
+    }
+    if (offset > UINT16_MAX || used == UINT16_MAX) {
+        return NULL;
+    }
+    if (cache == NULL || used == cache->alloc) {
+        // Make a bigger cache.  The old one is left as it is, because a lookup
+        // that has called out to Python code may still be using an entry in it.
+        size_t alloc = used == 0 ? 4 : MIN(2 * used, UINT16_MAX);
+        mp_inline_cache_t *new_cache = m_new_obj_var_maybe(mp_inline_cache_t, entry, mp_inline_cache_entry_t, alloc);
+        if (new_cache == NULL) {
+            return NULL;
+        }
+        new_cache->alloc = alloc;
+        if (used != 0) {
+            new_cache->last = cache->last;
+            new_cache->next = cache->next;
+            memcpy(new_cache->entry, cache->entry, used * sizeof(mp_inline_cache_entry_t));
+        }
+        cache = new_cache;
+    }
+    mp_inline_cache_entry_t *entry = &cache->entry[used];
+    entry->owner = NULL;
+    entry->version = 0;
+    entry->offset = offset;
+    entry->pos = 0;
+    entry->succ = 0;
+    if (used != 0) {
+        cache->entry[cache->last].succ = used;
+    }
+    cache->used = used + 1;
+    cache->last = used;
+    cache->next = 0;
+    fun->inline_cache = cache;
+    if (fun->inline_cache_rc != NULL) {
+        fun->inline_cache_rc->inline_cache = cache;
+    }
+    return entry;
+}
+
+// Get the entry for the instruction ending at ip, or NULL if it has none.
+static inline mp_inline_cache_entry_t *vm_inline_cache(mp_obj_fun_bc_t *fun, const byte *ip) {
+    mp_inline_cache_t *cache = fun->inline_cache;
+    size_t offset = ip - fun->bytecode;
+    if (cache != NULL) {
+        // Instructions mostly run in the same order each time, so first try
+        // the one that followed the last one before.
+        size_t i = cache->next;
+        if (cache->entry[i].offset == offset) {
+            cache->last = i;
+            cache->next = cache->entry[i].succ;
+            return &cache->entry[i];
+        }
+    }
+    return vm_inline_cache_find(fun, offset);
+}
+
+// Like mp_map_lookup(map, key, MP_MAP_LOOKUP), using and updating the entry.
+static mp_map_elem_t *vm_inline_cache_map_lookup(mp_map_t *map, mp_obj_t key, mp_inline_cache_entry_t *entry) {
+    if (entry->owner == map && entry->version == map->version) {
+        size_t pos = entry->pos;
+        #if VM_INLINE_CACHE_CHECK_KEY
+        if (pos < map->alloc && map->table[pos].key == key)
+        #endif
+        {
+            return &map->table[pos];
+        }
+    }
+    mp_map_elem_t *elem = mp_map_lookup(map, key, MP_MAP_LOOKUP);
+    // A map with version 0 may have had keys put in it directly, unless it's
+    // fixed and so never changes.
+    if (elem != NULL && (map->version != 0 || map->is_fixed) && elem - map->table <= UINT16_MAX) {
+        entry->owner = map;
+        entry->version = map->version;
+        entry->pos = elem - map->table;
+    }
+    return elem;
+}
+
+// Like mp_obj_instance_lookup_member, using and updating the entry.
+static mp_obj_t *vm_inline_cache_instance_lookup(mp_obj_instance_t *self, mp_obj_t key, mp_inline_cache_entry_t *entry) {
+    #if MICROPY_OPT_INSTANCE_SHARED_KEYS
+    if (mp_obj_instance_members_are_split(self)) {
+        const mp_obj_type_t *type = self->base.type;
+        mp_obj_t *values = mp_obj_instance_split_values(self);
+        size_t pos = entry->pos;
+        if (entry->owner == type && pos < self->members.used
+            #if VM_INLINE_CACHE_CHECK_KEY
+            && MP_OBJ_INSTANCE_TYPE_KEYS(type)->items[pos] == key
+            #endif
+            ) {
+            return values[pos] == MP_OBJ_NULL ? NULL : &values[pos];
+        }
+        mp_obj_t *value = mp_obj_instance_lookup_member(self, key);
+        if (value != NULL) {
+            entry->owner = type;
+            entry->version = 0;
+            entry->pos = value - values;
+        }
+        return value;
+    }
+    #else
+    (void)entry;
+    #endif
+    return mp_obj_instance_lookup_member(self, key);
+}
+
+static mp_obj_t vm_load_attr(mp_obj_t base, qstr attr, mp_inline_cache_entry_t *entry) {
+    if (entry != NULL) {
+        const mp_obj_type_t *type = mp_obj_get_type(base);
+        if (mp_obj_is_instance_type(type)) {
+            // Instance members (see MICROPY_OPT_LOAD_ATTR_FAST_PATH).
+            mp_obj_t *value = vm_inline_cache_instance_lookup(MP_OBJ_TO_PTR(base), MP_OBJ_NEW_QSTR(attr), entry);
+            if (value != NULL) {
+                return *value;
+            }
+        } else if (type == &mp_type_module && attr != MP_QSTR___class__ && attr != MP_QSTR___next__) {
+            mp_map_elem_t *elem = vm_inline_cache_map_lookup(&((mp_obj_module_t *)MP_OBJ_TO_PTR(base))->globals->map, MP_OBJ_NEW_QSTR(attr), entry);
+            if (elem != NULL) {
+                return elem->value;
+            }
+        }
+    }
+    return mp_load_attr(base, attr);
+}
+
+// This handles the common cases of mp_load_method() that end in a lookup in a
+// single map: methods of a user class called on its instances, functions of
+// modules, and methods of built-in types.
+static void vm_load_method(mp_obj_t base, qstr attr, mp_obj_t *dest, mp_inline_cache_entry_t *entry) {
+    if (entry != NULL && attr != MP_QSTR___class__ && attr != MP_QSTR___next__) {
+        mp_obj_t key = MP_OBJ_NEW_QSTR(attr);
+        const mp_obj_type_t *type = mp_obj_get_type(base);
+        if (mp_obj_is_instance_type(type)) {
+            // The method must be found in the class itself, not shadowed by
+            // an instance member, and need no special handling.
+            if (!(type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)
+                #if MICROPY_CPYTHON_COMPAT
+                && attr != MP_QSTR___dict__
+                #endif
+                && MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)
+                && mp_obj_instance_lookup_member(MP_OBJ_TO_PTR(base), key) == NULL) {
+                mp_map_elem_t *elem = vm_inline_cache_map_lookup(&MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map, key, entry);
+                if (elem != NULL) {
+                    dest[1] = MP_OBJ_NULL;
+                    mp_convert_member_lookup(base, type, elem->value, dest);
+                    return;
+                }
+            }
+        } else if (type == &mp_type_module) {
+            mp_map_elem_t *elem = vm_inline_cache_map_lookup(&((mp_obj_module_t *)MP_OBJ_TO_PTR(base))->globals->map, key, entry);
+            if (elem != NULL) {
+                dest[0] = elem->value;
+                dest[1] = MP_OBJ_NULL;
+                return;
+            }
+        } else if (!MP_OBJ_TYPE_HAS_SLOT(type, attr) && MP_OBJ_TYPE_HAS_SLOT(type, locals_dict)) {
+            mp_map_elem_t *elem = vm_inline_cache_map_lookup(&MP_OBJ_TYPE_GET_SLOT(type, locals_dict)->map, key, entry);
+            if (elem != NULL) {
+                dest[1] = MP_OBJ_NULL;
+                mp_convert_member_lookup(base, type, elem->value, dest);
+                return;
+            }
+        }
+    }
+    mp_load_method(base, attr, dest);
+}
+#endif
+
+#if MICROPY_OPT_VM_STACK_CACHE && !MICROPY_OPT_COMPUTED_GOTO
+#error MICROPY_OPT_VM_STACK_CACHE requires MICROPY_OPT_COMPUTED_GOTO
+#endif
+
+#if MICROPY_OPT_FUSED_OPCODES || MICROPY_OPT_QUICKEN
+// Compare two small ints, op must be from MP_BINARY_OP_LESS to MP_BINARY_OP_NOT_EQUAL.
+static inline bool small_int_compare(mp_binary_op_t op, mp_int_t lhs, mp_int_t rhs) {
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return lhs < rhs;
+        case MP_BINARY_OP_MORE:
+            return lhs > rhs;
+        case MP_BINARY_OP_EQUAL:
+            return lhs == rhs;
+        case MP_BINARY_OP_LESS_EQUAL:
+            return lhs <= rhs;
+        case MP_BINARY_OP_MORE_EQUAL:
+            return lhs >= rhs;
+        default: // MP_BINARY_OP_NOT_EQUAL
+            return lhs != rhs;
+    }
+}
+#endif
+
+#if MICROPY_OPT_QUICKEN
+#if !MICROPY_ENABLE_GC
+#error MICROPY_OPT_QUICKEN requires MICROPY_ENABLE_GC
+#endif
+
+// A generic opcode whose arguments have the types that a quickened opcode is
+// specialised for is rewritten in place to that quickened opcode, which then
+// handles those types without a full call to mp_binary_op or mp_obj_subscr.
+// A quickened opcode that sees other types rewrites itself back to the generic
+// opcode.  Only bytecode in the heap is rewritten: frozen bytecode, and .mpy
+// files imported in place from ROM, always run the generic opcodes.  Which of
+// these a function has is worked out once when it is created.
+static inline void quicken(const byte *ip, byte opcode) {
+    *(byte *)ip = opcode;
+}
+
+static inline void quicken_binary_op(const mp_code_state_t *code_state, const byte *ip, mp_binary_op_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (code_state->fun_bc->quicken && mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        if (op <= MP_BINARY_OP_NOT_EQUAL) {
+            quicken(ip, MP_BC_BINARY_OP_INT_MULTI + op);
+        } else if (op == MP_BINARY_OP_INPLACE_ADD || op == MP_BINARY_OP_INPLACE_SUBTRACT) {
+            quicken(ip, MP_BC_BINARY_OP_INT_INPLACE_ADD + op - MP_BINARY_OP_INPLACE_ADD);
+        } else if (op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_SUBTRACT) {
+            quicken(ip, MP_BC_BINARY_OP_INT_ADD + op - MP_BINARY_OP_ADD);
+        }
+    }
+}
+
+static inline void quicken_subscr(const mp_code_state_t *code_state, const byte *ip, bool load, mp_obj_t base, mp_obj_t index) {
+    if (!code_state->fun_bc->quicken) {
+        return;
+    }
+    if (mp_obj_is_small_int(index)) {
+        if (mp_obj_is_type(base, &mp_type_list)) {
+            quicken(ip, load ? MP_BC_LOAD_SUBSCR_LIST_INT : MP_BC_STORE_SUBSCR_LIST_INT);
+        }
+    } else if (load && mp_obj_is_str(index) && mp_obj_is_type(base, &mp_type_dict)) {
+        quicken(ip, MP_BC_LOAD_SUBSCR_DICT_STR);
+    }
+}
+
+// Returns a pointer to the item of the list at the given index, or NULL if the
+// index is out of range.
+static inline mp_obj_t *list_item_ptr(mp_obj_t list, mp_obj_t index) {
+    mp_obj_list_t *o = MP_OBJ_TO_PTR(list);
+    mp_int_t i = MP_OBJ_SMALL_INT_VALUE(index);
+    if (i < 0) {
+        i += o->len;
+    }
+    if ((mp_uint_t)i >= o->len) {
+        return NULL;
+    }
+    return &o->items[i];
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -253,6 +564,23 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
     #define DISPATCH_WITH_PEND_EXC_CHECK() goto pending_exception_check
     #define ENTRY(op) entry_##op
     #define ENTRY_DEFAULT entry_default
+    #if MICROPY_OPT_VM_STACK_CACHE
+    // Dispatch with the top of the stack in tos, not in memory at sp[1].  If
+    // the opcode has no cached variant then tos is pushed back to memory and
+    // the usual handler runs.
+    #define DISPATCH_CACHED() do { \
+        TRACE(ip); \
+        MARK_EXC_IP_GLOBAL(); \
+        TRACE_TICK(ip, sp, false); \
+        const void *entry = entry_table_cached[*ip++]; \
+        if (entry == NULL) { \
+            PUSH(tos); \
+            entry = entry_table[ip[-1]]; \
+        } \
+        goto *entry; \
+    } while (0)
+    #define ENTRY_CACHED(op) entry_cached_##op
+    #endif
 #else
     #define DISPATCH() goto dispatch_loop
     #define DISPATCH_WITH_PEND_EXC_CHECK() goto pending_exception_check
@@ -306,6 +634,9 @@ outer_dispatch_loop:
             const qstr_short_t *qstr_table = code_state->fun_bc->context->constants.qstr_table;
             #endif
             mp_obj_t obj_shared;
+            #if MICROPY_OPT_VM_STACK_CACHE
+            mp_obj_t tos = MP_OBJ_NULL;
+            #endif
             MICROPY_VM_HOOK_INIT
 
             // If we have exception to inject, now that we finish setting up
@@ -408,29 +739,37 @@ dispatch_loop:
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_LOAD_ATTR): {
+                ENTRY(MP_BC_LOAD_ATTR):
+                #if MICROPY_OPT_FUSED_OPCODES
+                load_attr:
+                #endif
+                {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
+                    #if MICROPY_OPT_INLINE_CACHE
+                    obj = vm_load_attr(top, qst, vm_inline_cache(code_state->fun_bc, ip));
+                    #else
                     #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
                     // types are extremely common, so avoid all the other checks and
                     // calls that normally happen first.
-                    mp_map_elem_t *elem = NULL;
+                    mp_obj_t *value = NULL;
                     if (mp_obj_is_instance_type(mp_obj_get_type(top))) {
                         mp_obj_instance_t *self = MP_OBJ_TO_PTR(top);
-                        elem = mp_map_lookup(&self->members, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+                        value = mp_obj_instance_lookup_member(self, MP_OBJ_NEW_QSTR(qst));
                     }
-                    if (elem) {
-                        obj = elem->value;
+                    if (value) {
+                        obj = *value;
                     } else
                     #endif
                     {
                         obj = mp_load_attr(top, qst);
                     }
+                    #endif
                     SET_TOP(obj);
                     DISPATCH();
                 }
@@ -438,7 +777,11 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_INLINE_CACHE
+                    vm_load_method(*sp, qst, sp, vm_inline_cache(code_state->fun_bc, ip));
+                    #else
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -456,9 +799,16 @@ dispatch_loop:
                     PUSH(mp_load_build_class());
                     DISPATCH();
 
-                ENTRY(MP_BC_LOAD_SUBSCR): {
+                ENTRY(MP_BC_LOAD_SUBSCR):
+                #if MICROPY_OPT_QUICKEN
+                load_subscr:
+                #endif
+                {
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t index = POP();
+                    #if MICROPY_OPT_QUICKEN
+                    quicken_subscr(code_state, ip - 1, true, TOP(), index);
+                    #endif
                     SET_TOP(mp_obj_subscr(TOP(), index, MP_OBJ_SENTINEL));
                     DISPATCH();
                 }
@@ -489,7 +839,11 @@ dispatch_loop:
                     DISPATCH();
                 }
 
-                ENTRY(MP_BC_STORE_ATTR): {
+                ENTRY(MP_BC_STORE_ATTR):
+                #if MICROPY_OPT_FUSED_OPCODES
+                store_attr:
+                #endif
+                {
                     FRAME_UPDATE();
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
@@ -499,7 +853,13 @@ dispatch_loop:
                 }
 
                 ENTRY(MP_BC_STORE_SUBSCR):
+                #if MICROPY_OPT_QUICKEN
+                store_subscr:
+                #endif
                     MARK_EXC_IP_SELECTIVE();
+                    #if MICROPY_OPT_QUICKEN
+                    quicken_subscr(code_state, ip - 1, false, sp[-1], sp[0]);
+                    #endif
                     mp_obj_subscr(sp[-1], sp[0], sp[-2]);
                     sp -= 3;
                     DISPATCH();
@@ -799,13 +1159,18 @@ unwind_jump:;
                         sp -= MP_OBJ_ITER_BUF_NSLOTS; // pop the exhausted iterator
                         ip += ulab; // jump to after for-block
                     } else {
-                        PUSH(value); // push the next iteration value
                         #if MICROPY_PY_SYS_SETTRACE
                         // LINE event should trigger for every iteration so invalidate last trigger
                         if (code_state->frame) {
                             code_state->frame->lineno = 0;
                         }
                         #endif
+                        #if MICROPY_OPT_VM_STACK_CACHE
+                        tos = value;
+                        DISPATCH_CACHED();
+                        #else
+                        PUSH(value); // push the next iteration value
+                        #endif
                     }
                     DISPATCH();
                 }
@@ -1277,14 +1642,210 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_OPT_FUSED_OPCODES
+                ENTRY(MP_BC_LOAD_FAST_2): {
+                    mp_obj_t obj1 = fastn[-(mp_int_t)(*ip >> 4)];
+                    mp_obj_t obj2 = fastn[-(mp_int_t)(*ip++ & 0x0f)];
+                    if (obj1 == MP_OBJ_NULL || obj2 == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(obj1);
+                    #if MICROPY_OPT_VM_STACK_CACHE
+                    tos = obj2;
+                    DISPATCH_CACHED();
+                    #else
+                    PUSH(obj2);
+                    DISPATCH();
+                    #endif
+                }
+
+                // These push local 0 and then continue as LOAD_ATTR and
+                // STORE_ATTR, which have the same encoding.
+                ENTRY(MP_BC_LOAD_FAST0_ATTR):
+                    if (fastn[0] == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(fastn[0]);
+                    goto load_attr;
+
+                ENTRY(MP_BC_STORE_FAST0_ATTR):
+                    if (fastn[0] == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    PUSH(fastn[0]);
+                    goto store_attr;
+
+                ENTRY(MP_BC_BINARY_OP_SMALL_INT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_uint_t arg = *ip++;
+                    mp_int_t rhs = (mp_int_t)(arg & 0x3f) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS;
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs)) {
+                        // Add or subtract without calling mp_binary_op if the result fits.
+                        mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs);
+                        if (arg & 0x40) {
+                            lhs_val -= rhs;
+                        } else {
+                            lhs_val += rhs;
+                        }
+                        if (MP_SMALL_INT_FITS(lhs_val)) {
+                            SET_TOP(MP_OBJ_NEW_SMALL_INT(lhs_val));
+                            DISPATCH();
+                        }
+                    }
+                    mp_binary_op_t op = (arg & 0x80 ? MP_BINARY_OP_INPLACE_ADD : MP_BINARY_OP_ADD) + (arg >> 6 & 1);
+                    SET_TOP(mp_binary_op(op, lhs, MP_OBJ_NEW_SMALL_INT(rhs)));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_POP_JUMP_IF_COMPARE): {
+                    MARK_EXC_IP_SELECTIVE();
+                    DECODE_SLABEL;
+                    const byte *target = ip + slab;
+                    mp_binary_op_t op = *ip & 0x7f;
+                    bool jump_if = *ip++ >> 7;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = POP();
+                    bool result;
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs) && op <= MP_BINARY_OP_NOT_EQUAL) {
+                        // Compare small ints without making a bool object.
+                        result = small_int_compare(op, MP_OBJ_SMALL_INT_VALUE(lhs), MP_OBJ_SMALL_INT_VALUE(rhs));
+                    } else {
+                        result = mp_obj_is_true(mp_binary_op(op, lhs, rhs));
+                    }
+                    if (result == jump_if) {
+                        ip = target;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+                #endif
+
+                #if MICROPY_OPT_QUICKEN
+                ENTRY(MP_BC_BINARY_OP_INT_MULTI):
+                #if !MICROPY_OPT_COMPUTED_GOTO
+                binary_op_int_multi:
+                #endif
+                {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_binary_op_t op = ip[-1] - MP_BC_BINARY_OP_INT_MULTI;
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        SET_TOP(mp_obj_new_bool(small_int_compare(op, MP_OBJ_SMALL_INT_VALUE(lhs), MP_OBJ_SMALL_INT_VALUE(rhs))));
+                        DISPATCH();
+                    }
+                    ((byte *)ip)[-1] = MP_BC_BINARY_OP_MULTI + op;
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_INPLACE_ADD):
+                ENTRY(MP_BC_BINARY_OP_INT_ADD): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        mp_int_t res = MP_OBJ_SMALL_INT_VALUE(lhs) + MP_OBJ_SMALL_INT_VALUE(rhs);
+                        if (MP_SMALL_INT_FITS(res)) {
+                            SET_TOP(MP_OBJ_NEW_SMALL_INT(res));
+                            DISPATCH();
+                        }
+                    } else {
+                        ((byte *)ip)[-1] = mp_bc_unquicken(ip[-1]);
+                    }
+                    SET_TOP(mp_binary_op(mp_bc_unquicken(ip[-1]) - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT):
+                ENTRY(MP_BC_BINARY_OP_INT_SUBTRACT): {
+                    MARK_EXC_IP_SELECTIVE();
+                    mp_obj_t rhs = POP();
+                    mp_obj_t lhs = TOP();
+                    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+                        mp_int_t res = MP_OBJ_SMALL_INT_VALUE(lhs) - MP_OBJ_SMALL_INT_VALUE(rhs);
+                        if (MP_SMALL_INT_FITS(res)) {
+                            SET_TOP(MP_OBJ_NEW_SMALL_INT(res));
+                            DISPATCH();
+                        }
+                    } else {
+                        ((byte *)ip)[-1] = mp_bc_unquicken(ip[-1]);
+                    }
+                    SET_TOP(mp_binary_op(mp_bc_unquicken(ip[-1]) - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_LOAD_SUBSCR_LIST_INT): {
+                    mp_obj_t index = TOP();
+                    mp_obj_t base = sp[-1];
+                    if (mp_obj_is_small_int(index) && mp_obj_is_type(base, &mp_type_list)) {
+                        mp_obj_t *item = list_item_ptr(base, index);
+                        if (item != NULL) {
+                            sp -= 1;
+                            SET_TOP(*item);
+                            DISPATCH();
+                        }
+                    } else {
+                        ((byte *)ip)[-1] = MP_BC_LOAD_SUBSCR;
+                    }
+                    goto load_subscr;
+                }
+
+                ENTRY(MP_BC_LOAD_SUBSCR_DICT_STR): {
+                    mp_obj_t index = TOP();
+                    mp_obj_t base = sp[-1];
+                    if (mp_obj_is_str(index) && mp_obj_is_type(base, &mp_type_dict)) {
+                        mp_obj_dict_t *o = MP_OBJ_TO_PTR(base);
+                        mp_map_elem_t *elem = mp_map_lookup(&o->map, index, MP_MAP_LOOKUP);
+                        if (elem != NULL) {
+                            sp -= 1;
+                            SET_TOP(elem->value);
+                            DISPATCH();
+                        }
+                    } else {
+                        ((byte *)ip)[-1] = MP_BC_LOAD_SUBSCR;
+                    }
+                    goto load_subscr;
+                }
+
+                ENTRY(MP_BC_STORE_SUBSCR_LIST_INT): {
+                    mp_obj_t index = sp[0];
+                    mp_obj_t base = sp[-1];
+                    if (mp_obj_is_small_int(index) && mp_obj_is_type(base, &mp_type_list)) {
+                        mp_obj_t *item = list_item_ptr(base, index);
+                        if (item != NULL) {
+                            *item = sp[-2];
+                            sp -= 3;
+                            DISPATCH();
+                        }
+                    } else {
+                        ((byte *)ip)[-1] = MP_BC_STORE_SUBSCR;
+                    }
+                    goto store_subscr;
+                }
+                #endif
+
                 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
+                    #if MICROPY_OPT_VM_STACK_CACHE
+                    tos = MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS);
+                    DISPATCH_CACHED();
+                    #else
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
                     DISPATCH();
+                    #endif
 
                 ENTRY(MP_BC_LOAD_FAST_MULTI):
+                    #if MICROPY_OPT_VM_STACK_CACHE
+                    tos = fastn[MP_BC_LOAD_FAST_MULTI - (mp_int_t)ip[-1]];
+                    if (tos == MP_OBJ_NULL) {
+                        goto local_name_error;
+                    }
+                    DISPATCH_CACHED();
+                    #else
                     obj_shared = fastn[MP_BC_LOAD_FAST_MULTI - (mp_int_t)ip[-1]];
                     goto load_check;
+                    #endif
 
                 ENTRY(MP_BC_STORE_FAST_MULTI):
                     fastn[MP_BC_STORE_FAST_MULTI - (mp_int_t)ip[-1]] = POP();
@@ -1297,16 +1858,161 @@ yield:
 
                 ENTRY(MP_BC_BINARY_OP_MULTI): {
                     MARK_EXC_IP_SELECTIVE();
+                    mp_binary_op_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    #if MICROPY_OPT_QUICKEN
+                    quicken_binary_op(code_state, ip - 1, op, lhs, rhs);
+                    #endif
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
+                    DISPATCH();
+                }
+
+                #if MICROPY_OPT_VM_STACK_CACHE
+                // Handlers for when the top of the stack is cached in tos, and
+                // sp points to the item below it.  Only some common opcodes have
+                // a cached variant, and these only handle the fast cases: other
+                // cases put tos back on the stack in memory and then run the
+                // usual handler.
+
+                ENTRY_CACHED(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
+                    PUSH(tos);
+                    goto entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI;
+
+                ENTRY_CACHED(MP_BC_LOAD_FAST_MULTI):
+                    PUSH(tos);
+                    goto entry_MP_BC_LOAD_FAST_MULTI;
+
+                ENTRY_CACHED(MP_BC_STORE_FAST_MULTI):
+                    fastn[MP_BC_STORE_FAST_MULTI - (mp_int_t)ip[-1]] = tos;
                     DISPATCH();
+
+                ENTRY_CACHED(MP_BC_POP_TOP):
+                    DISPATCH();
+
+                ENTRY_CACHED(MP_BC_POP_JUMP_IF_TRUE): {
+                    DECODE_SLABEL;
+                    if (mp_obj_is_true(tos)) {
+                        ip += slab;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
+                ENTRY_CACHED(MP_BC_POP_JUMP_IF_FALSE): {
+                    DECODE_SLABEL;
+                    if (!mp_obj_is_true(tos)) {
+                        ip += slab;
+                    }
+                    DISPATCH_WITH_PEND_EXC_CHECK();
+                }
+
+                #if MICROPY_OPT_FUSED_OPCODES
+                ENTRY_CACHED(MP_BC_LOAD_FAST_2):
+                    PUSH(tos);
+                    goto entry_MP_BC_LOAD_FAST_2;
+
+                ENTRY_CACHED(MP_BC_BINARY_OP_SMALL_INT):
+                    if (mp_obj_is_small_int(tos)) {
+                        mp_int_t rhs = (mp_int_t)(*ip & 0x3f) - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS;
+                        mp_int_t res = MP_OBJ_SMALL_INT_VALUE(tos) + (*ip & 0x40 ? -rhs : rhs);
+                        if (MP_SMALL_INT_FITS(res)) {
+                            ip++;
+                            tos = MP_OBJ_NEW_SMALL_INT(res);
+                            DISPATCH_CACHED();
+                        }
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_BINARY_OP_SMALL_INT;
+
+                ENTRY_CACHED(MP_BC_POP_JUMP_IF_COMPARE): {
+                    // The op byte follows the 1 or 2 byte label.
+                    mp_binary_op_t op = ip[1 + (ip[0] >> 7)] & 0x7f;
+                    if (mp_obj_is_small_int(sp[0]) && mp_obj_is_small_int(tos) && op <= MP_BINARY_OP_NOT_EQUAL) {
+                        DECODE_SLABEL;
+                        const byte *target = ip + slab;
+                        bool jump_if = *ip++ >> 7;
+                        mp_obj_t lhs = POP();
+                        if (small_int_compare(op, MP_OBJ_SMALL_INT_VALUE(lhs), MP_OBJ_SMALL_INT_VALUE(tos)) == jump_if) {
+                            ip = target;
+                        }
+                        DISPATCH_WITH_PEND_EXC_CHECK();
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_POP_JUMP_IF_COMPARE;
+                }
+                #endif
+
+                #if MICROPY_OPT_QUICKEN
+                ENTRY_CACHED(MP_BC_BINARY_OP_INT_MULTI):
+                    if (mp_obj_is_small_int(sp[0]) && mp_obj_is_small_int(tos)) {
+                        mp_obj_t lhs = POP();
+                        tos = mp_obj_new_bool(small_int_compare(ip[-1] - MP_BC_BINARY_OP_INT_MULTI, MP_OBJ_SMALL_INT_VALUE(lhs), MP_OBJ_SMALL_INT_VALUE(tos)));
+                        DISPATCH_CACHED();
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_BINARY_OP_INT_MULTI;
+
+                ENTRY_CACHED(MP_BC_BINARY_OP_INT_INPLACE_ADD):
+                ENTRY_CACHED(MP_BC_BINARY_OP_INT_ADD):
+                    if (mp_obj_is_small_int(sp[0]) && mp_obj_is_small_int(tos)) {
+                        mp_int_t res = MP_OBJ_SMALL_INT_VALUE(sp[0]) + MP_OBJ_SMALL_INT_VALUE(tos);
+                        if (MP_SMALL_INT_FITS(res)) {
+                            sp--;
+                            tos = MP_OBJ_NEW_SMALL_INT(res);
+                            DISPATCH_CACHED();
+                        }
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_BINARY_OP_INT_ADD;
+
+                ENTRY_CACHED(MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT):
+                ENTRY_CACHED(MP_BC_BINARY_OP_INT_SUBTRACT):
+                    if (mp_obj_is_small_int(sp[0]) && mp_obj_is_small_int(tos)) {
+                        mp_int_t res = MP_OBJ_SMALL_INT_VALUE(sp[0]) - MP_OBJ_SMALL_INT_VALUE(tos);
+                        if (MP_SMALL_INT_FITS(res)) {
+                            sp--;
+                            tos = MP_OBJ_NEW_SMALL_INT(res);
+                            DISPATCH_CACHED();
+                        }
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_BINARY_OP_INT_SUBTRACT;
+
+                ENTRY_CACHED(MP_BC_LOAD_SUBSCR_LIST_INT):
+                    if (mp_obj_is_small_int(tos) && mp_obj_is_type(sp[0], &mp_type_list)) {
+                        mp_obj_t *item = list_item_ptr(sp[0], tos);
+                        if (item != NULL) {
+                            sp--;
+                            tos = *item;
+                            DISPATCH_CACHED();
+                        }
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_LOAD_SUBSCR_LIST_INT;
+
+                ENTRY_CACHED(MP_BC_STORE_SUBSCR_LIST_INT):
+                    if (mp_obj_is_small_int(tos) && mp_obj_is_type(sp[0], &mp_type_list)) {
+                        mp_obj_t *item = list_item_ptr(sp[0], tos);
+                        if (item != NULL) {
+                            *item = sp[-1];
+                            sp -= 2;
+                            DISPATCH();
+                        }
+                    }
+                    PUSH(tos);
+                    goto entry_MP_BC_STORE_SUBSCR_LIST_INT;
+                #endif
+                #endif // MICROPY_OPT_VM_STACK_CACHE
+
                 ENTRY_DEFAULT:
                     MARK_EXC_IP_SELECTIVE();
                 #else
                 ENTRY_DEFAULT:
+                    #if MICROPY_OPT_QUICKEN
+                    if (ip[-1] >= MP_BC_BINARY_OP_INT_MULTI && ip[-1] <= MP_BC_BINARY_OP_INT_MULTI + MP_BINARY_OP_NOT_EQUAL) {
+                        goto binary_op_int_multi;
+                    } else
+                    #endif
                     if (ip[-1] < MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM) {
                         PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
                         DISPATCH();
@@ -1320,9 +2026,13 @@ yield:
                         SET_TOP(mp_unary_op(ip[-1] - MP_BC_UNARY_OP_MULTI, TOP()));
                         DISPATCH();
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
+                        mp_binary_op_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        #if MICROPY_OPT_QUICKEN
+                        quicken_binary_op(code_state, ip - 1, op, lhs, rhs);
+                        #endif
+                        SET_TOP(mp_binary_op(op, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
@@ -1345,6 +2055,10 @@ pending_exception_check:
                 // occur every few instructions.
                 MICROPY_VM_HOOK_LOOP
 
+                #if MICROPY_EMIT_NATIVE_TIERING
+                mp_native_tier_branch(code_state->fun_bc);
+                #endif
+
                 // Check for pending exceptions or scheduled tasks to run.
                 // Note: it's safe to just call mp_handle_pending(...), but
                 // we can inline the check for the common case where there is
@@ -113,6 +113,23 @@ static const void *const entry_table[256] = {
     [MP_BC_IMPORT_NAME] = &&entry_MP_BC_IMPORT_NAME,
     [MP_BC_IMPORT_FROM] = &&entry_MP_BC_IMPORT_FROM,
     [MP_BC_IMPORT_STAR] = &&entry_MP_BC_IMPORT_STAR,
+    #if MICROPY_OPT_FUSED_OPCODES
+    [MP_BC_LOAD_FAST_2] = &&entry_MP_BC_LOAD_FAST_2,
+    [MP_BC_LOAD_FAST0_ATTR] = &&entry_MP_BC_LOAD_FAST0_ATTR,
+    [MP_BC_STORE_FAST0_ATTR] = &&entry_MP_BC_STORE_FAST0_ATTR,
+    [MP_BC_BINARY_OP_SMALL_INT] = &&entry_MP_BC_BINARY_OP_SMALL_INT,
+    [MP_BC_POP_JUMP_IF_COMPARE] = &&entry_MP_BC_POP_JUMP_IF_COMPARE,
+    #endif
+    #if MICROPY_OPT_QUICKEN
+    [MP_BC_BINARY_OP_INT_MULTI ... MP_BC_BINARY_OP_INT_MULTI + MP_BINARY_OP_NOT_EQUAL] = &&entry_MP_BC_BINARY_OP_INT_MULTI,
+    [MP_BC_BINARY_OP_INT_INPLACE_ADD] = &&entry_MP_BC_BINARY_OP_INT_INPLACE_ADD,
+    [MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT] = &&entry_MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT,
+    [MP_BC_BINARY_OP_INT_ADD] = &&entry_MP_BC_BINARY_OP_INT_ADD,
+    [MP_BC_BINARY_OP_INT_SUBTRACT] = &&entry_MP_BC_BINARY_OP_INT_SUBTRACT,
+    [MP_BC_LOAD_SUBSCR_LIST_INT] = &&entry_MP_BC_LOAD_SUBSCR_LIST_INT,
+    [MP_BC_LOAD_SUBSCR_DICT_STR] = &&entry_MP_BC_LOAD_SUBSCR_DICT_STR,
+    [MP_BC_STORE_SUBSCR_LIST_INT] = &&entry_MP_BC_STORE_SUBSCR_LIST_INT,
+    #endif
     [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1] = &&entry_MP_BC_LOAD_CONST_SMALL_INT_MULTI,
     [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = &&entry_MP_BC_LOAD_FAST_MULTI,
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_STORE_FAST_MULTI_NUM - 1] = &&entry_MP_BC_STORE_FAST_MULTI,
@@ -120,6 +137,33 @@ static const void *const entry_table[256] = {
     [MP_BC_BINARY_OP_MULTI ... MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM - 1] = &&entry_MP_BC_BINARY_OP_MULTI,
 };
 
+#if MICROPY_OPT_VM_STACK_CACHE
+// Entries for when the top of the stack is cached in a local variable, NULL
+// for opcodes that have no such variant.
+static const void *const entry_table_cached[256] = {
+    [MP_BC_POP_TOP] = &&entry_cached_MP_BC_POP_TOP,
+    [MP_BC_POP_JUMP_IF_TRUE] = &&entry_cached_MP_BC_POP_JUMP_IF_TRUE,
+    [MP_BC_POP_JUMP_IF_FALSE] = &&entry_cached_MP_BC_POP_JUMP_IF_FALSE,
+    #if MICROPY_OPT_FUSED_OPCODES
+    [MP_BC_LOAD_FAST_2] = &&entry_cached_MP_BC_LOAD_FAST_2,
+    [MP_BC_BINARY_OP_SMALL_INT] = &&entry_cached_MP_BC_BINARY_OP_SMALL_INT,
+    [MP_BC_POP_JUMP_IF_COMPARE] = &&entry_cached_MP_BC_POP_JUMP_IF_COMPARE,
+    #endif
+    #if MICROPY_OPT_QUICKEN
+    [MP_BC_BINARY_OP_INT_MULTI ... MP_BC_BINARY_OP_INT_MULTI + MP_BINARY_OP_NOT_EQUAL] = &&entry_cached_MP_BC_BINARY_OP_INT_MULTI,
+    [MP_BC_BINARY_OP_INT_INPLACE_ADD] = &&entry_cached_MP_BC_BINARY_OP_INT_INPLACE_ADD,
+    [MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT] = &&entry_cached_MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT,
+    [MP_BC_BINARY_OP_INT_ADD] = &&entry_cached_MP_BC_BINARY_OP_INT_ADD,
+    [MP_BC_BINARY_OP_INT_SUBTRACT] = &&entry_cached_MP_BC_BINARY_OP_INT_SUBTRACT,
+    [MP_BC_LOAD_SUBSCR_LIST_INT] = &&entry_cached_MP_BC_LOAD_SUBSCR_LIST_INT,
+    [MP_BC_STORE_SUBSCR_LIST_INT] = &&entry_cached_MP_BC_STORE_SUBSCR_LIST_INT,
+    #endif
+    [MP_BC_LOAD_CONST_SMALL_INT_MULTI ... MP_BC_LOAD_CONST_SMALL_INT_MULTI + MP_BC_LOAD_CONST_SMALL_INT_MULTI_NUM - 1] = &&entry_cached_MP_BC_LOAD_CONST_SMALL_INT_MULTI,
+    [MP_BC_LOAD_FAST_MULTI ... MP_BC_LOAD_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = &&entry_cached_MP_BC_LOAD_FAST_MULTI,
+    [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_STORE_FAST_MULTI_NUM - 1] = &&entry_cached_MP_BC_STORE_FAST_MULTI,
+};
+#endif
+
 #if __clang__
 #pragma clang diagnostic pop
 #endif // __clang__
@@ -0,0 +1,55 @@
+# tests that code which is never executed is removed without changing scoping
+
+
+# a yield after return still makes a generator
+def f():
+    return
+    yield 1
+
+
+print(list(f()))
+
+
+# a name declared global after raise is still global
+def f():
+    global y
+    y = 3
+    raise ValueError
+    y = 4
+
+
+try:
+    f()
+except ValueError:
+    print(y)
+
+
+# dead code after break and continue
+for i in range(3):
+    if i == 1:
+        continue
+        print("wrong")
+    print(i)
+while True:
+    break
+    print("wrong")
+print("done")
+
+
+# closures are still created for variables only referenced in dead code
+def f():
+    z = 5
+
+    def g():
+        return z
+        z
+
+    return g
+
+
+print(f()())
+
+# constant conditional expressions
+print(1 if True else foo)
+print(foo if False else 2)
+print([i for i in range(3)] if 1 else foo)
@@ -0,0 +1,45 @@
+# tests constant folding of str and bytes operations, and comparisons, in parser
+
+# concatenation and repetition
+print("abc" + "def")
+print("ab" "cd" + "ef" * 2)
+print(b"ab" + b"cd")
+print(3 * b"x" + b"y")
+print("a" * 0, "a" * -1)
+
+# too large to be folded, but must still be correct
+print(len("abcd" * 1000))
+
+# invalid operations are left for the runtime to raise
+try:
+    "a" + 1
+except TypeError:
+    print("TypeError")
+try:
+    "a" + b"b"
+except TypeError:
+    print("TypeError")
+try:
+    "a" * "b"
+except TypeError:
+    print("TypeError")
+
+# comparisons
+print(1 < 2, 2 < 1, 1 < 2 < 3, 1 < 3 < 2)
+print(1 == 1, 1 != 1, 2 >= 2, 3 <= 2)
+print("a" == "a", "a" < "b", b"x" == b"x")
+print("b" in "abc", "d" in "abc", b"b" in b"abc")
+print(1 < 2 == 2 != 3)
+try:
+    1 < "a"
+except TypeError:
+    print("TypeError")
+
+# folded comparisons in conditions
+if "a" == "b":
+    print("wrong")
+else:
+    print("right")
+while 2 < 1:
+    print("wrong")
+print("yes" if "x" in "xyz" else "no")
@@ -16,8 +16,8 @@ class D(dict):
         super().__init__(*args, **kwargs)
 print(D())
 print(D([('a', 1)]))
-print(D([('a', 1)], a=2, b=3))
-print(D(a=2, b=3))
+print(sorted(D([('a', 1)], a=2, b=3).items()))
+print(sorted(D(a=2, b=3).items()))
 
 class D(dict):
     def __init__(self):
@@ -35,6 +35,8 @@ if _ZERO and _SMALLINT:
     print("Eliminated")
 if _FALSE:
     print("Eliminated")
+if (_EMPTY_TUPLE or _STR) == _STR:
+    print("Kept")
 
 while _SMALLINT:
     print("Kept")
@@ -57,9 +59,6 @@ if b == _STR:
 # The compiler is also unable to optimise these expressions, even though the arguments are const,
 # so these also contain JUMP_IF
 
-if (_EMPTY_TUPLE or _STR) == _STR:
-    print("Kept")
-
 if (_EMPTY_TUPLE and _STR) == _STR:
     print("Not Eliminated")
 
@@ -0,0 +1,30 @@
+# Test marshalling a function after it has run, when the VM may have rewritten
+# some of its opcodes into ones specialised for the types that it saw.
+
+try:
+    import marshal
+
+    (lambda: 0).__code__
+except (AttributeError, ImportError):
+    print("SKIP")
+    raise SystemExit
+
+ftype = type(lambda: 0)
+
+
+def f(l, d, a, b):
+    l[0] = l[1] + a
+    return l[0] - b, a < b, d["x"] + a
+
+
+data = marshal.dumps(f.__code__)
+l = [1, 2]
+d = {"x": 3}
+for _ in range(3):
+    print(f(l, d, 4, 5))
+print(marshal.dumps(f.__code__) == data)
+
+g = ftype(marshal.loads(marshal.dumps(f.__code__)), {})
+print(g(l, d, 4, 5))
+print(g([True, False], {"x": True}, 4, 5))
+print(g(l, d, True, 5))
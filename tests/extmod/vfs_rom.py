@@ -57,6 +57,23 @@ test_mpy = (
     b"\x63"  # RETURN_VALUE
 )
 
+# An mpy file with nested functions, from:
+#   def f(x):
+#       def g():
+#           def h():
+#               return x + 1
+#           return h
+#       return g
+test_nested_mpy = (
+    b"M\x06\x00\x1e"  # mpy file header, -msmall-int-bits=30
+    b"\x07\x00"  # n_qstr, n_obj
+    b"\x0elazy.py\x00\x0f\x02f\x00\x02g\x00\x02h\x00\x02x\x00"  # qstrs
+    b"\x0b\x4c\x00\x02\x01\x32\x00\x16\x02\x51\x63"  # <module>, 1 child
+    b"\x01\x7c\x11\x0b\x02\x05\x20\x65\x20\x00\xb0\x20\x00\x01\xc1\xb1\x63"  # f, 1 child
+    b"\x01\x6c\x11\x08\x03\x06\x40\x45\xb0\x20\x00\x01\xc1\xb1\x63"  # g, 1 child
+    b"\x01\x50\x11\x06\x04\x06\x60\x25\x00\x81\xf2\x63"  # h, no children
+)
+
 
 class VfsRomWriter:
     ROMFS_HEADER = b"\xd2\xcd\x31"
@@ -174,6 +191,7 @@ class TestBase(unittest.TestCase):
                         ("a.py", b"x = 1"),
                         ("b.py", b"x = 2"),
                         ("test.mpy", test_mpy),
+                        ("lazy.mpy", test_nested_mpy),
                     ),
                 ),
             ),
@@ -182,10 +200,10 @@ class TestBase(unittest.TestCase):
         cls.romfs_ilistdir = [
             ("fs.romfs", IFREG, 0, 46),
             ("test.txt", IFREG, 0, 8),
-            ("dir", IFDIR, 0, 198),
+            ("dir", IFDIR, 0, 294),
         ]
         cls.romfs_listdir = [x[0] for x in cls.romfs_ilistdir]
-        cls.romfs_listdir_dir = ["a.py", "b.py", "test.mpy"]
+        cls.romfs_listdir_dir = ["a.py", "b.py", "test.mpy", "lazy.mpy"]
         cls.romfs_listdir_bytes = [bytes(x, "ascii") for x in cls.romfs_listdir]
         cls.romfs_addr = uctypes.addressof(cls.romfs)
         cls.romfs_addr_range = Range(cls.romfs_addr, cls.romfs_addr + len(cls.romfs))
@@ -316,16 +334,16 @@ class TestStandalone(TestBase):
 
     def test_stat(self):
         fs = vfs.VfsRom(self.romfs)
-        self.assertEqual(fs.stat(""), (IFDIR, 0, 0, 0, 0, 0, 289, 0, 0, 0))
-        self.assertEqual(fs.stat("/"), (IFDIR, 0, 0, 0, 0, 0, 289, 0, 0, 0))
+        self.assertEqual(fs.stat(""), (IFDIR, 0, 0, 0, 0, 0, 385, 0, 0, 0))
+        self.assertEqual(fs.stat("/"), (IFDIR, 0, 0, 0, 0, 0, 385, 0, 0, 0))
         self.assertEqual(fs.stat("/test.txt"), (IFREG, 0, 0, 0, 0, 0, 8, 0, 0, 0))
-        self.assertEqual(fs.stat("/dir"), (IFDIR, 0, 0, 0, 0, 0, 198, 0, 0, 0))
+        self.assertEqual(fs.stat("/dir"), (IFDIR, 0, 0, 0, 0, 0, 294, 0, 0, 0))
         with self.assertRaises(OSError):
             fs.stat("/does-not-exist")
 
     def test_statvfs(self):
         fs = vfs.VfsRom(self.romfs)
-        self.assertEqual(fs.statvfs(""), (1, 0, 289, 0, 0, 0, 0, 0, 0, 32767))
+        self.assertEqual(fs.statvfs(""), (1, 0, 385, 0, 0, 0, 0, 0, 0, 32767))
 
     def test_open(self):
         fs = vfs.VfsRom(self.romfs)
@@ -421,10 +439,10 @@ class TestMounted(TestBase):
             os.chdir("/test_rom/dir")
 
     def test_stat(self):
-        self.assertEqual(os.stat("/test_rom"), (IFDIR, 0, 0, 0, 0, 0, 289, 0, 0, 0))
-        self.assertEqual(os.stat("/test_rom/"), (IFDIR, 0, 0, 0, 0, 0, 289, 0, 0, 0))
+        self.assertEqual(os.stat("/test_rom"), (IFDIR, 0, 0, 0, 0, 0, 385, 0, 0, 0))
+        self.assertEqual(os.stat("/test_rom/"), (IFDIR, 0, 0, 0, 0, 0, 385, 0, 0, 0))
         self.assertEqual(os.stat("/test_rom/test.txt"), (IFREG, 0, 0, 0, 0, 0, 8, 0, 0, 0))
-        self.assertEqual(os.stat("/test_rom/dir"), (IFDIR, 0, 0, 0, 0, 0, 198, 0, 0, 0))
+        self.assertEqual(os.stat("/test_rom/dir"), (IFDIR, 0, 0, 0, 0, 0, 294, 0, 0, 0))
         with self.assertRaises(OSError):
             os.stat("/test_rom/does-not-exist")
 
@@ -462,6 +480,12 @@ class TestMounted(TestBase):
         self.assertIn(uctypes.addressof(test.str_obj), self.romfs_addr_range)
         self.assertIn(uctypes.addressof(test.bytes_obj), self.romfs_addr_range)
 
+    def test_import_mpy_nested(self):
+        sys.path.append("/test_rom/dir")
+        lazy = __import__("lazy")
+        self.assertEqual(lazy.f(1)()(), 2)
+        self.assertEqual(lazy.f(2)()(), 3)
+
     def test_romfs_inner(self):
         with open("/test_rom/fs.romfs", "rb") as f:
             romfs_inner = vfs.VfsRom(memoryview(f))
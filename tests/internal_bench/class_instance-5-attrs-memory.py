@@ -0,0 +1,30 @@
+# Create instances that have the same members, then report the heap memory
+# used by each of them.
+import bench
+import gc
+
+N = 1000
+
+
+class X:
+    def __init__(self, i):
+        self.a = i
+        self.b = i
+        self.c = i
+        self.d = i
+
+
+def test(num):
+    for i in range(num // (5 * N)):
+        objs = [X(j) for j in range(N)]
+
+
+bench.run(test)
+
+objs = [None] * N
+gc.collect()
+m = gc.mem_alloc()
+for i in range(N):
+    objs[i] = X(i)
+gc.collect()
+print("bytes per instance:", (gc.mem_alloc() - m) // N)
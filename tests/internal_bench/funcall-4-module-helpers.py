@@ -0,0 +1,32 @@
+import bench
+
+
+def f1(x):
+    return x
+
+
+def f2(x):
+    return x
+
+
+def f3(x):
+    return x
+
+
+def f4(x):
+    return x
+
+
+def test(num):
+    for i in range(num // 8):
+        f1(i)
+        f2(i)
+        f3(i)
+        f4(i)
+        abs(i)
+        len("")
+        f1(i)
+        min(i, 1)
+
+
+bench.run(test)
@@ -0,0 +1,23 @@
+# Look up names of attributes when many qstrs have been created at runtime.
+import bench
+
+N = 2000
+
+
+class X:
+    pass
+
+
+x = X()
+names = ["attr_%d" % i for i in range(N)]
+for n in names:
+    setattr(x, n, 1)
+
+
+def test(num):
+    for i in range(num // N):
+        for n in names:
+            getattr(x, n)
+
+
+bench.run(test)
@@ -0,0 +1,38 @@
+# test calls to builtins within const
+
+from micropython import const
+
+# skip if the target has MICROPY_COMP_CONST_BUILTINS disabled
+try:
+    exec("A = const(len('abc'))")
+except SyntaxError:
+    print("SKIP")
+    raise SystemExit
+
+_S = const("abcdef")
+_N = const(len(_S) * 2)
+_M = const(max(3, 7) + min(-1, 4))
+_C = const(chr(ord("A") + 1) + "c")
+_A = const(abs(-5) << 2)
+print(_N, _M, _C, _A)
+
+# builtins called outside const are not folded
+import builtins
+
+builtins.abs = lambda x: x + 1
+print(abs(1))
+print((const, abs(1))[1])
+
+
+def test_syntax(code):
+    try:
+        exec(code)
+    except SyntaxError:
+        print("SyntaxError")
+
+
+# arguments must be constants, and the call must succeed
+test_syntax("a = const(len(x))")
+test_syntax("a = const(len(1))")
+test_syntax("a = const(chr(-1))")
+test_syntax("a = const(len('a', 'b'))")
@@ -0,0 +1,165 @@
+# test sequences of opcodes that the compiler may fuse into a single opcode
+
+
+# two locals loaded one after the other, including unbound ones
+def load_two(a, b):
+    c = a + b
+    if a:
+        d = 1
+    return c, a * b - c, b - a, d + c
+
+
+print(load_two(2, 3))
+try:
+    load_two(0, 1)
+except NameError:
+    print("NameError")
+
+
+def load_two_unbound_first():
+    x = y + 1
+    y = 2
+
+
+try:
+    load_two_unbound_first()
+except NameError:
+    print("NameError")
+
+
+# attributes of the first local
+class A:
+    def __init__(self, x):
+        self.x = x
+        self.y = x + 1
+
+    def get(self):
+        return self.x + self.y
+
+    def set(self, v):
+        self.x = v
+        self.x += 1
+        return self.x
+
+
+a = A(1)
+print(a.get(), a.set(5), a.x, a.y)
+try:
+    a.z
+except AttributeError:
+    print("AttributeError")
+
+
+def attr_of_arg(o):
+    o.y = o.x
+    return o.x, o.y
+
+
+print(attr_of_arg(a))
+print(attr_of_arg(A(7)))
+
+
+# binary ops with a small int on the right, including ones that overflow a
+# small int or don't apply to small ints
+def binop(x):
+    return x + 1, x - 16, x * 47, x // 3, x % 7, x << 2, x >> 1, x & 15, x | 16, x ^ 5
+
+
+print(binop(10))
+print(binop(-10))
+print(binop(True))
+s = "ab"
+print(s * 3)
+x = 10
+x += 1
+x -= 2
+print(x)
+try:
+    "a" + 1
+except TypeError:
+    print("TypeError")
+
+
+# compare and jump, with small ints and other types
+def cmp(a, b):
+    r = []
+    if a < b:
+        r.append("<")
+    if a <= b:
+        r.append("<=")
+    if a > b:
+        r.append(">")
+    if a >= b:
+        r.append(">=")
+    if a == b:
+        r.append("==")
+    if a != b:
+        r.append("!=")
+    if not a < b:
+        r.append("!<")
+    if not a == b:
+        r.append("!==")
+    return r
+
+
+for a, b in ((1, 2), (2, 1), (3, 3), (-5, 5), (1, True), (True, 0), ("a", "b"), ((1, 2), (1, 3))):
+    print(a, b, cmp(a, b))
+
+
+class C:
+    def __lt__(self, other):
+        return 0
+
+    def __eq__(self, other):
+        return []
+
+
+def cmp_user(a, b):
+    r = []
+    if a < b:
+        r.append("<")
+    if not a < b:
+        r.append("!<")
+    if a == b:
+        r.append("==")
+    if not a == b:
+        r.append("!==")
+    return r
+
+
+print(cmp_user(C(), C()))
+
+
+def cmp_other(a, b):
+    r = []
+    if a in b:
+        r.append("in")
+    if a not in b:
+        r.append("not in")
+    if a is b:
+        r.append("is")
+    if a is not b:
+        r.append("is not")
+    return r
+
+
+print(cmp_other(1, [1, 2]))
+print(cmp_other(3, (1, 2)))
+l = [1]
+print(cmp_other(l, l))
+try:
+    cmp(1, "a")
+except TypeError:
+    print("TypeError")
+
+
+# loops, which compare and jump at the end
+n = 0
+i = 0
+while i < 10:
+    n += i
+    i += 1
+print(n)
+while i > 0 and i != 5:
+    i -= 1
+print(i)
@@ -0,0 +1,30 @@
+# test fused opcodes with small ints that overflow, and with big ints
+
+
+# binary ops with a small int on the right
+def binop(x):
+    return x + 1, x - 16, x * 47, x // 3, x % 7, x << 2, x >> 1, x & 15, x | 16, x ^ 5
+
+
+print(binop(0x3FFFFFFF))
+print(binop(0x7FFFFFFFFFFFFFFF))
+print(binop(-0x4000000000000000))
+x = 0x3FFFFFFF
+x += 1
+x -= 2
+print(x)
+
+
+# compare and jump
+def cmp(a, b):
+    r = []
+    if a < b:
+        r.append("<")
+    if not a == b:
+        r.append("!==")
+    return r
+
+
+print(cmp(0x7FFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFE))
+print(cmp(0x7FFFFFFFFFFFFFFE, 0x7FFFFFFFFFFFFFFF))
+print(cmp(1 << 70, 1 << 70))
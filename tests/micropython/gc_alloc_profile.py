@@ -0,0 +1,67 @@
+# test gc.alloc_profile()
+
+try:
+    import gc
+
+    gc.alloc_profile
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def alloc():
+    for i in range(5):
+        bytearray(2000)
+
+
+def fail():
+    bytearray(2000)
+    raise ValueError
+
+
+def gen():
+    yield bytearray(2000)
+    yield bytearray(2000)
+
+
+def work():
+    alloc()
+    try:
+        fail()
+    except ValueError:
+        pass
+    for x in gen():
+        pass
+    bytearray(2000)
+
+
+# print the (function, line) of each frame of the stacks that allocated the big
+# buffers, ignoring any smaller allocations which depend on the configuration
+def show(prof):
+    for stack, count, nbytes in sorted(prof):
+        if nbytes >= 2000:
+            print([frame[1:] for frame in stack], count)
+
+
+# sample every allocation
+gc.alloc_profile(1)
+work()
+prof = gc.alloc_profile()
+gc.alloc_profile(0)
+show(prof)
+
+# a new period clears the profile, and nothing is sampled while disabled
+work()
+print(gc.alloc_profile())
+
+# sample every other allocation
+gc.alloc_profile(2)
+alloc()
+prof = gc.alloc_profile()
+gc.alloc_profile(0)
+show(prof)
+
+try:
+    gc.alloc_profile(-1)
+except ValueError:
+    print("ValueError")
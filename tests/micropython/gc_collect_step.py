@@ -0,0 +1,96 @@
+# Test incremental garbage collection with gc.collect_step().
+
+try:
+    import gc
+
+    gc.collect_step
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    import weakref
+except ImportError:
+    weakref = None
+
+
+def make_garbage(n):
+    for i in range(n):
+        bytearray(100)
+
+
+def run_to_completion(budget_us):
+    steps = 1
+    while not gc.collect_step(budget_us):
+        steps += 1
+    return steps
+
+
+# Finish any collection in progress, then start from a clean state.
+gc.collect()
+make_garbage(50)
+
+# A zero budget does the mark phase but can't finish the sweep.
+print(gc.collect_step(0))
+print(run_to_completion(0) > 0)
+
+# Objects allocated while a sweep is pending must survive it.
+make_garbage(50)
+gc.collect_step(0)
+keep = [bytearray(i) for i in range(1, 300, 7)]
+run_to_completion(0)
+gc.collect()
+print(all(len(b) == i for b, i in zip(keep, range(1, 300, 7))))
+
+# Growing a list in place while the sweep is pending must not lose its tail.
+lst = []
+gc.collect_step(0)
+for i in range(1000):
+    lst.append(i)
+run_to_completion(0)
+gc.collect()
+print(sum(lst))
+
+# A full collection completes a pending sweep.
+make_garbage(20)
+gc.collect_step(0)
+gc.collect()
+print(gc.collect_step(1000000))
+
+# Memory freed by an incremental collection can be reused.
+gc.collect()
+free0 = gc.mem_free()
+x = bytearray(10000)
+x = None
+gc.collect_step(0)
+run_to_completion(100)
+print(gc.mem_free() >= free0 - 1000)
+x = bytearray(10000)
+print(len(x))
+x = None
+
+# Weak references to unreachable objects are cleared by the mark phase, and
+# their callbacks run before collect_step() returns.
+if weakref:
+
+    class A:
+        pass
+
+    count = 0
+
+    def callback():
+        global count
+        count += 1
+
+    def make_refs(n):
+        for i in range(n):
+            weakref.finalize(A(), callback)
+
+    gc.collect()
+    make_refs(10)
+    clean_the_stack = [0, 0, 0, 0]
+    gc.collect_step(0)
+    print(count)
+    run_to_completion(0)
+else:
+    print(10)
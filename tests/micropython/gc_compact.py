@@ -0,0 +1,95 @@
+# Test that gc.compact() keeps the contents of objects whose data it moves.
+
+try:
+    import gc
+
+    gc.compact
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+try:
+    import array
+except ImportError:
+    array = None
+
+
+class A:
+    pass
+
+
+def make(n):
+    # Interleave the objects under test with garbage, so there are holes
+    # below them once the garbage is collected.
+    objs = []
+    junk = []
+    for i in range(n):
+        junk.append([0] * 16)
+        lst = list(range(i, i + 10))
+        junk.append([0] * 16)
+        dct = {j: i for j in range(8)}
+        junk.append([0] * 16)
+        ba = bytearray(b"%03d" % i * 10)
+        junk.append([0] * 16)
+        arr = array.array("i", range(i, i + 10)) if array else None
+        junk.append([0] * 16)
+        s = "str%03d" % i * 10
+        b = b"bytes%03d" % i * 10
+        junk.append([0] * 16)
+        a = A()
+        for j in range(8):
+            setattr(a, "x%d" % j, i + j)
+        objs.append((lst, dct, ba, arr, s, b, a))
+    return objs
+
+
+def check(objs):
+    for i, (lst, dct, ba, arr, s, b, a) in enumerate(objs):
+        if (
+            lst[:10] != list(range(i, i + 10))
+            or any(dct[j] != i for j in range(8))
+            or ba[:30] != b"%03d" % i * 10
+            or arr is not None
+            and list(arr) != list(range(i, i + 10))
+            or s != "str%03d" % i * 10
+            or b != b"bytes%03d" % i * 10
+            or any(getattr(a, "x%d" % j) != i + j for j in range(8))
+        ):
+            return False
+    return True
+
+
+objs = make(50)
+gc.collect()
+print(type(gc.compact()))
+print(check(objs))
+
+# Objects still work normally after being moved.
+for lst, dct, ba, arr, s, b, a in objs:
+    lst.append(-1)
+    dct["new"] = -1
+    ba.extend(b"!")
+    a.y = -1
+print(all(o[0][-1] == -1 and o[1]["new"] == -1 and o[2][-1] == 33 and o[6].y == -1 for o in objs))
+
+# Compacting again keeps everything intact.
+gc.compact()
+print(check(objs))
+
+
+# Nothing is moved while the heap is locked.  This is done in a function so
+# that storing the result doesn't need to grow the globals dict.
+def compact_locked():
+    micropython.heap_lock()
+    moved = gc.compact()
+    micropython.heap_unlock()
+    return moved
+
+
+try:
+    import micropython
+
+    print(compact_locked())
+except AttributeError:
+    print(0)
+
@@ -0,0 +1,49 @@
+# Test running finalisers in batches from the scheduler with gc.finaliser_batch().
+
+try:
+    import gc
+
+    gc.finaliser_batch
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+N = 20
+
+
+def make_garbage():
+    # Open files have a finaliser that closes them.
+    for i in range(N):
+        open(__file__)
+
+
+def drain():
+    # Pending scheduled callbacks run while bytecode executes.
+    while gc.finaliser_stats()[0]:
+        pass
+
+
+print(gc.finaliser_batch())
+print(gc.finaliser_stats()[0])
+
+# Finalisers are queued by the collection and run afterwards.
+gc.finaliser_batch(4)
+print(gc.finaliser_batch())
+make_garbage()
+run = gc.finaliser_stats()[1]
+gc.collect()
+pending = gc.finaliser_stats()[0]
+print(pending > N // 2)
+drain()
+print(gc.finaliser_stats()[1] - run >= pending)
+
+# With batching turned off, finalisers run during the collection.
+gc.finaliser_batch(0)
+make_garbage()
+gc.collect()
+print(gc.finaliser_stats()[0])
+
+try:
+    gc.finaliser_batch(-1)
+except ValueError:
+    print("ValueError")
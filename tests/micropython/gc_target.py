@@ -0,0 +1,49 @@
+# Test gc.target() and gc.stats().
+
+try:
+    import gc
+
+    gc.target
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+keys = ("collections", "pause_us", "max_pause_us", "total_pause_us", "survival_pct", "alloc_rate", "threshold")
+print(sorted(gc.stats()) == sorted(keys))
+
+gc.threshold(-1)
+print(gc.target())
+
+# Setting a target turns on the threshold.
+gc.target(pause_ms=2, overhead_pct=5)
+print(gc.target())
+print(gc.stats()["threshold"] > 0)
+
+# Collections retune the threshold, within the size of the heap.
+heap = gc.mem_free() + gc.mem_alloc()
+n = gc.stats()["collections"]
+for i in range(20000):
+    [i, i, i]
+gc.collect()
+s = gc.stats()
+print(s["collections"] > n)
+print(heap // 64 - 64 <= s["threshold"] <= heap)
+print(0 <= s["survival_pct"] <= 100)
+print(s["pause_us"] <= s["max_pause_us"] <= s["total_pause_us"])
+
+# Positional arguments, and only one target.
+gc.target(1)
+print(gc.target())
+gc.target(0, 10)
+print(gc.target())
+
+# An explicit threshold turns off the targets.
+gc.threshold(100000)
+print(gc.target())
+gc.threshold(-1)
+
+for args in ((-1,), (0, 100), (0, -1)):
+    try:
+        gc.target(*args)
+    except ValueError:
+        print("ValueError")
@@ -0,0 +1,167 @@
+# test that name lookups with per-instruction caches see changes to the
+# globals, builtins, instances, classes and modules they look in
+
+try:
+    property
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+def get_x():
+    return x
+
+
+# Global added, changed, deleted, and shadowing a builtin.
+x = 1
+print(get_x())
+x = 2
+print(get_x())
+del x
+try:
+    get_x()
+except NameError:
+    print("NameError")
+
+
+def get_len():
+    return len
+
+
+print(get_len() is len)
+len = 1
+print(get_len())
+del len
+print(get_len()([1, 2]))
+
+# Many globals, so the table of globals is rehashed while caches are in use.
+for i in range(40):
+    x = get_x() if i else 0
+    globals()["g%d" % i] = i
+    x = i
+    print(i, get_x()) if i % 10 == 0 else None
+
+
+# Instance members of instances with different layouts.
+class A:
+    def __init__(self, first):
+        if first:
+            self.a = 1
+            self.b = 2
+        else:
+            self.b = 3
+            self.c = 4
+            self.a = 5
+
+    def f(self):
+        return "A.f"
+
+
+def get_a(o):
+    return o.a
+
+
+for o in (A(True), A(False), A(True)):
+    print(get_a(o))
+
+
+# Methods, methods shadowed by members, and methods replaced on the class.
+def call_f(o):
+    return o.f()
+
+
+a = A(True)
+print(call_f(a))
+a.f = lambda: "member"
+print(call_f(a))
+del a.f
+print(call_f(a))
+A.f = lambda self: "new A.f"
+print(call_f(a))
+
+
+class B(A):
+    def f(self):
+        return "B.f"
+
+
+print(call_f(B(True)), call_f(a))
+
+
+# Static and class methods, and properties.
+class C:
+    @staticmethod
+    def f():
+        return "static"
+
+    @classmethod
+    def g(cls):
+        return cls.__name__
+
+    @property
+    def h(self):
+        return "property"
+
+
+def call_fg(o):
+    return o.f(), o.g()
+
+
+def get_h(o):
+    return o.h
+
+
+print(call_fg(C()), get_h(C()))
+
+
+class D(C):
+    pass
+
+
+print(call_fg(D()), call_fg(D))
+
+
+# Methods of built-in types.
+def call_append(o, v):
+    o.append(v)
+    return o
+
+
+print(call_append([], 1), call_append(bytearray(), 2))
+
+
+# Module attributes.
+import sys
+
+
+def get_mod_attr():
+    return sys.maxsize > 0, sys.argv is sys.argv
+
+
+print(get_mod_attr(), get_mod_attr())
+
+
+# Methods added to and removed from a class, seen by a cache that found the
+# method in a base class and then in the class itself.
+class E(A):
+    pass
+
+
+e = E(True)
+print(call_f(e))
+E.f = lambda self: "E.f"
+print(call_f(e))
+del E.f
+print(call_f(e))
+
+
+# The functions made each time a comprehension runs share their caches, and
+# see instances of different classes.
+class F:
+    def __init__(self):
+        self.z = 1
+        self.a = "F.a"
+
+
+for cls in (A, F, A):
+    print([o.a for o in (cls(True) if cls is A else cls(),)])
@@ -0,0 +1,99 @@
+# Test members of instances, when their names are shared by the instances of
+# a class (MICROPY_OPT_INSTANCE_SHARED_KEYS).
+
+
+class A:
+    def __init__(self, a, b):
+        self.a = a
+        self.b = b
+
+
+if not hasattr(A(1, 2), "__dict__") or not hasattr(object, "__setattr__"):
+    print("SKIP")
+    raise SystemExit
+
+
+def show(o):
+    print(sorted(o.__dict__.items()))
+
+
+# Instances with the same members, in the same or in another order.
+x = A(1, 2)
+y = A(3, 4)
+y.c = 5
+z = A(6, 7)
+z.d = 8
+z.c = 9
+for o in (x, y, z):
+    show(o)
+print(x.a, y.c, z.c, z.d)
+print(hasattr(x, "c"), hasattr(x, "d"), hasattr(y, "d"))
+
+# Overwriting and deleting members.
+y.a = 10
+del y.b
+show(y)
+try:
+    y.b
+except AttributeError:
+    print("AttributeError")
+try:
+    del y.b
+except AttributeError:
+    print("AttributeError")
+y.b = 11
+show(y)
+
+# A member shadows a method only in its own instance.
+class B:
+    def f(self):
+        return "method"
+
+
+b1 = B()
+b2 = B()
+b1.f = lambda: "member"
+for _ in range(2):
+    print(b1.f(), b2.f())
+del b1.f
+print(b1.f())
+
+# Many different member names on instances of the same class.
+class C:
+    pass
+
+
+objs = []
+for i in range(40):
+    o = C()
+    setattr(o, "m%d" % i, i)
+    o.common = -i
+    objs.append(o)
+print(sum(getattr(o, "m%d" % i) for i, o in enumerate(objs)), sum(o.common for o in objs))
+print(objs[0].__dict__ == {"m0": 0, "common": 0}, objs[39].__dict__ == {"m39": 39, "common": -39})
+
+# Members that are set and deleted through object.__setattr__ and __delattr__,
+# including with names that aren't interned.
+name = "".join(["un", "interned"])
+o = C()
+object.__setattr__(o, name, 1)
+print(getattr(o, name), o.__dict__)
+object.__delattr__(o, name)
+print(o.__dict__)
+o2 = C()
+o2.common = 1
+object.__setattr__(o2, "common", 2)
+print(o2.common)
+object.__delattr__(o2, "".join(["com", "mon"]))
+print(o2.__dict__)
+
+# Subclasses have their own member names.
+class D(A):
+    def __init__(self):
+        super().__init__(1, 2)
+        self.e = 3
+
+
+d = D()
+show(d)
+show(A(4, 5))
@@ -0,0 +1,79 @@
+# Test that lookups of globals and builtins see every change to the globals,
+# when they are memoised using map versions (MICROPY_OPT_MAP_VERSION).
+
+
+def get_len():
+    return len
+
+
+def get_x():
+    return x
+
+
+def call_len():
+    return len("abc")
+
+
+# Builtin, then shadowed by a global, then the global removed again.
+for _ in range(2):
+    print(call_len(), get_len() is len)
+len = lambda s: -1
+print(call_len())
+del len
+print(call_len())
+
+# Global that comes and goes.
+try:
+    get_x()
+except NameError:
+    print("NameError")
+x = 1
+print(get_x())
+x = 2
+print(get_x())
+globals()["x"] = 3
+print(get_x())
+del globals()["x"]
+try:
+    get_x()
+except NameError:
+    print("NameError")
+
+# Many other globals added, so the globals dict is resized.
+x = 4
+print(get_x())
+for i in range(50):
+    globals()["y" + str(i)] = i
+print(get_x(), y0, y49)
+for i in range(50):
+    del globals()["y" + str(i)]
+print(get_x())
+
+# Globals dicts popped and cleared.
+g = {"x": 5}
+code = "def f():\n    return x\n"
+exec(code, g)
+print(g["f"](), g["f"]())
+g.popitem()
+g.popitem()
+g["x"] = 6
+exec(code, g)
+print(g["f"]())
+f = g["f"]
+g.clear()
+g["x"] = 7
+print(f())
+
+# The same names in different globals dicts.
+g1 = {"x": "g1"}
+g2 = {"x": "g2", "len": "g2 len"}
+exec(code, g1)
+exec(code, g2)
+for _ in range(2):
+    print(g1["f"](), g2["f"](), get_x())
+    print(eval("len", g1) is len, eval("len", g2))
+
+# Module-level code, looked up by name.
+for v in (1, 2):
+    x = v
+    print(x)
@@ -0,0 +1,101 @@
+# test automatic promotion of hot functions to native code
+
+import micropython
+
+try:
+    micropython.native_tier
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def add(a, b=10, *, c=100):
+    return a + b + c
+
+
+def loop(n):
+    s = 0
+    for i in range(n):
+        s += i
+    return s
+
+
+class A:
+    def __init__(self, x):
+        self.x = x
+
+    def get(self, y):
+        return self.x + y
+
+
+def make_adder(k):
+    def f(x):
+        return x + k
+
+    return f
+
+
+def gen(n):
+    for i in range(n):
+        yield i
+
+
+# nothing is promoted while the threshold is zero
+micropython.native_tier(0)
+for i in range(20):
+    add(i)
+print(micropython.native_tier())
+
+micropython.native_tier(10, 1 << 20)
+
+# functions keep their identity and default arguments once promoted
+add_ref = add
+for i in range(20):
+    r = add(i)
+print(r, add(1, 2), add(1, c=3), add is add_ref)
+
+# a single call with a long-running loop is promoted on its next call
+print(loop(100), loop(100))
+
+# methods, and closures, which each have their own captured variable
+a = A(5)
+for i in range(20):
+    r = a.get(i)
+print(r)
+adders = [make_adder(k) for k in range(20)]
+print([f(1) for f in adders])
+
+# generators stay as bytecode
+for i in range(20):
+    r = list(gen(3))
+print(r)
+
+# exceptions propagate out of promoted functions
+for i in range(20):
+    try:
+        add(None)
+    except TypeError:
+        r = "TypeError"
+print(r)
+
+# functions without a source file stay as bytecode
+exec("def no_source(x):\n    return x * 2")
+for i in range(20):
+    r = no_source(i)
+print(r)
+
+names = sorted(t[0] for t in micropython.native_tier())
+print(names)
+print(all(t[3] > 0 for t in micropython.native_tier()))
+
+# nothing more is promoted once the budget is used up
+micropython.native_tier(10, 0)
+
+
+def late(x):
+    return -x
+
+
+for i in range(20):
+    r = late(i)
+print(r, len(micropython.native_tier()) == len(names))
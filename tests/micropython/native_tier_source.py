@@ -0,0 +1,69 @@
+# test that a function isn't promoted to native code if its source has changed
+
+try:
+    import io, sys, vfs, micropython
+
+    io.IOBase
+    micropython.native_tier
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(io.IOBase):
+    def __init__(self, data):
+        self.data = memoryview(data)
+        self.pos = 0
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data) - self.pos)
+        buf[:n] = self.data[self.pos : self.pos + n]
+        self.pos += n
+        return n
+
+    def ioctl(self, req, arg):
+        if req == 4:  # MP_STREAM_CLOSE
+            return 0
+        return -1
+
+
+class UserFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (32768, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError
+
+    def open(self, path, mode):
+        return UserFile(self.files[path])
+
+
+user_files = {
+    "/tier_same.py": b"def f(x):\n    return x + 1\n",
+    "/tier_changed.py": b"def f(x):\n    return x + 1\n",
+}
+vfs.mount(UserFS(user_files), "/userfs")
+sys.path.append("/userfs")
+
+import tier_same, tier_changed
+
+# The source of one module changes after it was imported.
+user_files["/tier_changed.py"] = b"def f(x):\n    return x + 2\n"
+
+micropython.native_tier(10, 1 << 20)
+for i in range(20):
+    r1 = tier_same.f(i)
+    r2 = tier_changed.f(i)
+print(r1, r2)
+print([t[1] for t in micropython.native_tier() if t[1].startswith("/userfs")])
+
+vfs.umount("/userfs")
+sys.path.pop()
@@ -0,0 +1,28 @@
+# test interning of many qstrs at runtime, and that hashes of qstrs computed
+# when building the firmware match those computed at runtime
+
+import builtins
+
+# hash of a bytes object is always computed at runtime, and is the same as
+# the hash of a str with the same data
+print(all(hash(n) == hash(bytes(n, "utf8")) for n in dir(builtins)))
+print(all(hash(n) == hash(bytes(n, "utf8")) for n in dir(str)))
+
+
+class A:
+    pass
+
+
+# create lots of new qstrs by using them as attribute names
+N = 1000
+a = A()
+for i in range(N):
+    setattr(a, "attr_%d" % i, i)
+print(all(getattr(a, "attr_%d" % i) == i for i in range(N)))
+print(all(hash("attr_%d" % i) == hash(b"attr_%d" % i) for i in range(N)))
+
+# qstrs created at runtime are found again
+names = sorted(n for n in dir(a) if n.startswith("attr_"))
+print(len(names), names[:3])
+print(all(n in dir(a) for n in ("attr_0", "attr_999")))
+print(hasattr(a, "attr_1000"))
@@ -0,0 +1,116 @@
+# test opcodes that the VM may specialise for the types it sees, when the types
+# then change, or the specialised case doesn't apply
+
+
+# arithmetic and compare, first run with small ints then with other types
+def arith(a, b):
+    c = a + b
+    d = a - b
+    c += b
+    d -= b
+    return c, d, a < b, a > b, a == b, a <= b, a >= b, a != b
+
+
+for _ in range(3):
+    print(arith(5, 3))
+print(arith(-5, 3))
+print(arith(True, 2))
+print(arith(1, True))
+for _ in range(3):
+    print(arith(7, 7))
+try:
+    arith(1, "a")
+except TypeError:
+    print("TypeError")
+
+
+def add_cmp(a, b):
+    return a + b, a < b
+
+
+for _ in range(3):
+    print(add_cmp(1, 2))
+print(add_cmp("a", "b"))
+print(add_cmp([1], [2]))
+print(add_cmp(1, 2))
+
+
+# list indexed by small int
+def load(l, i):
+    return l[i]
+
+
+def store(l, i, v):
+    l[i] = v
+
+
+l = [1, 2, 3]
+for i in range(-3, 3):
+    print(load(l, i))
+for i in range(-3, 3):
+    store(l, i, i * 10)
+print(l)
+for i in (3, -4):
+    try:
+        load(l, i)
+    except IndexError:
+        print("IndexError")
+    try:
+        store(l, i, 0)
+    except IndexError:
+        print("IndexError")
+print(load((4, 5), 1))
+print(load("abc", 1))
+print(load(l, 1))
+print(load(l, True))
+b = {}
+store(b, 1, 7)
+store(l, 0, 8)
+print(b, l)
+
+
+class L(list):
+    def __getitem__(self, i):
+        return "L"
+
+
+print(load(L([1]), 0))
+print(load(l, 0))
+
+
+# dict indexed by str
+def dload(d, k):
+    return d[k]
+
+
+d = {"a": 1, "b": 2}
+print(dload(d, "a"), dload(d, "b"))
+try:
+    dload(d, "c")
+except KeyError:
+    print("KeyError")
+print(dload({1: "x"}, 1))
+print(dload(d, "a"))
+print(dload(l, 1))
+print(dload(d, "b"))
+
+
+class D(dict):
+    def __getitem__(self, k):
+        return "D"
+
+
+print(dload(D(), "a"))
+print(dload(d, "b"))
+
+
+# generators, which resume at quickened opcodes
+def gen(n):
+    i = 0
+    while i < n:
+        yield l[i % 3] + i
+        i += 1
+
+
+print(list(gen(5)))
+print(list(gen(5)))
@@ -0,0 +1,31 @@
+# test opcodes that the VM may specialise for small ints, when the result
+# overflows a small int or the operands are big ints
+
+
+def arith(a, b):
+    c = a + b
+    d = a - b
+    c += b
+    d -= b
+    return c, d, a < b, a > b, a == b, a <= b, a >= b, a != b
+
+
+for _ in range(3):
+    print(arith(5, 3))
+print(arith(0x3FFFFFFF, 0x3FFFFFFF))
+print(arith(-0x3FFFFFFF, 0x3FFFFFFF))
+print(arith(0x7FFFFFFFFFFFFFFF, 1))
+print(arith(1 << 70, 1))
+for _ in range(3):
+    print(arith(7, 7))
+
+
+# overflow of a small int in a loop
+x = 1
+for _ in range(70):
+    x = x + x
+print(x)
+x = -1
+for _ in range(70):
+    x = x + x
+print(x)
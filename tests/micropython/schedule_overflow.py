@@ -0,0 +1,58 @@
+# test micropython.schedule_overflow()
+
+try:
+    import micropython
+
+    micropython.schedule_overflow
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+print(micropython.schedule_overflow())
+
+try:
+    micropython.schedule_overflow(-1)
+except ValueError:
+    print("ValueError")
+
+# Schedule as many callbacks as possible, from within a callback so that the
+# scheduler is locked and none of them run yet.
+
+
+def task(i):
+    order.append(i)
+
+
+def fill(arg):
+    global n
+    n = 0
+    try:
+        for i in range(100):
+            micropython.schedule(task, i)
+            n += 1
+    except RuntimeError:
+        pass
+
+
+def run(overflow):
+    global order
+    order = []
+    micropython.schedule_overflow(overflow)
+    micropython.schedule(fill, None)
+    while len(order) < n:
+        pass
+    micropython.schedule_overflow(0)
+    return n, order == list(range(n))
+
+
+# Without overflow the queue takes a fixed number of callbacks.
+depth, ok = run(0)
+print(depth > 0, ok)
+
+# With overflow some more callbacks are taken, and run in order.
+n, ok = run(20)
+print(n - depth, ok)
+
+# Overflow of all the remaining callbacks.
+n, ok = run(1000)
+print(n, ok)
@@ -0,0 +1,59 @@
+# test micropython.schedule_stats()
+
+try:
+    import micropython
+
+    micropython.schedule_stats
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+# Reset the statistics.
+micropython.schedule_stats(True)
+hard, soft, latency = micropython.schedule_stats()
+print(hard, soft, sum(latency))
+
+# Schedule callbacks until the queue is full, from within a callback so that
+# the scheduler is locked and none of them run yet.
+done = 0
+
+
+def task(arg):
+    global done
+    done += 1
+
+
+def fill(arg):
+    global n
+    n = 0
+    try:
+        for i in range(100):
+            micropython.schedule(task, None)
+            n += 1
+    except RuntimeError:
+        pass
+
+
+micropython.schedule(fill, None)
+while done < n:
+    pass
+
+hard, soft, latency = micropython.schedule_stats()
+print(hard)
+print(soft == (n + 1, 0, 1))
+print(sum(latency) == n + 1)
+
+# Callbacks that overflow to the heap are counted as deferred.
+try:
+    micropython.schedule_overflow
+except AttributeError:
+    print(True)
+else:
+    micropython.schedule_stats(True)
+    micropython.schedule_overflow(2)
+    done = 0
+    micropython.schedule(fill, None)
+    while done < n:
+        pass
+    micropython.schedule_overflow(0)
+    print(micropython.schedule_stats()[1] == (n + 1, 2, 1))
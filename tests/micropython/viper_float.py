@@ -0,0 +1,132 @@
+# test viper float type, where float values are kept unboxed
+
+import micropython
+
+try:
+    float
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+# taking and returning a float
+@micropython.viper
+def add(a: float, b: float) -> float:
+    return a + b
+
+
+print(add(1.5, 2.25), add(1, True))
+try:
+    add("a", 1)
+except TypeError:
+    print("TypeError")
+
+
+# arithmetic with float, int and object arguments
+@micropython.viper
+def arith(a: float, b: float, n: int, o):
+    return a - b, a * b, a / b, a // b, a % b, a**b, a + n, n - a, a * o, o / a
+
+
+print(arith(7.5, 2.0, 3, 15))
+print(arith(-7.5, 2.0, -1, -3.75))
+try:
+    arith(1.0, 0.0, 0, 0)
+except ZeroDivisionError:
+    print("ZeroDivisionError")
+
+
+# comparisons give a bool
+@micropython.viper
+def comp(a: float, b: float):
+    return a < b, a > b, a == b, a <= b, a >= b, a != b, a < 2, 1.5 > a
+
+
+print(comp(1.0, 2.0))
+print(comp(2.0, 2.0))
+print(comp(1.5, 1.0))
+
+
+# unary ops and inplace ops
+@micropython.viper
+def unary(a: float):
+    b = a
+    b += 1
+    b *= 2.5
+    b -= a
+    b /= 2
+    return -a, +a, b
+
+
+print(unary(3.0), unary(0.0), unary(-0.0))
+
+
+# casts to and from float
+@micropython.viper
+def cast(a: float, n: int, o):
+    return float(n), float(o), float(a), int(a), uint(a), bool(a), bool(float(0))
+
+
+print(cast(2.75, -3, 1.5))
+print(cast(-2.75, 0, 1)[:4])
+
+
+# float locals, in a loop
+@micropython.viper
+def mandel(cr: float, ci: float) -> int:
+    zr = float(0)
+    zi = float(0)
+    i = 0
+    while i < 32:
+        t = zr * zr - zi * zi + cr
+        zi = 2 * zr * zi + ci
+        zr = t
+        if zr * zr + zi * zi > 100.0:
+            return i
+        i += 1
+    return 0
+
+
+print([mandel(x / 4, 0.5) for x in range(-8, 3)])
+
+
+# floats are boxed when they're passed to Python code
+@micropython.viper
+def boxed(a: float):
+    l = [a, a * 2]
+    l.append(a / 4)
+    return l
+
+
+print(boxed(1.0))
+
+# the arithmetic doesn't allocate when the float fits in a machine word
+n = None
+try:
+    micropython.heap_lock()
+    try:
+        n = mandel(-0.5, 0.5)
+    except MemoryError:
+        pass
+    micropython.heap_unlock()
+except AttributeError:
+    pass
+if n is None:
+    n = mandel(-0.5, 0.5)
+print(n)
+
+
+# viper type errors
+def test(code):
+    try:
+        exec(code)
+    except ViperTypeError as e:
+        print(type(e), e)
+
+
+test("@micropython.viper\ndef f(a: float): a << 1")
+test("@micropython.viper\ndef f(a: float): ~a")
+test("@micropython.viper\ndef f(a: float):\n    if a:\n        pass")
+test("@micropython.viper\ndef f(a: float): ptr8(a)")
+test("@micropython.viper\ndef f(a: float, b: uint): a + b")
+test("@micropython.viper\ndef f(a: float) -> int:\n    return a")
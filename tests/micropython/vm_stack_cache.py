@@ -0,0 +1,77 @@
+# test sequences of opcodes that the VM may run with the top of the stack
+# cached, including ones that raise in the middle of an expression
+
+
+def f(a, b, c):
+    x = a + b * c - 1
+    y = [a, b, c][1] + (a < b) + (b >= c)
+    for i in range(3):
+        x += i
+        if i - 1:
+            y -= i
+    return x, y
+
+
+print(f(1, 2, 3))
+print(f(True, 1, 0))
+
+
+def raise_mid(l, i):
+    try:
+        return 1 + l[i] - 2
+    except IndexError:
+        return "IndexError"
+    except TypeError:
+        return "TypeError"
+
+
+print(raise_mid([1, 2], 1), raise_mid([1, 2], 2), raise_mid([None], 0), raise_mid(None, 0))
+
+
+def unbound(n):
+    if n:
+        x = 1
+    return n + x
+
+
+print(unbound(1))
+try:
+    unbound(0)
+except NameError:
+    print("NameError")
+
+
+def gen(n):
+    i = 0
+    while i < n:
+        yield i * 2 + 1
+        i += 1
+    return i
+
+
+print(list(gen(4)))
+g = gen(2)
+print(next(g), next(g))
+try:
+    next(g)
+except StopIteration as e:
+    print("StopIteration", e.args)
+
+
+def cond(a, b):
+    r = 0
+    if a:
+        r += 1
+    if not b:
+        r += 2
+    while a < b:
+        a += 1
+        r -= 1
+    return r
+
+
+print(cond(0, 3), cond(5, 0), cond(1, 1))
+l = [0, 0, 0]
+for i in range(-3, 3):
+    l[i] = l[i] + i
+print(l)
@@ -0,0 +1,16 @@
+# test opcodes that the VM may run with the top of the stack cached, when a
+# small int overflows in the middle of an expression
+
+
+def f(a, b, c):
+    x = a + b * c - 1
+    y = [a, b, c][1] + (a < b) + (b >= c)
+    for i in range(3):
+        x += i
+        if i - 1:
+            y -= i
+    return x, y
+
+
+print(f(0x3FFFFFFF, 0x3FFFFFFF, 2))
+print(f(0x7FFFFFFFFFFFFFFF, 1 << 70, -1))
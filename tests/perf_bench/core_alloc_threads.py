@@ -0,0 +1,58 @@
+# Test speed of small-object allocation by several threads at the same time.
+#
+# Each thread makes many short-lived tuples and lists, so with threads and no
+# GIL this measures how well the allocator scales across threads.
+
+try:
+    import _thread
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def thread_entry(done, results, n):
+    total = 0
+    for i in range(n):
+        t = (i, i + 1)
+        l = [i, t]
+        total += l[1][1] - l[0]
+        l.append(i)
+    results.append(total)
+    done.release()
+
+
+def test(nthreads, niter):
+    results = []
+    locks = []
+    for i in range(nthreads):
+        done = _thread.allocate_lock()
+        done.acquire()
+        locks.append(done)
+        _thread.start_new_thread(thread_entry, (done, results, niter))
+    for done in locks:
+        done.acquire()
+    return results
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (100, 100): (2, 1000),
+    (1000, 1000): (4, 5000),
+    (5000, 1000): (4, 25000),
+}
+
+
+def bm_setup(params):
+    nthreads, niter = params
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nthreads, niter)
+
+    def result():
+        return nthreads * niter, state
+
+    return run, result
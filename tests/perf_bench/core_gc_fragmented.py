@@ -0,0 +1,52 @@
+# Test speed of multi-block heap allocations when the heap is fragmented.
+#
+# The setup leaves many small holes spread over the heap, between objects that
+# stay alive.  The test then makes allocations that are too big to fit in any
+# of those holes, so an allocator that searches from the first free block must
+# walk past all of the holes each time.
+
+import gc
+
+
+def fragment(nfrag):
+    keep = []
+    holes = []
+    for i in range(nfrag):
+        keep.append((i, i + 1, i + 2, i + 3, i + 4, i + 5))
+        holes.append((i, i + 1, i + 2, i + 3, i + 4, i + 5))
+    holes = None
+    return keep
+
+
+def test(nalloc):
+    total = 0
+    for i in range(nalloc):
+        buf = bytearray(256 + (i & 7) * 96)
+        total += len(buf)
+    return total
+
+
+###########################################################################
+# Benchmark interface
+
+bm_params = {
+    (100, 1000): (1000, 500),
+    (1000, 1000): (4000, 4000),
+    (5000, 1000): (4000, 20000),
+}
+
+
+def bm_setup(params):
+    nfrag, nalloc = params
+    keep = fragment(nfrag)
+    gc.collect()
+    state = None
+
+    def run():
+        nonlocal state
+        state = test(nalloc)
+
+    def result():
+        return nalloc // 10, (len(keep), state)
+
+    return run, result
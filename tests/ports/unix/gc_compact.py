@@ -0,0 +1,79 @@
+# Measure how much gc.compact() reduces heap fragmentation.
+#
+# Lists, dicts and bytearrays are grown in rounds interleaved with other
+# allocations, which leaves their data scattered through the heap once those
+# other allocations are freed.  The largest free block before and after
+# compaction is printed for information; the test checks that compaction
+# doesn't make it smaller (within the accuracy of the measurement) and that
+# all the data survives.
+
+import unittest
+
+try:
+    import gc
+
+    gc.compact
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+N = 100
+ROUNDS = 4
+
+
+def largest_free():
+    # Binary search for the largest bytearray that can be allocated.
+    gc.collect()
+    gc.disable()
+    lo, hi = 0, gc.mem_free() + 16
+    while hi - lo > 16:
+        mid = (lo + hi) // 2
+        try:
+            b = bytearray(mid)
+            b = None
+            lo = mid
+        except MemoryError:
+            hi = mid
+        gc.collect()
+    gc.enable()
+    return lo
+
+
+class Test(unittest.TestCase):
+    def setUp(self):
+        gc.collect()
+        self.lists = [[] for _ in range(N)]
+        self.dicts = [{} for _ in range(N)]
+        self.bytearrays = [bytearray() for _ in range(N)]
+        junk = [None] * (N * ROUNDS * 3)
+        k = 0
+        for r in range(ROUNDS):
+            for i in range(N):
+                self.lists[i].extend(range(r * 8, r * 8 + 8))
+                junk[k] = [0] * 8
+                self.dicts[i].update((j, i) for j in range(r * 4, r * 4 + 4))
+                junk[k + 1] = [0] * 8
+                self.bytearrays[i].extend(b"%04d" % i * 8)
+                junk[k + 2] = [0] * 8
+                k += 3
+        junk = None
+
+    def tearDown(self):
+        self.lists = self.dicts = self.bytearrays = None
+        gc.collect()
+
+    def test_compact(self):
+        before = largest_free()
+        moved = gc.compact()
+        after = largest_free()
+        print("largest free block before {} after {}, moved {} bytes".format(before, after, moved))
+        # largest_free() is only accurate to 16 bytes.
+        self.assertTrue(after + 16 >= before)
+        for i in range(N):
+            self.assertEqual(self.lists[i], list(range(ROUNDS * 8)))
+            self.assertEqual(self.dicts[i], {j: i for j in range(ROUNDS * 4)})
+            self.assertEqual(self.bytearrays[i], b"%04d" % i * (ROUNDS * 8))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,59 @@
+# Measure how long gc.collect() takes with different numbers of mark threads.
+#
+# The collection times are printed for information; the test only checks that
+# live data survives the parallel mark.
+
+import unittest
+
+try:
+    import gc
+    import time
+
+    gc.mark_threads
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+NUM_LISTS = 500
+LIST_LEN = 20
+NUM_COLLECTIONS = 5
+
+
+def build():
+    return [[(j, str(j)) for j in range(LIST_LEN)] for i in range(NUM_LISTS)]
+
+
+class Test(unittest.TestCase):
+    def setUp(self):
+        self.n_threads = gc.mark_threads()
+
+    def tearDown(self):
+        gc.mark_threads(self.n_threads)
+
+    def test_invalid(self):
+        with self.assertRaises(ValueError):
+            gc.mark_threads(0)
+
+    def test_scaling(self):
+        data = build()
+        for n_threads in (1, 2, 4, 8):
+            gc.mark_threads(n_threads)
+            self.assertEqual(gc.mark_threads(), n_threads)
+            best = None
+            for i in range(NUM_COLLECTIONS):
+                t = time.ticks_us()
+                gc.collect()
+                t = time.ticks_diff(time.ticks_us(), t)
+                if best is None or t < best:
+                    best = t
+                # Allocate some garbage between collections.
+                for j in range(100):
+                    [j] * LIST_LEN
+            print("mark_threads({}): collect={}us".format(n_threads, best))
+            for lst in data:
+                for j in range(LIST_LEN):
+                    self.assertEqual(lst[j], (j, str(j)))
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,75 @@
+# Measure GC pause lengths of gc.collect() and gc.collect_step().
+#
+# The p50/p99 pause times are printed for information; the test only checks
+# that incremental collections finish and reclaim the garbage.
+
+import unittest
+
+try:
+    import gc
+    import time
+
+    gc.collect_step
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+STEP_US = 200
+NUM_COLLECTIONS = 20
+
+
+def percentile(pauses, p):
+    pauses = sorted(pauses)
+    return pauses[min(len(pauses) - 1, len(pauses) * p // 100)]
+
+
+def report(name, pauses):
+    print(
+        "{}: n={} p50={}us p99={}us".format(
+            name, len(pauses), percentile(pauses, 50), percentile(pauses, 99)
+        )
+    )
+
+
+def make_garbage(n):
+    for i in range(n):
+        [i, i + 1, i + 2]
+
+
+class Test(unittest.TestCase):
+    def setUp(self):
+        gc.collect()
+        # Some long-lived data that must be marked on each collection.
+        self.live = [(i, str(i)) for i in range(2000)]
+
+    def tearDown(self):
+        self.live = None
+        gc.collect()
+
+    def test_collect(self):
+        pauses = []
+        for i in range(NUM_COLLECTIONS):
+            make_garbage(2000)
+            t = time.ticks_us()
+            gc.collect()
+            pauses.append(time.ticks_diff(time.ticks_us(), t))
+        report("collect", pauses)
+
+    def test_collect_step(self):
+        pauses = []
+        for i in range(NUM_COLLECTIONS):
+            make_garbage(2000)
+            free = gc.mem_free()
+            done = False
+            while not done:
+                t = time.ticks_us()
+                done = gc.collect_step(STEP_US)
+                pauses.append(time.ticks_diff(time.ticks_us(), t))
+            self.assertTrue(gc.mem_free() > free)
+        report("collect_step({})".format(STEP_US), pauses)
+        for i in range(len(self.live)):
+            self.assertEqual(self.live[i], (i, str(i)))
+
+
+if __name__ == "__main__":
+    unittest.main()
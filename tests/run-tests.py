@@ -80,6 +80,8 @@ via_mpy_tests_to_skip = {
         "misc/sys_settrace_features.py",
         "misc/sys_settrace_generator.py",
         "misc/sys_settrace_loop.py",
+        # This needs functions compiled from a .py file.
+        "micropython/native_tier.py",
     ),
 }
 
@@ -98,12 +100,18 @@ emitter_tests_to_skip = {
         "basics/del_local.py",
         "basics/scope_implicit.py",
         "basics/unboundlocal.py",
+        "micropython/fused_opcodes.py",
+        "micropython/vm_stack_cache.py",
         # These require "raise from".
         "basics/exception_chain.py",
         # These require stack-allocated slice optimisation.
         "micropython/heapalloc_slice.py",
         # These require implicitly running the scheduler between bytecodes.
         "micropython/schedule.py",
+        "micropython/schedule_overflow.py",
+        "micropython/schedule_stats.py",
+        # These require the call stack of bytecode functions.
+        "micropython/gc_alloc_profile.py",
         # These require sys.exc_info().
         "misc/sys_exc_info.py",
         # These require sys.settrace().
@@ -112,6 +120,8 @@ emitter_tests_to_skip = {
         "misc/sys_settrace_generator.py",
         "misc/sys_settrace_loop.py",
         # These are bytecode-specific tests.
+        "micropython/native_tier.py",
+        "micropython/native_tier_source.py",
         "stress/bytecode_limit.py",
     ),
 }
@@ -297,12 +307,15 @@ tests_requiring_slice = (
     "float/string_format_modulo.py",
     "micropython/builtin_execfile.py",
     "micropython/extreme_exc.py",
+    "micropython/gc_alloc_profile.py",
+    "micropython/gc_compact.py",
     "micropython/heapalloc_fail_bytearray.py",
     "micropython/heapalloc_fail_list.py",
     "micropython/heapalloc_fail_memoryview.py",
     "micropython/import_mpy_invalid.py",
     "micropython/import_mpy_native.py",
     "micropython/import_mpy_native_gc.py",
+    "micropython/qstr_index.py",
     "micropython/ringio_big.py",
     "misc/non_compliant.py",
     "misc/rge_sm.py",
@@ -489,6 +489,9 @@ function ci_qemu_build_arm_thumb_softfp {
     ci_qemu_build_arm_prepare
     make BOARD=MPS2_AN385 ${MAKEOPTS} -C ports/qemu USER_C_MODULES=../../examples/usercmodule test_full
 
+    # Test object representation C, with floats held in the object handle.
+    make BOARD=MPS2_AN385 ${MAKEOPTS} -C ports/qemu MICROPY_OBJ_REPR=c BUILD=build-MPS2_AN385-repr-c test
+
     # Test building native .mpy with ARM-M softfp architectures.
     ci_native_mpy_modules_build armv6m
     ci_native_mpy_modules_build armv7m
@@ -24,6 +24,7 @@
 # OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 # THE SOFTWARE.
 
+import contextlib
 import sys
 import os
 import subprocess
@@ -136,6 +137,14 @@ def main():
     )
     cmd_parser.add_argument("-v", "--var", action="append", help="variables to substitute")
     cmd_parser.add_argument("--mpy-tool-flags", default="", help="flags to pass to mpy-tool")
+    cmd_parser.add_argument(
+        "-j", "--jobs", type=int, help="number of mpy-cross processes (default: number of CPUs)"
+    )
+    cmd_parser.add_argument(
+        "--mpy-cross-cache",
+        default=os.getenv("MICROPY_MPYCROSS_CACHE"),
+        help="directory to cache compiled .mpy files in (default: $MICROPY_MPYCROSS_CACHE)",
+    )
     cmd_parser.add_argument("files", nargs="+", help="input manifest list")
     args = cmd_parser.parse_args()
 
@@ -175,6 +184,7 @@ def main():
     # Process the manifest
     str_paths = []
     mpy_files = []
+    mpy_jobs = []
     ts_newest = 0
     for result in manifest.files():
         if result.kind == manifestfile.KIND_FREEZE_AS_STR:
@@ -189,24 +199,7 @@ def main():
             outfile = "{}/frozen_mpy/{}.mpy".format(args.build_dir, result.target_path[:-3])
             ts_outfile = get_timestamp(outfile, 0)
             if result.timestamp >= ts_outfile:
-                print("MPY", result.target_path)
-                mkdir(outfile)
-                # Add __version__ to the end of the file before compiling.
-                with manifestfile.tagged_py_file(result.full_path, result.metadata) as tagged_path:
-                    try:
-                        mpy_cross.compile(
-                            tagged_path,
-                            dest=outfile,
-                            src_path=result.target_path,
-                            opt=result.opt,
-                            mpy_cross=MPY_CROSS,
-                            extra_args=args.mpy_cross_flags.split(),
-                        )
-                    except mpy_cross.CrossCompileError as ex:
-                        print("error compiling {}:".format(result.target_path))
-                        print(ex.args[0])
-                        raise SystemExit(1)
-                ts_outfile = get_timestamp(outfile)
+                mpy_jobs.append((result, outfile))
             mpy_files.append(outfile)
         else:
             assert result.kind == manifestfile.KIND_FREEZE_MPY
@@ -214,6 +207,41 @@ def main():
             ts_outfile = result.timestamp
         ts_newest = max(ts_newest, ts_outfile)
 
+    # Compile the .py files that changed, in parallel.
+    if mpy_jobs:
+        with contextlib.ExitStack() as stack:
+            jobs = []
+            for result, outfile in mpy_jobs:
+                print("MPY", result.target_path)
+                mkdir(outfile)
+                # Add __version__ to the end of the file before compiling.
+                tagged_path = stack.enter_context(
+                    manifestfile.tagged_py_file(result.full_path, result.metadata)
+                )
+                jobs.append(
+                    mpy_cross.BatchJob(
+                        tagged_path, outfile, src_path=result.target_path, opt=result.opt
+                    )
+                )
+            try:
+                failed = mpy_cross.compile_batch(
+                    jobs,
+                    mpy_cross=MPY_CROSS,
+                    extra_args=args.mpy_cross_flags.split(),
+                    num_workers=args.jobs,
+                    cache_dir=args.mpy_cross_cache,
+                )
+            except mpy_cross.CrossCompileError as ex:
+                print(ex.args[0])
+                raise SystemExit(1)
+        if failed:
+            for job in jobs:
+                if job.error is not None:
+                    print("error compiling {}:".format(job.src_path))
+                    print(job.error)
+            raise SystemExit(1)
+        ts_newest = max([ts_newest] + [get_timestamp(outfile) for _, outfile in mpy_jobs])
+
     # Check if output file needs generating
     if ts_newest < get_timestamp(args.output, 0):
         # No files are newer than output file so it does not need updating
@@ -73,6 +73,8 @@ class Config:
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
     MICROPY_LONGINT_IMPL_MPZ = 2
+    freeze_dedup = False
+    freeze_line_info = "all"
 
 
 config = Config()
@@ -138,6 +140,7 @@ MP_BC_FORMAT_VAR_UINT = 2
 MP_BC_FORMAT_OFFSET = 3
 
 MP_NATIVE_ARCH_FLAGS_PRESENT = 0x40
+MPY_FEATURE_FUSED_OPCODES = 0x80
 
 mp_unary_op_method_name = (
     "__pos__",
@@ -189,12 +192,12 @@ class Opcode:
     # fmt: off
     # Load, Store, Delete, Import, Make, Build, Unpack, Call, Jump, Exception, For, sTack, Return, Yield, Op
     MP_BC_BASE_RESERVED               = (0x00) # ----------------
-    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDII---
+    MP_BC_BASE_QSTR_O                 = (0x10) # LLLLLLSSSDDIIFF-
     MP_BC_BASE_VINT_E                 = (0x20) # MMLLLLSSDDBBBBBB
     MP_BC_BASE_VINT_O                 = (0x30) # UUMMCCCC--------
-    MP_BC_BASE_JUMP_E                 = (0x40) # J-JJJJJEEEEF----
+    MP_BC_BASE_JUMP_E                 = (0x40) # JFJJJJJEEEEF----
     MP_BC_BASE_BYTE_O                 = (0x50) # LLLLSSDTTTTTEEFF
-    MP_BC_BASE_BYTE_E                 = (0x60) # --BREEEYYI------
+    MP_BC_BASE_BYTE_E                 = (0x60) # FFBREEEYYI------
     MP_BC_LOAD_CONST_SMALL_INT_MULTI  = (0x70) # LLLLLLLLLLLLLLLL
     #                                 = (0x80) # LLLLLLLLLLLLLLLL
     #                                 = (0x90) # LLLLLLLLLLLLLLLL
@@ -294,17 +297,26 @@ class Opcode:
     MP_BC_IMPORT_NAME                 = (MP_BC_BASE_QSTR_O + 0x0b) # qstr
     MP_BC_IMPORT_FROM                 = (MP_BC_BASE_QSTR_O + 0x0c) # qstr
     MP_BC_IMPORT_STAR                 = (MP_BC_BASE_BYTE_E + 0x09)
+
+    # Fused opcodes, only in .mpy files with MPY_FEATURE_FUSED_OPCODES
+    MP_BC_LOAD_FAST_2                 = (MP_BC_BASE_BYTE_E + 0x00) # extra byte
+    MP_BC_LOAD_FAST0_ATTR             = (MP_BC_BASE_QSTR_O + 0x0d) # qstr
+    MP_BC_STORE_FAST0_ATTR            = (MP_BC_BASE_QSTR_O + 0x0e) # qstr
+    MP_BC_BINARY_OP_SMALL_INT         = (MP_BC_BASE_BYTE_E + 0x01) # extra byte
+    MP_BC_POP_JUMP_IF_COMPARE         = (MP_BC_BASE_JUMP_E + 0x01) # signed relative bytecode offset; then a byte
     # fmt: on
 
     # Create sets of related opcodes.
     ALL_OFFSET_SIGNED = (
         MP_BC_UNWIND_JUMP,
+        MP_BC_POP_JUMP_IF_COMPARE,
         MP_BC_JUMP,
         MP_BC_POP_JUMP_IF_TRUE,
         MP_BC_POP_JUMP_IF_FALSE,
     )
     ALL_OFFSET = (
         MP_BC_UNWIND_JUMP,
+        MP_BC_POP_JUMP_IF_COMPARE,
         MP_BC_JUMP,
         MP_BC_POP_JUMP_IF_TRUE,
         MP_BC_POP_JUMP_IF_FALSE,
@@ -398,6 +410,9 @@ def mp_opcode_decode(bytecode, ip):
     if opcode & MP_BC_MASK_EXTRA_BYTE == 0:
         extra_arg = bytecode[ip]
         ip += 1
+        if f == MP_BC_FORMAT_OFFSET:
+            # The offset is relative to the end of the offset, not of the extra byte.
+            arg -= 1
     return f, ip - ip_start, arg, extra_arg
 
 
@@ -574,6 +589,18 @@ class MPFunTable:
         return "mp_fun_table"
 
 
+def const_obj_key(obj):
+    # Return a key that is equal for constant objects that can be shared.  The type is
+    # included so that, eg, 1, 1.0 and True are distinct, and floats use repr so that
+    # 0.0 and -0.0 are distinct.
+    if type(obj) is tuple:
+        return ("tuple",) + tuple(const_obj_key(o) for o in obj)
+    elif isinstance(obj, (float, complex, MPFunTable)):
+        return (type(obj).__name__, repr(obj))
+    else:
+        return (type(obj).__name__, obj)
+
+
 class CompiledModule:
     def __init__(
         self,
@@ -718,6 +745,23 @@ class CompiledModule:
         print("};")
 
     def freeze_constant_obj(self, obj_name, obj):
+        global dedup_obj_count
+
+        if not config.freeze_dedup:
+            return self.freeze_constant_obj_new(obj_name, obj)
+
+        # reuse an identical constant object that was already frozen
+        key = const_obj_key(obj)
+        if key in frozen_obj_refs:
+            obj_ref = frozen_obj_refs[key]
+            if "const_obj_" in obj_ref:
+                dedup_obj_count += 1
+        else:
+            obj_ref = self.freeze_constant_obj_new(obj_name, obj)
+            frozen_obj_refs[key] = obj_ref
+        return obj_ref
+
+    def freeze_constant_obj_new(self, obj_name, obj):
         global const_str_content, const_int_content, const_obj_content
 
         if isinstance(obj, MPFunTable):
@@ -749,7 +793,9 @@ class CompiledModule:
                 % (
                     obj_name,
                     obj_type,
-                    qstrutil.compute_hash(obj, config.MICROPY_QSTR_BYTES_IN_HASH),
+                    qstrutil.compute_hash(
+                        obj, config.MICROPY_QSTR_BYTES_IN_HASH, config.MICROPY_QSTR_HASH_WORDWISE
+                    ),
                     len(obj),
                     "".join(("\\x%02x" % b) for b in obj),
                 )
@@ -888,16 +934,7 @@ class RawCode(object):
         self.code_kind = code_kind
 
         if code_kind in (MP_CODE_BYTECODE, MP_CODE_NATIVE_PY):
-            (
-                self.offset_prelude_size,
-                self.offset_source_info,
-                self.offset_line_info,
-                self.offset_closure_info,
-                self.offset_opcodes,
-                self.prelude_signature,
-                self.prelude_size,
-                self.names,
-            ) = extract_prelude(self.fun_data, prelude_offset)
+            self.extract_prelude()
             self.scope_flags = self.prelude_signature[2]
             self.n_pos_args = self.prelude_signature[3]
             self.simple_name = self.qstr_table[self.names[0]]
@@ -915,6 +952,23 @@ class RawCode(object):
         self.escaped_names.add(unique_escaped_name)
         self.escaped_name = unique_escaped_name
 
+    def extract_prelude(self):
+        (
+            self.offset_prelude_size,
+            self.offset_source_info,
+            self.offset_line_info,
+            self.offset_closure_info,
+            self.offset_opcodes,
+            self.prelude_signature,
+            self.prelude_size,
+            self.names,
+        ) = extract_prelude(self.fun_data, self.prelude_offset)
+
+    def all_raw_code(self):
+        yield self
+        for rc in self.children:
+            yield from rc.all_raw_code()
+
     def disassemble_children(self):
         self.print_children_annotated()
         for rc in self.children:
@@ -1168,7 +1222,70 @@ class RawCodeBytecode(RawCode):
             ip += sz
         self.disassemble_children()
 
+    def strip_line_info(self, policy):
+        # Remove line-number info from the bytecode, returning the number of bytes saved.
+        # The "first" policy keeps the entries at offset 0, so a traceback still reports
+        # the line of the first statement of the function.
+        bc = self.fun_data
+        line_info = memoryview(bc)[self.offset_line_info : self.offset_closure_info]
+        n_keep = 0
+        if policy == "first":
+            while line_info:
+                bc_increment, _, rest = self.decode_lineinfo(line_info)
+                if bc_increment != 0:
+                    break
+                n_keep += len(line_info) - len(rest)
+                line_info = rest
+        n_info, n_cell = self.prelude_size
+        n_info -= self.offset_closure_info - self.offset_line_info - n_keep
+        self.fun_data = (
+            bytes(bc[: self.offset_prelude_size])
+            + encode_prelude_size(n_info, n_cell)
+            + bytes(bc[self.offset_source_info : self.offset_line_info + n_keep])
+            + bytes(bc[self.offset_closure_info :])
+        )
+        self.extract_prelude()
+        return len(bc) - len(self.fun_data)
+
+    def dedup_key(self):
+        # Bytecode indexes into the qstr and object tables of its module, so it can only
+        # be shared when the bytes match and each index resolves to the same value.
+        bc = self.fun_data
+        refs = [self.qstr_table[i].str for i in self.names]
+        ip = self.offset_opcodes
+        while ip < len(bc):
+            fmt, sz, arg, _ = mp_opcode_decode(bc, ip)
+            if fmt == MP_BC_FORMAT_QSTR:
+                refs.append(self.qstr_table[arg].str)
+            elif bc[ip] == Opcode.MP_BC_LOAD_CONST_OBJ:
+                refs.append(const_obj_key(self.obj_table[arg]))
+            ip += sz
+        return bytes(bc), tuple(refs)
+
     def freeze(self):
+        global bc_content, dedup_bc_count
+
+        # reuse identical bytecode that was already frozen, if enabled
+        if config.freeze_dedup:
+            shared_name = frozen_fun_data.setdefault(self.dedup_key(), self.escaped_name)
+        else:
+            shared_name = self.escaped_name
+
+        if shared_name == self.escaped_name:
+            self.freeze_fun_data()
+            bc_content += len(self.fun_data)
+        else:
+            print(
+                "// frozen bytecode for file %s, scope %s, same as %s"
+                % (self.qstr_table[0].str, self.escaped_name, shared_name)
+            )
+            print("#define fun_data_%s fun_data_%s" % (self.escaped_name, shared_name))
+            dedup_bc_count += 1
+
+        self.freeze_children()
+        self.freeze_raw_code()
+
+    def freeze_fun_data(self):
         # generate bytecode data
         bc = self.fun_data
         print(
@@ -1207,12 +1324,6 @@ class RawCodeBytecode(RawCode):
 
         print("};")
 
-        self.freeze_children()
-        self.freeze_raw_code()
-
-        global bc_content
-        bc_content += len(bc)
-
 
 class RawCodeNative(RawCode):
     def __init__(
@@ -1529,7 +1640,9 @@ def read_mpy(filename):
                 config.native_arch = mpy_native_arch
             elif config.native_arch != mpy_native_arch:
                 raise MPYReadError(filename, "native architecture mismatch")
-        config.mp_small_int_bits = header[3]
+        config.mp_small_int_bits = header[3] & ~MPY_FEATURE_FUSED_OPCODES
+        if header[3] & MPY_FEATURE_FUSED_OPCODES:
+            config.fused_opcodes = True
 
         arch_flags = 0
         # Read the architecture-specific flag bits if present.
@@ -1617,6 +1730,12 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
         print("#endif")
         print()
 
+    if config.fused_opcodes:
+        print("#if !MICROPY_OPT_FUSED_OPCODES")
+        print('#error "frozen bytecode needs MICROPY_OPT_FUSED_OPCODES"')
+        print("#endif")
+        print()
+
     print("#if MICROPY_PY_BUILTINS_FLOAT")
     print("typedef struct _mp_obj_float_t {")
     print("    mp_obj_base_t base;")
@@ -1669,7 +1788,9 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
         print()
         print("const qstr_hash_t mp_qstr_frozen_const_hashes[] = {")
         for _, _, _, qbytes in new:
-            qhash = qstrutil.compute_hash(qbytes, config.MICROPY_QSTR_BYTES_IN_HASH)
+            qhash = qstrutil.compute_hash(
+                qbytes, config.MICROPY_QSTR_BYTES_IN_HASH, config.MICROPY_QSTR_HASH_WORDWISE
+            )
             print("    %d," % qhash)
             qstr_content += config.MICROPY_QSTR_BYTES_IN_HASH
         print("};")
@@ -1697,7 +1818,20 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
     print("    },")
     print("};")
 
+    # Remove line-number info from bytecode, according to the policy.
+    line_info_content = 0
+    if config.freeze_line_info != "all":
+        for cm in compiled_modules:
+            for rc in cm.raw_code.all_raw_code():
+                if rc.code_kind == MP_CODE_BYTECODE:
+                    line_info_content += rc.strip_line_info(config.freeze_line_info)
+
     # Freeze all modules.
+    global frozen_obj_refs, frozen_fun_data, dedup_obj_count, dedup_bc_count
+    frozen_obj_refs = {}
+    frozen_fun_data = {}
+    dedup_obj_count = 0
+    dedup_bc_count = 0
     for idx, cm in enumerate(compiled_modules):
         cm.freeze(idx)
 
@@ -1760,6 +1894,10 @@ def freeze_mpy(firmware_qstr_idents, compiled_modules):
     print("raw code content: %d * 4 = %d" % (raw_code_count, raw_code_content))
     print("mp_frozen_mpy_names_content: %d" % mp_frozen_mpy_names_content)
     print("mp_frozen_mpy_content_size: %d" % mp_frozen_mpy_content_size)
+    if config.freeze_dedup:
+        print("shared: %d const objs, %d bytecode" % (dedup_obj_count, dedup_bc_count))
+    if config.freeze_line_info != "all":
+        print("line info removed: %d bytes" % line_info_content)
     print(
         "total: %d"
         % (
@@ -1890,7 +2028,9 @@ def merge_mpy(compiled_modules, output_file):
             if config.native_arch
             else 0
         )
-        header[3] = config.mp_small_int_bits
+        header[3] = config.mp_small_int_bits | (
+            MPY_FEATURE_FUSED_OPCODES if config.fused_opcodes else 0
+        )
         merged_mpy.extend(header)
 
         if arch_flags != 0:
@@ -2114,6 +2254,17 @@ def main(args=None):
         help="extract only segments of the given type (meta, qstr, obj, code)",
     )
     cmd_parser.add_argument("-q", "--qstr-header", help="qstr header file to freeze against")
+    cmd_parser.add_argument(
+        "--dedup",
+        action="store_true",
+        help="when freezing, share identical constants and bytecode between all modules",
+    )
+    cmd_parser.add_argument(
+        "--line-info",
+        choices=["all", "first", "none"],
+        default="all",
+        help="when freezing, line-number info to keep in bytecode (default all)",
+    )
     cmd_parser.add_argument(
         "-mlongint-impl",
         choices=["none", "longlong", "mpz"],
@@ -2146,6 +2297,9 @@ def main(args=None):
     config.MPZ_DIG_SIZE = args.mmpz_dig_size
     config.native_arch = MP_NATIVE_ARCH_NONE
     config.arch_flags = args.march_flags
+    config.fused_opcodes = False
+    config.freeze_dedup = args.dedup
+    config.freeze_line_info = args.line_info
 
     # set config values for qstrs, and get the existing base set of qstrs
     # already in the firmware
@@ -2154,9 +2308,11 @@ def main(args=None):
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident) | set(extra_qstrs.keys())
         config.MICROPY_QSTR_BYTES_IN_LEN = int(qcfgs["BYTES_IN_LEN"])
         config.MICROPY_QSTR_BYTES_IN_HASH = int(qcfgs["BYTES_IN_HASH"])
+        config.MICROPY_QSTR_HASH_WORDWISE = int(qcfgs.get("HASH_WORDWISE", 0))
     else:
         config.MICROPY_QSTR_BYTES_IN_LEN = 1
         config.MICROPY_QSTR_BYTES_IN_HASH = 1
+        config.MICROPY_QSTR_HASH_WORDWISE = 0
         firmware_qstr_idents = set(qstrutil.static_qstr_list_ident)
 
     # Create initial list of global qstrs.
@@ -2,16 +2,31 @@
 import argparse
 import os
 import os.path
+import shutil
+import sys
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), "../mpy-cross"))
+import mpy_cross
 
 argparser = argparse.ArgumentParser(description="Compile all .py files to .mpy recursively")
 argparser.add_argument("-o", "--out", help="output directory (default: input dir)")
 argparser.add_argument("--target", help="select MicroPython target config")
+argparser.add_argument("--mpy-cross", help="mpy-cross binary (default: mpy-cross in PATH)")
+argparser.add_argument(
+    "-j", "--jobs", type=int, help="number of mpy-cross processes (default: number of CPUs)"
+)
+argparser.add_argument(
+    "--cache",
+    default=os.getenv("MICROPY_MPYCROSS_CACHE"),
+    help="directory to cache .mpy files in (default: $MICROPY_MPYCROSS_CACHE, or no cache)",
+)
 argparser.add_argument("dir", help="input directory")
 args = argparser.parse_args()
 
 TARGET_OPTS = {
-    "unix": "",
-    "baremetal": "",
+    "unix": [],
+    "baremetal": [],
 }
 
 args.dir = args.dir.rstrip("/")
@@ -19,23 +34,39 @@ args.dir = args.dir.rstrip("/")
 if not args.out:
     args.out = args.dir
 
+if not args.mpy_cross:
+    args.mpy_cross = shutil.which("mpy-cross")
+
 path_prefix_len = len(args.dir) + 1
 
+jobs = []
 for path, subdirs, files in os.walk(args.dir):
     for f in files:
         if f.endswith(".py"):
             fpath = path + "/" + f
-            # print(fpath)
             out_fpath = args.out + "/" + fpath[path_prefix_len:-3] + ".mpy"
             out_dir = os.path.dirname(out_fpath)
             if not os.path.isdir(out_dir):
                 os.makedirs(out_dir)
-            cmd = "mpy-cross -v -v %s -s %s %s -o %s" % (
-                TARGET_OPTS.get(args.target, ""),
-                fpath[path_prefix_len:],
-                fpath,
-                out_fpath,
-            )
-            # print(cmd)
-            res = os.system(cmd)
-            assert res == 0
+            jobs.append(mpy_cross.BatchJob(fpath, out_fpath, src_path=fpath[path_prefix_len:]))
+
+t = time.time()
+failed = mpy_cross.compile_batch(
+    jobs,
+    mpy_cross=args.mpy_cross,
+    extra_args=TARGET_OPTS.get(args.target, []),
+    num_workers=args.jobs,
+    cache_dir=args.cache,
+)
+t = time.time() - t
+
+for job in jobs:
+    if job.error is not None:
+        print("error compiling {}:".format(job.src))
+        print(job.error, end="")
+n_cached = sum(job.cached for job in jobs)
+print(
+    "compiled {} files ({} cached, {} failed) in {:.2f}s".format(len(jobs), n_cached, failed, t)
+)
+if failed:
+    sys.exit(1)